@@ -60,6 +60,7 @@ option(SV_USE_METIS_SVFSI "Use metis_svfsi Library" ON)
 option(SV_USE_PARMETIS_SVFSI "Use parmetis_svfsi Library" ON)
 option(SV_USE_TETGEN "Use tetgen Library" ON)
 option(SV_USE_TRILINOS "Use Trilinos Library with svFSI" OFF)
+option(SV_USE_OPENMP "Use OpenMP threading in svFSI kernels" OFF)
 #-----------------------------------------------------------------------------
 
 #-----------------------------------------------------------------------------
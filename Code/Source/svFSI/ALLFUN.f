@@ -312,15 +312,139 @@
       RETURN
       END FUNCTION IntegG
 !--------------------------------------------------------------------
+!     This routine integrates nq quantities over the faces in fList
+!     (mesh, face) in one pass over the elements of each face, followed
+!     by a single reduction. Quantity i is s(qs(i),:) if ql(i) is 1, or
+!     the flux of s(qs(i):qs(i)+nsd-1,:) if ql(i) is nsd. Scalars with
+!     qTH(i) use the pressure function space of Taylor-Hood meshes.
+      SUBROUTINE IntegFa(nF, fList, nq, qs, ql, qTH, s, res, noRed)
+      USE COMMOD
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: nF, fList(2,nF), nq, qs(nq),
+     2   ql(nq)
+      LOGICAL, INTENT(IN) :: qTH(nq)
+      REAL(KIND=RKIND), INTENT(IN) :: s(:,:)
+      REAL(KIND=RKIND), INTENT(OUT) :: res(nq,nF)
+      LOGICAL, INTENT(IN), OPTIONAL :: noRed
+
+      INTEGER(KIND=IKIND) i, iM, iFa
+
+      IF (SIZE(s,2) .NE. tnNo) err = "Incompatible vector size in "//
+     2   "IntegFa"
+      DO i=1, nq
+         IF (ql(i).NE.1 .AND. ql(i).NE.nsd) err = "IntegFa only "//
+     2      "accepts 1 and nsd"
+      END DO
+
+      IF (nq .EQ. 0) RETURN
+      DO i=1, nF
+         iM  = fList(1,i)
+         iFa = fList(2,i)
+         CALL IntegFaL(msh(iM)%fa(iFa), msh(iM)%nFs.EQ.2, nq, qs, ql,
+     2      qTH, s, res(:,i))
+      END DO
+
+      IF (PRESENT(noRed)) THEN
+         IF (noRed) RETURN
+      END IF
+      IF (cm%seq() .OR. nq*nF.EQ.0) RETURN
+      res = RESHAPE(cm%reduce(RESHAPE(res, (/nq*nF/))), (/nq,nF/))
+
+      RETURN
+      END SUBROUTINE IntegFa
+!--------------------------------------------------------------------
+!     Local integrals of IntegFa over a single face. The face normal is
+!     computed once per Gauss point and shared by all the quantities.
+      SUBROUTINE IntegFaL(lFa, lTH, nq, qs, ql, qTH, s, res)
+      USE COMMOD
+      IMPLICIT NONE
+      TYPE(faceType), INTENT(IN) :: lFa
+      LOGICAL, INTENT(IN) :: lTH, qTH(nq)
+      INTEGER(KIND=IKIND), INTENT(IN) :: nq, qs(nq), ql(nq)
+      REAL(KIND=RKIND), INTENT(IN) :: s(:,:)
+      REAL(KIND=RKIND), INTENT(OUT) :: res(nq)
+
+      LOGICAL lV
+      INTEGER(KIND=IKIND) a, e, g, i, k, iq, Ac, insd, eNoN
+      REAL(KIND=RKIND) Jac, sHat, n(nsd), nV(nsd)
+
+      insd = nsd - 1
+      IF (msh(lFa%iM)%lShl) insd = insd - 1
+      IF (msh(lFa%iM)%lFib) insd = 0
+      lV = ANY(ql .EQ. nsd) .AND. insd.NE.nsd-1
+
+      res  = 0._RKIND
+      eNoN = lFa%eNoN
+      DO e=1, lFa%nEl
+!     Updating the shape functions, if this is a NURB
+         IF (lFa%eType .EQ. eType_NRB) CALL NRBNNXB(msh(lFa%iM), lFa, e)
+
+         DO g=1, lFa%nG
+            IF (lFa%eType .EQ. eType_NRB) THEN
+               CALL GNNB(lFa, e, g, insd, eNoN, lFa%Nx(:,:,g), n)
+            ELSE
+               CALL GNNB(lFa, e, g, insd, eNoN, lFa%fs(1)%Nx(:,:,g), n)
+            END IF
+            Jac = SQRT(NORM(n))
+!     Fluxes always use the normal of an (nsd-1) dimensional surface
+            nV = n
+            IF (lV) CALL GNNB(lFa, e, g, nsd-1, eNoN, lFa%Nx(:,:,g), nV)
+
+            DO iq=1, nq
+               IF (qTH(iq) .AND. lTH) CYCLE
+               i    = qs(iq)
+               sHat = 0._RKIND
+               IF (ql(iq) .EQ. 1) THEN
+                  DO a=1, eNoN
+                     Ac   = lFa%IEN(a,e)
+                     sHat = sHat + s(i,Ac)*lFa%N(a,g)
+                  END DO
+                  res(iq) = res(iq) + Jac*lFa%w(g)*sHat
+               ELSE
+                  DO a=1, eNoN
+                     Ac = lFa%IEN(a,e)
+                     DO k=1, nsd
+                        sHat = sHat + lFa%N(a,g)*s(i+k-1,Ac)*nV(k)
+                     END DO
+                  END DO
+                  res(iq) = res(iq) + lFa%w(g)*sHat
+               END IF
+            END DO
+         END DO
+      END DO
+
+!     Scalars in the pressure function space of Taylor-Hood meshes
+      IF (.NOT.lTH .OR. .NOT.ANY(qTH)) RETURN
+      eNoN = lFa%fs(2)%eNoN
+      DO e=1, lFa%nEl
+         DO g=1, lFa%fs(2)%nG
+            CALL GNNB(lFa, e, g, insd, eNoN, lFa%fs(2)%Nx(:,:,g), n)
+            Jac = SQRT(NORM(n))
+            DO iq=1, nq
+               IF (.NOT.qTH(iq)) CYCLE
+               i    = qs(iq)
+               sHat = 0._RKIND
+               DO a=1, eNoN
+                  Ac   = lFa%IEN(a,e)
+                  sHat = sHat + s(i,Ac)*lFa%fs(2)%N(a,g)
+               END DO
+               res(iq) = res(iq) + Jac*lFa%fs(2)%w(g)*sHat
+            END DO
+         END DO
+      END DO
+
+      RETURN
+      END SUBROUTINE IntegFaL
+!--------------------------------------------------------------------
 !     This routine integrate an equation over a particular domain
-      FUNCTION vInteg(dId, s, l, u, pFlag)
+      FUNCTION vInteg(dId, s, l, u, pFlag, noRed)
       USE COMMOD
       IMPLICIT NONE
       REAL(KIND=RKIND), INTENT(IN) :: s(:,:)
       INTEGER(KIND=IKIND), INTENT(IN) :: dId
       INTEGER(KIND=IKIND), INTENT(IN) :: l
       INTEGER(KIND=IKIND), INTENT(IN) :: u
-      LOGICAL, INTENT(IN), OPTIONAL :: pFlag
+      LOGICAL, INTENT(IN), OPTIONAL :: pFlag, noRed
       REAL(KIND=RKIND) vInteg
 
       LOGICAL isIB, flag
@@ -488,6 +612,10 @@
       END IF
 
       IF (cm%seq() .OR. isIB) RETURN
+!     The caller may reduce several integrals together
+      IF (PRESENT(noRed)) THEN
+         IF (noRed) RETURN
+      END IF
       vInteg = cm%reduce(vInteg)
 
       RETURN
@@ -1177,6 +1305,9 @@
       IF (ALLOCATED(lM%fN))      DEALLOCATE(lM%fN)
       IF (ALLOCATED(lM%Nx))      DEALLOCATE(lM%Nx)
       IF (ALLOCATED(lM%Nxx))     DEALLOCATE(lM%Nxx)
+      IF (ALLOCATED(lM%cNx))     DEALLOCATE(lM%cNx)
+      IF (ALLOCATED(lM%cJac))    DEALLOCATE(lM%cJac)
+      IF (ALLOCATED(lM%cKs))     DEALLOCATE(lM%cKs)
 
       IF (ALLOCATED(lM%fs)) THEN
          DO i=1, lM%nFs
@@ -151,15 +151,12 @@
       REAL(KIND=RKIND), INTENT(INOUT) :: xl(nsd,eNoN)
 
       INTEGER(KIND=IKIND) :: g, cPhys
-      REAL(KIND=RKIND) :: w
-
-      REAL(KIND=RKIND), ALLOCATABLE :: N(:), Nx(:,:), lR(:,:), lK(:,:,:)
+      REAL(KIND=RKIND) :: w, N(eNoN), Nx(2,eNoN), lR(dof,eNoN),
+     2   lK(dof*dof,eNoN,eNoN)
 
       IF (nsd .NE. 3) err = "Unexpected encounter. Correction needed "//
      2   "in BFCONSTRUCT"
 
-      ALLOCATE(N(eNoN), Nx(2,eNoN), lR(dof,eNoN), lK(dof*dof,eNoN,eNoN))
-
       cDmn  = DOMAIN(lM, cEq, e)
       cPhys = eq(cEq)%dmn(cDmn)%phys
 
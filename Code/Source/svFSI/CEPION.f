@@ -128,11 +128,11 @@
       REAL(KIND=RKIND), INTENT(IN) :: Dg(tDof,tnNo)
 
       LOGICAL :: IPASS = .TRUE.
-      INTEGER(KIND=IKIND) :: a, Ac, iM, iDmn, cPhys, dID, nX, nG
-      REAL(KIND=RKIND) :: yl
+      INTEGER(KIND=IKIND) :: a, Ac, iM, iDmn, cPhys, dID, nX, nG, nC
 
-      REAL(KIND=RKIND), ALLOCATABLE :: I4f(:), Xl(:), Xgl(:), sA(:),
-     2   sY(:), sF(:,:)
+      INTEGER(KIND=IKIND), ALLOCATABLE :: cId(:)
+      REAL(KIND=RKIND), ALLOCATABLE :: I4f(:), Xl(:,:), Xgl(:,:), yl(:),
+     2   I4l(:), sA(:), sY(:), sF(:,:)
       SAVE IPASS
 
       ALLOCATE(I4f(tnNo))
@@ -164,35 +164,70 @@
          END DO
       END IF
 
-!     Integrate electric potential based on cellular activation model
+!     Integrate electric potential based on cellular activation model.
+!     The nodes of each domain are gathered in structure-of-arrays
+!     layout and integrated together in blocks
       IF (ALLOCATED(dmnId)) THEN
          ALLOCATE(sA(tnNo), sF(nXion,tnNo), sY(tnNo))
          sA = 0._RKIND
          sF = 0._RKIND
          sY = 0._RKIND
+      END IF
+      ALLOCATE(cId(tnNo))
+      DO iDmn=1, eq(iEq)%nDmn
+         dID = 0
+         IF (ALLOCATED(dmnId)) THEN
+            cPhys = eq(iEq)%dmn(iDmn)%phys
+            dID   = eq(iEq)%dmn(iDmn)%Id
+            IF (cPhys .NE. phys_CEP) CYCLE
+         ELSE IF (iDmn .GT. 1) THEN
+            EXIT
+         END IF
+
+         nC = 0
          DO Ac=1, tnNo
             IF (.NOT.ISDOMAIN(iEq, Ac, phys_CEP)) CYCLE
-            DO iDmn=1, eq(iEq)%nDmn
-               cPhys = eq(iEq)%dmn(iDmn)%phys
-               dID   = eq(iEq)%dmn(iDmn)%Id
-               IF (cPhys.NE.phys_CEP .OR. .NOT.BTEST(dmnId(Ac),dID))
-     2             CYCLE
-               nX = eq(iEq)%dmn(iDmn)%cep%nX
-               nG = eq(iEq)%dmn(iDmn)%cep%nG
-               ALLOCATE(Xl(nX), Xgl(nG))
-               Xl  = Xion(1:nX,Ac)
-               Xgl = Xion(nX+1:nX+nG,Ac)
-               yl  = 0._RKIND
-               IF (cem%cpld) yl = cem%Ya(Ac)
-               CALL CEPINTEGL(eq(iEq)%dmn(iDmn)%cep, nX, nG, Xl, Xgl,
-     2            time-dt, yl, I4f(Ac))
+            IF (ALLOCATED(dmnId)) THEN
+               IF (.NOT.BTEST(dmnId(Ac),dID)) CYCLE
+            END IF
+            nC = nC + 1
+            cId(nC) = Ac
+         END DO
+         IF (nC .EQ. 0) CYCLE
+
+         nX = eq(iEq)%dmn(iDmn)%cep%nX
+         nG = eq(iEq)%dmn(iDmn)%cep%nG
+         ALLOCATE(Xl(nC,nX), Xgl(nC,nG), yl(nC), I4l(nC))
+         yl = 0._RKIND
+         DO a=1, nC
+            Ac = cId(a)
+            Xl(a,:)  = Xion(1:nX,Ac)
+            Xgl(a,:) = Xion(nX+1:nX+nG,Ac)
+            I4l(a)   = I4f(Ac)
+            IF (cem%cpld) yl(a) = cem%Ya(Ac)
+         END DO
+
+         CALL CEPINTEGV(eq(iEq)%dmn(iDmn)%cep, nC, nX, nG, Xl, Xgl,
+     2      time-dt, yl, I4l)
+
+         DO a=1, nC
+            Ac = cId(a)
+            IF (ALLOCATED(dmnId)) THEN
                sA(Ac) = sA(Ac) + 1._RKIND
-               sF(1:nX,Ac) = sF(1:nX,Ac) + Xl(:)
-               sF(nX+1:nX+nG,Ac) = sF(nX+1:nX+nG,Ac) + Xgl(:)
-               IF (cem%cpld) sY(Ac) = sY(Ac) + yl
-               DEALLOCATE(Xl, Xgl)
-            END DO
+               sF(1:nX,Ac) = sF(1:nX,Ac) + Xl(a,:)
+               sF(nX+1:nX+nG,Ac) = sF(nX+1:nX+nG,Ac) + Xgl(a,:)
+               IF (cem%cpld) sY(Ac) = sY(Ac) + yl(a)
+            ELSE
+               Xion(1:nX,Ac) = Xl(a,:)
+               Xion(nX+1:nX+nG,Ac) = Xgl(a,:)
+               IF (cem%cpld) cem%Ya(Ac) = yl(a)
+            END IF
          END DO
+         DEALLOCATE(Xl, Xgl, yl, I4l)
+      END DO
+      DEALLOCATE(cId)
+
+      IF (ALLOCATED(dmnId)) THEN
          CALL COMMU(sA)
          CALL COMMU(sF)
          IF (cem%cpld) CALL COMMU(sY)
@@ -203,23 +238,6 @@
             END IF
          END DO
          DEALLOCATE(sA, sF, sY)
-      ELSE
-         DO Ac=1, tnNo
-            IF (.NOT.ISDOMAIN(iEq, Ac, phys_CEP)) CYCLE
-            nX = eq(iEq)%dmn(1)%cep%nX
-            nG = eq(iEq)%dmn(1)%cep%nG
-            ALLOCATE(Xl(nX), Xgl(nG))
-            Xl  = Xion(1:nX,Ac)
-            Xgl = Xion(nX+1:nX+nG,Ac)
-            yl = 0._RKIND
-            IF (cem%cpld) yl = cem%Ya(Ac)
-            CALL CEPINTEGL(eq(iEq)%dmn(1)%cep, nX, nG, Xl, Xgl,
-     2         time-dt, yl, I4f(Ac))
-            Xion(1:nX,Ac) = Xl(:)
-            Xion(nX+1:nX+nG,Ac) = Xgl(:)
-            IF (cem%cpld) cem%Ya(Ac) = yl
-            DEALLOCATE(Xl, Xgl)
-         END DO
       END IF
 
       DO Ac=1, tnNo
@@ -231,32 +249,72 @@
       RETURN
       END SUBROUTINE CEPINTEG
 !-----------------------------------------------------------------------
-!     Integrate local electrophysiology variables from t1 to t1+dt. Also
-!     integrate excitation-activation variables form coupled electro-
-!     mechanics. The equations are integrated at domain nodes.
-      SUBROUTINE CEPINTEGL(cep, nX, nG, X, Xg, t1, yl, I4f)
+!     Integrate local electrophysiology variables from t1 to t1+dt for
+!     nC cells of a domain, stored in structure-of-arrays layout, i.e.
+!     X(nC,nX) and Xg(nC,nG). Also integrate excitation-activation
+!     variables form coupled electromechanics. The cells are split in
+!     blocks that are integrated independently.
+      SUBROUTINE CEPINTEGV(cep, nC, nX, nG, X, Xg, t1, yl, I4f)
       USE CEPMOD
-      USE UTILMOD, ONLY : eps
-      USE COMMOD, ONLY : dt
       IMPLICIT NONE
       TYPE(cepModelType), INTENT(IN) :: cep
-      INTEGER(KIND=IKIND), INTENT(IN) :: nX, nG
-      REAL(KIND=RKIND), INTENT(IN) :: t1, I4f
-      REAL(KIND=RKIND), INTENT(INOUT) :: X(nX), Xg(nG), yl
+      INTEGER(KIND=IKIND), INTENT(IN) :: nC, nX, nG
+      REAL(KIND=RKIND), INTENT(IN) :: t1, I4f(nC)
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nC,nX), Xg(nC,nG), yl(nC)
 
-      INTEGER(KIND=IKIND) i, icl, nt
-      REAL(KIND=RKIND) :: t, Ts, Te, Istim, Ksac, epsX
+!     Number of cells in a block
+      INTEGER(KIND=IKIND), PARAMETER :: nBlk = 64
 
-      INTEGER(KIND=IKIND), ALLOCATABLE :: IPAR(:)
-      REAL(KIND=RKIND), ALLOCATABLE :: RPAR(:)
+      INTEGER(KIND=IKIND) ib, ie, ic
+      REAL(KIND=RKIND) Ksac(nC)
 
 !     Feedback coefficient for stretch-activated-currents
-      IF (I4f .GT. 1._RKIND) THEN
-         Ksac = cep%Ksac * (SQRT(I4f) - 1._RKIND)
-      ELSE
-         Ksac = 0._RKIND
+      DO ic=1, nC
+         IF (I4f(ic) .GT. 1._RKIND) THEN
+            Ksac(ic) = cep%Ksac * (SQRT(I4f(ic)) - 1._RKIND)
+         ELSE
+            Ksac(ic) = 0._RKIND
+         END IF
+      END DO
+
+!$OMP PARALLEL DO PRIVATE(ib, ie) SCHEDULE(DYNAMIC)
+      DO ib=1, nC, nBlk
+         ie = MIN(ib+nBlk-1, nC)
+         IF (cep%odes%adapt) THEN
+            CALL CEPINTEGA(cep, ie-ib+1, nX, nG, X(ib:ie,:),
+     2         Xg(ib:ie,:), t1, yl(ib:ie), I4f(ib:ie), Ksac(ib:ie))
+         ELSE
+            CALL CEPINTEGB(cep, ie-ib+1, nX, nG, X(ib:ie,:),
+     2         Xg(ib:ie,:), t1, yl(ib:ie), I4f(ib:ie), Ksac(ib:ie))
+         END IF
+      END DO
+!$OMP END PARALLEL DO
+
+      IF (ANY(ISNAN(X(:,1))) .OR. ANY(ISNAN(yl))) THEN
+         WRITE(*,'(A)') " NaN occurence. Aborted!"
+         CALL STOPSIM()
       END IF
 
+      RETURN
+      END SUBROUTINE CEPINTEGV
+!-----------------------------------------------------------------------
+!     Integrate a block of nB cells from t1 to t1+dt. Explicit schemes
+!     advance the whole block at once, while Crank-Nicholson solves the
+!     nonlinear system of each cell separately.
+      SUBROUTINE CEPINTEGB(cep, nB, nX, nG, X, Xg, t1, yl, I4f, Ksac)
+      USE CEPMOD
+      USE UTILMOD, ONLY : eps
+      USE COMMOD, ONLY : dt
+      IMPLICIT NONE
+      TYPE(cepModelType), INTENT(IN) :: cep
+      INTEGER(KIND=IKIND), INTENT(IN) :: nB, nX, nG
+      REAL(KIND=RKIND), INTENT(IN) :: t1, I4f(nB), Ksac(nB)
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX), Xg(nB,nG), yl(nB)
+
+      INTEGER(KIND=IKIND) i, ic, icl, nt, IPAR(2)
+      REAL(KIND=RKIND) :: t, Ts, Te, Istim, epsX, RPAR(18), Xl(nX),
+     2   Xgl(nG), hc(nB)
+
 !     Total time steps
       nt = NINT(dt/cep%dt, KIND=IKIND)
 
@@ -265,252 +323,245 @@
       Ts  = cep%Istim%Ts + REAL(icl, KIND=RKIND)*cep%Istim%CL
       Te  = Ts + cep%Istim%Td
 
-      SELECT CASE (cep%cepType)
-      CASE (cepModel_AP)
-         ALLOCATE(IPAR(2), RPAR(2))
-         IPAR(1) = cep%odes%maxItr
-         IPAR(2) = 0
-         RPAR(:) = 0._RKIND
-         RPAR(1) = cep%odes%absTol
-         RPAR(2) = cep%odes%relTol
-
-         SELECT CASE (cep%odes%tIntType)
-         CASE (tIntType_FE)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL AP_INTEGFE(nX, X, t, cep%dt, Istim, Ksac)
-
-!              Electromechanics excitation-activation
-               IF (cem%aStress) THEN
-                  CALL AP_ACTVSTRS(X(1), cep%dt, yl, epsX)
-               END IF
-            END DO
+!     Parameters for Crank-Nicholson method
+      IPAR(1) = cep%odes%maxItr
+      IPAR(2) = 0
+      RPAR(:) = 0._RKIND
+      RPAR(1) = cep%odes%absTol
+      RPAR(2) = cep%odes%relTol
+
+      DO i=1, nt
+         t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
+         IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
+            Istim = cep%Istim%A
+         ELSE
+            Istim = 0._RKIND
+         END IF
 
-         CASE (tIntType_RK4)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL AP_INTEGRK(nX, X, t, cep%dt, Istim, Ksac)
-
-!              Electromechanics excitation-activation
-               IF (cem%aStress) THEN
-                  CALL AP_ACTVSTRS(X(1), cep%dt, yl, epsX)
-               END IF
-            END DO
+         SELECT CASE (cep%cepType)
+         CASE (cepModel_AP)
+            SELECT CASE (cep%odes%tIntType)
+            CASE (tIntType_FE)
+               CALL AP_INTEGFEV(nB, nX, X, cep%dt, Istim, Ksac)
+
+            CASE (tIntType_RK4)
+               CALL AP_INTEGRKV(nB, nX, X, cep%dt, Istim, Ksac)
+
+            CASE (tIntType_CN2)
+               DO ic=1, nB
+                  Xl = X(ic,:)
+                  CALL AP_INTEGCN2(nX, Xl, t, cep%dt, Istim, Ksac(ic),
+     2               IPAR, RPAR)
+                  X(ic,:) = Xl
+               END DO
 
-         CASE (tIntType_CN2)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL AP_INTEGCN2(nX, X, t, cep%dt, Istim, Ksac, IPAR,
-     2            RPAR)
-
-!              Electromechanics excitation-activation
-               IF (cem%aStress) THEN
-                  CALL AP_ACTVSTRS(X(1), cep%dt, yl, epsX)
-               END IF
-            END DO
-         END SELECT
+            CASE (tIntType_RL)
+               hc = cep%dt
+               CALL AP_INTEGRLV(nB, nX, X, hc, cep%dt, cep%odes%tolV,
+     2            Istim, Ksac)
+            END SELECT
 
-      CASE (cepModel_BO)
-         ALLOCATE(IPAR(2), RPAR(5))
-         IPAR(1) = cep%odes%maxItr
-         IPAR(2) = 0
-         RPAR(:) = 0._RKIND
-         RPAR(1) = cep%odes%absTol
-         RPAR(2) = cep%odes%relTol
-
-         SELECT CASE (cep%odes%tIntType)
-         CASE (tIntType_FE)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL BO_INTEGFE(cep%imyo, nX, X, t, cep%dt, Istim, Ksac,
-     2            RPAR)
-
-!              Electromechanics excitation-activation
-               IF (cem%aStress) THEN
-                  CALL BO_ACTVSTRS(X(1), cep%dt, yl, epsX)
-               ELSE IF (cem%aStrain) THEN
-                  CALL BO_ACTVSTRN(X(4), I4f, cep%dt, yl)
-               END IF
-            END DO
+!           Electromechanics excitation-activation
+            IF (cem%aStress) THEN
+               DO ic=1, nB
+                  CALL AP_ACTVSTRS(X(ic,1), cep%dt, yl(ic), epsX)
+               END DO
+            END IF
 
-         CASE (tIntType_RK4)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL BO_INTEGRK(cep%imyo, nX, X, t, cep%dt, Istim, Ksac,
-     2            RPAR)
-
-!              Electromechanics excitation-activation
-               IF (cem%aStress) THEN
-                  CALL BO_ACTVSTRS(X(1), cep%dt, yl, epsX)
-               ELSE IF (cem%aStrain) THEN
-                  CALL BO_ACTVSTRN(X(4), I4f, cep%dt, yl)
-               END IF
-            END DO
+         CASE (cepModel_BO)
+            SELECT CASE (cep%odes%tIntType)
+            CASE (tIntType_FE)
+               CALL BO_INTEGFEV(cep%imyo, nB, nX, X, cep%dt, Istim,
+     2            Ksac)
+
+            CASE (tIntType_RK4)
+               CALL BO_INTEGRKV(cep%imyo, nB, nX, X, cep%dt, Istim,
+     2            Ksac)
+
+            CASE (tIntType_CN2)
+               DO ic=1, nB
+                  Xl = X(ic,:)
+                  CALL BO_INTEGCN2(cep%imyo, nX, Xl, t, cep%dt, Istim,
+     2               Ksac(ic), IPAR, RPAR)
+                  X(ic,:) = Xl
+               END DO
 
-         CASE (tIntType_CN2)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL BO_INTEGCN2(cep%imyo, nX, X, t, cep%dt, Istim, Ksac,
-     2            IPAR, RPAR)
-
-!              Electromechanics excitation-activation
-               IF (cem%aStress) THEN
-                  CALL BO_ACTVSTRS(X(1), cep%dt, yl, epsX)
-               ELSE IF (cem%aStrain) THEN
-                  CALL BO_ACTVSTRN(X(4), I4f, cep%dt, yl)
-               END IF
-            END DO
-         END SELECT
+            CASE (tIntType_RL)
+               hc = cep%dt
+               CALL BO_INTEGRLV(cep%imyo, nB, nX, X, hc, cep%dt,
+     2            cep%odes%tolV, Istim, Ksac)
+            END SELECT
 
-      CASE (cepModel_FN)
-         ALLOCATE(IPAR(2), RPAR(2))
-         IPAR(1) = cep%odes%maxItr
-         IPAR(2) = 0
-         RPAR(:) = 0._RKIND
-         RPAR(1) = cep%odes%absTol
-         RPAR(2) = cep%odes%relTol
-
-         SELECT CASE (cep%odes%tIntType)
-         CASE (tIntType_FE)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL FN_INTEGFE(nX, X, t, cep%dt, Istim)
-            END DO
+!           Electromechanics excitation-activation
+            IF (cem%aStress) THEN
+               DO ic=1, nB
+                  CALL BO_ACTVSTRS(X(ic,1), cep%dt, yl(ic), epsX)
+               END DO
+            ELSE IF (cem%aStrain) THEN
+               DO ic=1, nB
+                  CALL BO_ACTVSTRN(X(ic,4), I4f(ic), cep%dt, yl(ic))
+               END DO
+            END IF
 
-         CASE (tIntType_RK4)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL FN_INTEGRK(nX, X, t, cep%dt, Istim)
-            END DO
+         CASE (cepModel_FN)
+            SELECT CASE (cep%odes%tIntType)
+            CASE (tIntType_FE)
+               CALL FN_INTEGFEV(nB, nX, X, cep%dt, Istim)
 
-         CASE (tIntType_CN2)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL FN_INTEGCN2(nX, X, t, cep%dt, Istim, IPAR, RPAR)
-            END DO
-         END SELECT
+            CASE (tIntType_RK4)
+               CALL FN_INTEGRKV(nB, nX, X, cep%dt, Istim)
 
-      CASE (cepModel_TTP)
-         ALLOCATE(IPAR(2), RPAR(18))
-         IPAR(1) = cep%odes%maxItr
-         IPAR(2) = 0
-         RPAR(:) = 0._RKIND
-         RPAR(1) = cep%odes%absTol
-         RPAR(2) = cep%odes%relTol
-
-         SELECT CASE (cep%odes%tIntType)
-         CASE (tIntType_FE)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL TTP_INTEGFE(cep%imyo, nX, nG, X, Xg, t, cep%dt,
-     2            Istim, Ksac, RPAR)
-
-!              Electromechanics excitation-activation
-               IF (cem%aStress) THEN
-                  CALL TTP_ACTVSTRS(X(4), cep%dt, yl, epsX)
-               ELSE IF (cem%aStrain) THEN
-                  CALL TTP_ACTVSTRN(X(4), I4f, cep%dt, yl)
-               END IF
-            END DO
+            CASE (tIntType_CN2)
+               DO ic=1, nB
+                  Xl = X(ic,:)
+                  CALL FN_INTEGCN2(nX, Xl, t, cep%dt, Istim, IPAR, RPAR)
+                  X(ic,:) = Xl
+               END DO
 
-         CASE (tIntType_RK4)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL TTP_INTEGRK(cep%imyo, nX, nG, X, Xg, t, cep%dt,
-     2            Istim, Ksac, RPAR)
-
-!              Electromechanics excitation-activation
-               IF (cem%aStress) THEN
-                  CALL TTP_ACTVSTRS(X(4), cep%dt, yl, epsX)
-               ELSE IF (cem%aStrain) THEN
-                  CALL TTP_ACTVSTRN(X(4), I4f, cep%dt, yl)
-               END IF
-            END DO
+            CASE (tIntType_RL)
+               hc = cep%dt
+               CALL FN_INTEGRLV(nB, nX, X, hc, cep%dt, cep%odes%tolV,
+     2            Istim)
+            END SELECT
+
+         CASE (cepModel_TTP)
+            SELECT CASE (cep%odes%tIntType)
+            CASE (tIntType_FE)
+               CALL TTP_INTEGFEV(cep%imyo, nB, nX, nG, X, Xg, cep%dt,
+     2            Istim, Ksac)
+
+            CASE (tIntType_RK4)
+               CALL TTP_INTEGRKV(cep%imyo, nB, nX, nG, X, Xg, cep%dt,
+     2            Istim, Ksac)
+
+            CASE (tIntType_CN2)
+               DO ic=1, nB
+                  Xl  = X(ic,:)
+                  Xgl = Xg(ic,:)
+                  CALL TTP_INTEGCN2(cep%imyo, nX, nG, Xl, Xgl, t,
+     2               cep%dt, Istim, Ksac(ic), IPAR, RPAR)
+                  X(ic,:)  = Xl
+                  Xg(ic,:) = Xgl
+               END DO
+
+            CASE (tIntType_RL)
+               hc = cep%dt
+               CALL TTP_INTEGRLV(cep%imyo, nB, nX, nG, X, Xg, hc,
+     2            cep%dt, cep%odes%tolV, Istim, Ksac)
+            END SELECT
+
+!           Electromechanics excitation-activation
+            IF (cem%aStress) THEN
+               DO ic=1, nB
+                  CALL TTP_ACTVSTRS(X(ic,4), cep%dt, yl(ic), epsX)
+               END DO
+            ELSE IF (cem%aStrain) THEN
+               DO ic=1, nB
+                  CALL TTP_ACTVSTRN(X(ic,4), I4f(ic), cep%dt, yl(ic))
+               END DO
+            END IF
 
-         CASE (tIntType_CN2)
-            DO i=1, nt
-               t = t1 + REAL(i-1, KIND=RKIND) * cep%dt
-               IF (t.GE.Ts-eps .AND. t.LE.Te+eps) THEN
-                  Istim = cep%Istim%A
-               ELSE
-                  Istim = 0._RKIND
-               END IF
-               CALL TTP_INTEGCN2(cep%imyo, nX, nG, X, Xg, t, cep%dt,
-     2            Istim, Ksac, IPAR, RPAR)
-
-!              Electromechanics excitation-activation
-               IF (cem%aStress) THEN
-                  CALL TTP_ACTVSTRS(X(4), cep%dt, yl, epsX)
-               ELSE IF (cem%aStrain) THEN
-                  CALL TTP_ACTVSTRN(X(4), I4f, cep%dt, yl)
-               END IF
-            END DO
          END SELECT
+      END DO
 
-      END SELECT
+      RETURN
+      END SUBROUTINE CEPINTEGB
+!-----------------------------------------------------------------------
+!     Integrate a block of nB cells from t1 to t1+dt using Rush-Larsen
+!     method with adaptive substeps. Each cell selects its own step size
+!     between cep%dt and cep%odes%dtMax based on the rate of change of
+!     its potential, so that cells at rest take large steps. The cells
+!     are synchronized at the start and end of the external stimulus.
+      SUBROUTINE CEPINTEGA(cep, nB, nX, nG, X, Xg, t1, yl, I4f, Ksac)
+      USE CEPMOD
+      USE UTILMOD, ONLY : eps
+      USE COMMOD, ONLY : dt
+      IMPLICIT NONE
+      TYPE(cepModelType), INTENT(IN) :: cep
+      INTEGER(KIND=IKIND), INTENT(IN) :: nB, nX, nG
+      REAL(KIND=RKIND), INTENT(IN) :: t1, I4f(nB), Ksac(nB)
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX), Xg(nB,nG), yl(nB)
 
-      IF (ISNAN(X(1)) .OR. ISNAN(yl)) THEN
-         WRITE(*,'(A)') " NaN occurence. Aborted!"
-         CALL STOPSIM()
-      END IF
+      INTEGER(KIND=IKIND) ic, icl
+      REAL(KIND=RKIND) :: t, t2, tn, Ts, Te, Istim, epsX, tc(nB), hc(nB)
+
+      t2 = t1 + dt
 
-      DEALLOCATE(IPAR, RPAR)
+!     External stimulus duration
+      icl = MAX( FLOOR(t1/cep%Istim%CL, KIND=IKIND), 0)
+      Ts  = cep%Istim%Ts + REAL(icl, KIND=RKIND)*cep%Istim%CL
+      Te  = Ts + cep%Istim%Td
+
+      t = t1
+      DO WHILE (t .LT. t2-eps)
+!        Next synchronization point
+         tn = t2
+         IF (Ts.GT.t+eps .AND. Ts.LT.tn) tn = Ts
+         IF (Te.GT.t+eps .AND. Te.LT.tn) tn = Te
+         IF (t.GE.Ts-eps .AND. t.LT.Te-eps) THEN
+            Istim = cep%Istim%A
+         ELSE
+            Istim = 0._RKIND
+         END IF
+
+!        Advance all cells to tn. Cells that have reached tn get a zero
+!        step size and are left untouched by the kernels.
+         tc = t
+         DO
+            DO ic=1, nB
+               hc(ic) = MIN(tn-tc(ic), cep%odes%dtMax)
+               IF (hc(ic) .LE. eps) hc(ic) = 0._RKIND
+            END DO
+            IF (ALL(hc .EQ. 0._RKIND)) EXIT
+
+            SELECT CASE (cep%cepType)
+            CASE (cepModel_AP)
+               CALL AP_INTEGRLV(nB, nX, X, hc, cep%dt, cep%odes%tolV,
+     2            Istim, Ksac)
+
+            CASE (cepModel_BO)
+               CALL BO_INTEGRLV(cep%imyo, nB, nX, X, hc, cep%dt,
+     2            cep%odes%tolV, Istim, Ksac)
+
+            CASE (cepModel_FN)
+               CALL FN_INTEGRLV(nB, nX, X, hc, cep%dt, cep%odes%tolV,
+     2            Istim)
+
+            CASE (cepModel_TTP)
+               CALL TTP_INTEGRLV(cep%imyo, nB, nX, nG, X, Xg, hc,
+     2            cep%dt, cep%odes%tolV, Istim, Ksac)
+            END SELECT
+
+!           Electromechanics excitation-activation
+            DO ic=1, nB
+               IF (hc(ic) .EQ. 0._RKIND) CYCLE
+               SELECT CASE (cep%cepType)
+               CASE (cepModel_AP)
+                  IF (cem%aStress) CALL AP_ACTVSTRS(X(ic,1), hc(ic),
+     2               yl(ic), epsX)
+
+               CASE (cepModel_BO)
+                  IF (cem%aStress) THEN
+                     CALL BO_ACTVSTRS(X(ic,1), hc(ic), yl(ic), epsX)
+                  ELSE IF (cem%aStrain) THEN
+                     CALL BO_ACTVSTRN(X(ic,4), I4f(ic), hc(ic), yl(ic))
+                  END IF
+
+               CASE (cepModel_TTP)
+                  IF (cem%aStress) THEN
+                     CALL TTP_ACTVSTRS(X(ic,4), hc(ic), yl(ic), epsX)
+                  ELSE IF (cem%aStrain) THEN
+                     CALL TTP_ACTVSTRN(X(ic,4), I4f(ic), hc(ic),
+     2                  yl(ic))
+                  END IF
+               END SELECT
+            END DO
+
+            tc = tc + hc
+         END DO
+         t = tn
+      END DO
 
       RETURN
-      END SUBROUTINE CEPINTEGL
+      END SUBROUTINE CEPINTEGA
 !####################################################################
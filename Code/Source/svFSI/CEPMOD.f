@@ -51,9 +51,9 @@
      2   cepModel_BO = 102, cepModel_FN = 103, cepModel_TTP = 104
 
 !     Time integration scheme: Forward-Euler, Runge-Kutta 4th order,
-!     Crank-Nicholson
+!     Crank-Nicholson, Rush-Larsen
       INTEGER, PARAMETER :: tIntType_NA  = 200, tIntType_FE = 201,
-     2   tIntType_RK4 = 202, tIntType_CN2 = 203
+     2   tIntType_RK4 = 202, tIntType_CN2 = 203, tIntType_RL = 204
 
 !     Time integration scheme and related parameters
       TYPE odeType
@@ -65,6 +65,13 @@
          REAL(KIND=RKIND) :: absTol = 1.E-8_RKIND
 !        Relative tolerance
          REAL(KIND=RKIND) :: relTol = 1.E-4_RKIND
+!        Whether cells take adaptive substeps (Rush-Larsen only)
+         LOGICAL :: adapt = .FALSE.
+!        Max. substep size for adaptive time stepping
+         REAL(KIND=RKIND) :: dtMax = 0._RKIND
+!        Max. change in transmembrane potential per adaptive substep,
+!        relative to the action potential amplitude
+         REAL(KIND=RKIND) :: tolV = 1.E-2_RKIND
       END TYPE odeType
 
 !     External stimulus type
@@ -84,71 +84,109 @@
       RETURN
       END SUBROUTINE AP_INITV
 !-----------------------------------------------------------------------
-!     Time integration performed using Forward Euler method
-      SUBROUTINE AP_INTEGFE(nX, X, Ts, Ti, Istim, Ksac)
+!     Time integration of a block of nB cells stored in structure-of-
+!     arrays layout, X(nB,nX), using Forward Euler method
+      SUBROUTINE AP_INTEGFEV(nB, nX, X, Ti, Istim, Ksac)
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: nX
-      REAL(KIND=RKIND), INTENT(INOUT) :: X(nX)
-      REAL(KIND=RKIND), INTENT(IN) :: Ts, Ti, Istim, Ksac
+      INTEGER(KIND=IKIND), INTENT(IN) :: nB, nX
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX)
+      REAL(KIND=RKIND), INTENT(IN) :: Ti, Istim, Ksac(nB)
 
       INCLUDE "PARAMS_AP.f"
 
-      REAL(KIND=RKIND) :: t, dt, f(nX), fext, Isac
+      REAL(KIND=RKIND) :: dt, f(nB,nX), fext(nB)
 
-      t    = Ts / Tscale
-      dt   = Ti / Tscale
-      Isac = Ksac * (Vrest - X(1))
-      fext = (Istim + Isac) * Tscale / Vscale
+      dt     = Ti / Tscale
+      fext   = (Istim + Ksac*(Vrest - X(:,1))) * Tscale / Vscale
+      X(:,1) = (X(:,1) - Voffset)/Vscale
 
-      X(1) = (X(1) - Voffset)/Vscale
-      CALL AP_GETF(nX, X, f, fext)
+      CALL AP_GETFV(nB, nX, X, f, fext)
       X = X + dt*f
-      X(1) = X(1)*Vscale + Voffset
+
+      X(:,1) = X(:,1)*Vscale + Voffset
 
       RETURN
-      END SUBROUTINE AP_INTEGFE
+      END SUBROUTINE AP_INTEGFEV
 !-----------------------------------------------------------------------
-!     Time integration performed using 4th order Runge-Kutta method
-      SUBROUTINE AP_INTEGRK(nX, X, Ts, Ti, Istim, Ksac)
+!     Time integration of a block of nB cells stored in structure-of-
+!     arrays layout using 4th order Runge-Kutta method
+      SUBROUTINE AP_INTEGRKV(nB, nX, X, Ti, Istim, Ksac)
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: nX
-      REAL(KIND=RKIND), INTENT(INOUT) :: X(nX)
-      REAL(KIND=RKIND), INTENT(IN) :: Ts, Ti, Istim, Ksac
+      INTEGER(KIND=IKIND), INTENT(IN) :: nB, nX
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX)
+      REAL(KIND=RKIND), INTENT(IN) :: Ti, Istim, Ksac(nB)
 
       INCLUDE "PARAMS_AP.f"
 
-      REAL(KIND=RKIND) :: t, dt, dt6, fext, Isac, Xrk(nX), frk(nX,4)
-
-      t    = Ts / Tscale
-      dt   = Ti / Tscale
-      dt6  = dt / 6._RKIND
+      REAL(KIND=RKIND) :: dt, dt6, fext(nB), Xrk(nB,nX), frk(nB,nX,4)
 
-      Isac = Ksac * (Vrest - X(1))
-      fext = (Istim + Isac) * Tscale / Vscale
-      X(1) = (X(1) - Voffset)/Vscale
+      dt     = Ti / Tscale
+      dt6    = dt / 6._RKIND
+      fext   = (Istim + Ksac*(Vrest - X(:,1))) * Tscale / Vscale
+      X(:,1) = (X(:,1) - Voffset)/Vscale
 
 !     RK4: 1st pass
-      Xrk  = X
-      CALL AP_GETF(nX, Xrk, frk(:,1), fext)
+      CALL AP_GETFV(nB, nX, X, frk(:,:,1), fext)
 
 !     RK4: 2nd pass
-      Xrk  = X + 0.5_RKIND*dt*frk(:,1)
-      CALL AP_GETF(nX, Xrk, frk(:,2), fext)
+      Xrk  = X + 0.5_RKIND*dt*frk(:,:,1)
+      CALL AP_GETFV(nB, nX, Xrk, frk(:,:,2), fext)
 
 !     RK4: 3rd pass
-      Xrk  = X + 0.5_RKIND*dt*frk(:,2)
-      CALL AP_GETF(nX, Xrk, frk(:,3), fext)
+      Xrk  = X + 0.5_RKIND*dt*frk(:,:,2)
+      CALL AP_GETFV(nB, nX, Xrk, frk(:,:,3), fext)
 
 !     RK4: 4th pass
-      Xrk  = X + dt*frk(:,3)
-      CALL AP_GETF(nX, Xrk, frk(:,4), fext)
+      Xrk  = X + dt*frk(:,:,3)
+      CALL AP_GETFV(nB, nX, Xrk, frk(:,:,4), fext)
+
+      X = X + dt6*(frk(:,:,1) + 2._RKIND*(frk(:,:,2) + frk(:,:,3)) +
+     2   frk(:,:,4))
+
+      X(:,1) = X(:,1)*Vscale + Voffset
+
+      RETURN
+      END SUBROUTINE AP_INTEGRKV
+!-----------------------------------------------------------------------
+!     Time integration of a block of nB cells using Rush-Larsen method.
+!     The recovery variable is advanced exponentially with its rate
+!     frozen over the step while the potential uses Forward Euler. On
+!     input, Ti(ic) is the max. step size of each cell. The step is
+!     chosen so that the scaled potential changes by at most tolV, but
+!     it is clamped to [Tmin, Ti(ic)]: Tmin is a hard floor that wins
+!     over tolV, so the upstroke never takes steps smaller than Tmin.
+!     The step taken is returned in Ti(ic).
+      SUBROUTINE AP_INTEGRLV(nB, nX, X, Ti, Tmin, tolV, Istim, Ksac)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: nB, nX
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX), Ti(nB)
+      REAL(KIND=RKIND), INTENT(IN) :: Tmin, tolV, Istim, Ksac(nB)
+
+      INCLUDE "PARAMS_AP.f"
+
+      INTEGER(KIND=IKIND) :: ic
+      REAL(KIND=RKIND) :: dt, u, r, f1, k2, rinf, fext
+
+      DO ic=1, nB
+         IF (Ti(ic) .LE. 0._RKIND) CYCLE
+         fext = (Istim + Ksac(ic)*(Vrest - X(ic,1))) * Tscale / Vscale
+         u    = (X(ic,1) - Voffset)/Vscale
+         r    = X(ic,2)
+
+         f1   = u*(c*(u-alpha)*(1._RKIND-u) - r) + fext
+         k2   = a + mu1*r/(mu2 + u)
+         rinf = -c*u*(u - b - 1._RKIND)
 
-      X = X + dt6*(frk(:,1) + 2._RKIND*(frk(:,2) + frk(:,3)) + frk(:,4))
+         dt   = tolV*Tscale/MAX(ABS(f1), EPSILON(f1))
+         Ti(ic) = MIN(Ti(ic), MAX(Tmin, dt))
+         dt   = Ti(ic)/Tscale
 
-      X(1) = X(1)*Vscale + Voffset
+         X(ic,1) = (u + dt*f1)*Vscale + Voffset
+         X(ic,2) = rinf + (r - rinf)*EXP(-k2*dt)
+      END DO
 
       RETURN
-      END SUBROUTINE AP_INTEGRK
+      END SUBROUTINE AP_INTEGRLV
 !-----------------------------------------------------------------------
 !     Time integration performed using Crank-Nicholson method
       SUBROUTINE AP_INTEGCN2(nX, Xn, Ts, Ti, Istim, Ksac, IPAR, RPAR)
@@ -221,21 +259,45 @@
       RETURN
       END SUBROUTINE AP_INTEGCN2
 !-----------------------------------------------------------------------
+!     Single cell version of AP_GETFV, used by the implicit integrator
       SUBROUTINE AP_GETF(n, X, f, fext)
       IMPLICIT NONE
       INTEGER(KIND=IKIND), INTENT(IN) :: n
       REAL(KIND=RKIND), INTENT(IN) :: X(n), fext
       REAL(KIND=RKIND), INTENT(OUT) :: f(n)
 
+      REAL(KIND=RKIND) :: Xv(1,n), fv(1,n), fe(1)
+
+      Xv(1,:) = X(:)
+      fe(1)   = fext
+      CALL AP_GETFV(1, n, Xv, fv, fe)
+      f(:) = fv(1,:)
+
+      RETURN
+      END SUBROUTINE AP_GETF
+!-----------------------------------------------------------------------
+!     Compute time derivatives of state variables for a block of nB
+!     cells
+      SUBROUTINE AP_GETFV(nB, n, X, f, fext)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: nB, n
+      REAL(KIND=RKIND), INTENT(IN) :: X(nB,n), fext(nB)
+      REAL(KIND=RKIND), INTENT(OUT) :: f(nB,n)
+
       INCLUDE "PARAMS_AP.f"
 
-      f(1) = X(1)*(c*(X(1)-alpha)*(1._RKIND-X(1)) - X(2)) + fext
+      INTEGER(KIND=IKIND) :: ic
 
-      f(2) = (a + mu1*X(2)/(mu2 + X(1))) *
-     2       (-X(2) - c*X(1)*(X(1) - b - 1._RKIND))
+      DO ic=1, nB
+         f(ic,1) = X(ic,1)*(c*(X(ic,1)-alpha)*(1._RKIND-X(ic,1)) -
+     2      X(ic,2)) + fext(ic)
+
+         f(ic,2) = (a + mu1*X(ic,2)/(mu2 + X(ic,1))) *
+     2      (-X(ic,2) - c*X(ic,1)*(X(ic,1) - b - 1._RKIND))
+      END DO
 
       RETURN
-      END SUBROUTINE AP_GETF
+      END SUBROUTINE AP_GETFV
 !-----------------------------------------------------------------------
       SUBROUTINE AP_GETJ(n, X, JAC, Ksac)
       IMPLICIT NONE
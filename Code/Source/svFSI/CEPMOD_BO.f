@@ -59,74 +59,138 @@
       RETURN
       END SUBROUTINE BO_INIT
 !--------------------------------------------------------------------
-!     Time integration performed using Forward Euler method
-      SUBROUTINE BO_INTEGFE(imyo, nX, X, Ts, Ti, Istim, Ksac, RPAR)
+!     Time integration of a block of nB cells stored in structure-of-
+!     arrays layout, X(nB,nX), using Forward Euler method
+      SUBROUTINE BO_INTEGFEV(imyo, nB, nX, X, Ti, Istim, Ksac)
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: imyo, nX
-      REAL(KIND=RKIND), INTENT(IN) :: Ts, Ti, Istim, Ksac
-      REAL(KIND=RKIND), INTENT(INOUT) :: X(nX), RPAR(5)
+      INTEGER(KIND=IKIND), INTENT(IN) :: imyo, nB, nX
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX)
+      REAL(KIND=RKIND), INTENT(IN) :: Ti, Istim, Ksac(nB)
 
       INCLUDE "PARAMS_BO.f"
 
-      REAL(KIND=RKIND) :: t, dt, f(nX), fext, Isac
-
-      t    = Ts / Tscale
-      dt   = Ti / Tscale
-
-      Isac = Ksac * (Vrest - X(1))
-      fext = (Istim + Isac) * Tscale / Vscale
+      REAL(KIND=RKIND) :: dt, f(nB,nX), fext(nB)
 
-      X(1) = (X(1) - Voffset)/Vscale
+      dt     = Ti / Tscale
+      fext   = (Istim + Ksac*(Vrest - X(:,1))) * Tscale / Vscale
+      X(:,1) = (X(:,1) - Voffset)/Vscale
 
-      CALL BO_GETF(imyo, nX, X, f, fext, RPAR)
-      X(:) = X(:) + dt*f(:)
+      CALL BO_GETFV(imyo, nB, nX, X, f, fext)
+      X = X + dt*f
 
-      X(1) = X(1)*Vscale + Voffset
+      X(:,1) = X(:,1)*Vscale + Voffset
 
       RETURN
-      END SUBROUTINE BO_INTEGFE
+      END SUBROUTINE BO_INTEGFEV
 !--------------------------------------------------------------------
-!     Time integration performed using 4th order Runge-Kutta method
-      SUBROUTINE BO_INTEGRK(imyo, nX, X, Ts, Ti, Istim, Ksac, RPAR)
+!     Time integration of a block of nB cells stored in structure-of-
+!     arrays layout using 4th order Runge-Kutta method
+      SUBROUTINE BO_INTEGRKV(imyo, nB, nX, X, Ti, Istim, Ksac)
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: imyo, nX
-      REAL(KIND=RKIND), INTENT(IN) :: Ts, Ti, Istim, Ksac
-      REAL(KIND=RKIND), INTENT(INOUT) :: X(nX), RPAR(5)
+      INTEGER(KIND=IKIND), INTENT(IN) :: imyo, nB, nX
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX)
+      REAL(KIND=RKIND), INTENT(IN) :: Ti, Istim, Ksac(nB)
 
       INCLUDE "PARAMS_BO.f"
 
-      REAL(KIND=RKIND) :: t, dt, dt6, fext, Isac, Xrk(nX), frk(nX,4)
-
-      t    = Ts / Tscale
-      dt   = Ti / Tscale
-      dt6  = dt/6._RKIND
+      REAL(KIND=RKIND) :: dt, dt6, fext(nB), Xrk(nB,nX), frk(nB,nX,4)
 
-      Isac = Ksac * (Vrest - X(1))
-      fext = (Istim + Isac) * Tscale / Vscale
-      X(1) = (X(1) - Voffset)/Vscale
+      dt     = Ti / Tscale
+      dt6    = dt / 6._RKIND
+      fext   = (Istim + Ksac*(Vrest - X(:,1))) * Tscale / Vscale
+      X(:,1) = (X(:,1) - Voffset)/Vscale
 
 !     RK4: 1st pass
-      Xrk  = X
-      CALL BO_GETF(imyo, nX, Xrk, frk(:,1), fext, RPAR)
+      CALL BO_GETFV(imyo, nB, nX, X, frk(:,:,1), fext)
 
 !     RK4: 2nd pass
-      Xrk  = X + 0.5_RKIND*dt*frk(:,1)
-      CALL BO_GETF(imyo, nX, Xrk, frk(:,2), fext, RPAR)
+      Xrk  = X + 0.5_RKIND*dt*frk(:,:,1)
+      CALL BO_GETFV(imyo, nB, nX, Xrk, frk(:,:,2), fext)
 
 !     RK4: 3rd pass
-      Xrk  = X + 0.5_RKIND*dt*frk(:,2)
-      CALL BO_GETF(imyo, nX, Xrk, frk(:,3), fext, RPAR)
+      Xrk  = X + 0.5_RKIND*dt*frk(:,:,2)
+      CALL BO_GETFV(imyo, nB, nX, Xrk, frk(:,:,3), fext)
 
 !     RK4: 4th pass
-      Xrk  = X + dt*frk(:,3)
-      CALL BO_GETF(imyo, nX, Xrk, frk(:,4), fext, RPAR)
+      Xrk  = X + dt*frk(:,:,3)
+      CALL BO_GETFV(imyo, nB, nX, Xrk, frk(:,:,4), fext)
+
+      X = X + dt6*(frk(:,:,1) + 2._RKIND*(frk(:,:,2) + frk(:,:,3)) +
+     2   frk(:,:,4))
+
+      X(:,1) = X(:,1)*Vscale + Voffset
+
+      RETURN
+      END SUBROUTINE BO_INTEGRKV
+!--------------------------------------------------------------------
+!     Time integration of a block of nB cells using Rush-Larsen method.
+!     The gating variables v, w, s obey linear equations for a given u
+!     and are integrated exactly over the step while the potential uses
+!     Forward Euler. See AP_INTEGRLV for the step size selection.
+      SUBROUTINE BO_INTEGRLV(imyo, nB, nX, X, Ti, Tmin, tolV, Istim,
+     2   Ksac)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: imyo, nB, nX
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX), Ti(nB)
+      REAL(KIND=RKIND), INTENT(IN) :: Tmin, tolV, Istim, Ksac(nB)
 
-      X = X + dt6*(frk(:,1) + 2._RKIND*(frk(:,2) + frk(:,3)) + frk(:,4))
+      INCLUDE "PARAMS_BO.f"
 
-      X(1) = X(1)*Vscale + Voffset
+      INTEGER(KIND=IKIND) :: i, ic
+      REAL(KIND=RKIND) :: dt, u, v, w, s, H_uv, H_uw, H_umv, H_uo,
+     2   taum_v, taum_w, tau_so, tau_s, tau_o, v_inf, w_inf, s_inf,
+     3   I_fi, I_so, I_si, f1, kv, kw, fext
+
+      i = imyo
+      DO ic=1, nB
+         IF (Ti(ic) .LE. 0._RKIND) CYCLE
+         fext = (Istim + Ksac(ic)*(Vrest - X(ic,1))) * Tscale / Vscale
+         u = (X(ic,1) - Voffset)/Vscale
+         v = X(ic,2)
+         w = X(ic,3)
+         s = X(ic,4)
+
+         H_uv  = STEP(u - theta_v(i))
+         H_uw  = STEP(u - theta_w(i))
+         H_umv = STEP(u - thetam_v(i))
+         H_uo  = STEP(u - theta_o(i))
+
+         taum_v = (1._RKIND-H_umv)*taum_v1(i) + H_umv*taum_v2(i)
+         taum_w = taum_w1(i) + 0.5_RKIND*(taum_w2(i)-taum_w1(i))*
+     2      (1._RKIND + TANH(km_w(i)*(u-um_w(i))))
+         tau_so = tau_so1(i) + 0.5_RKIND*(tau_so2(i)-tau_so1(i))*
+     2      (1._RKIND+DTANH(k_so(i)*(u-u_so(i))))
+         tau_s  = (1._RKIND-H_uw)*tau_s1(i) + H_uw*tau_s2(i)
+         tau_o  = (1._RKIND-H_uo)*tau_o1(i) + H_uo*tau_o2(i)
+         v_inf  = (1._RKIND-H_umv)
+         w_inf  = (1._RKIND-H_uo)*(1._RKIND - u/tau_winf(i)) +
+     2      H_uo*ws_inf(i)
+         s_inf  = 0.5_RKIND*(1._RKIND + TANH(k_s(i)*(u-u_s(i))))
+
+         I_fi = -v*H_uv*(u-theta_v(i))*(u_u(i) - u)/tau_fi(i)
+         I_so =  (u-u_o(i))*(1._RKIND-H_uw)/tau_o + H_uw/tau_so
+         I_si = -H_uw*w*s/tau_si(i)
+
+         f1 = -(I_fi + I_so + I_si + fext)
+
+!        Rates and steady states of the gating variables
+         kv    = (1._RKIND-H_uv)/taum_v + H_uv/taup_v(i)
+         v_inf = (1._RKIND-H_uv)*v_inf/taum_v/kv
+         kw    = (1._RKIND-H_uw)/taum_w + H_uw/taup_w(i)
+         w_inf = (1._RKIND-H_uw)*w_inf/taum_w/kw
+
+         dt = tolV*Tscale/MAX(ABS(f1), EPSILON(f1))
+         Ti(ic) = MIN(Ti(ic), MAX(Tmin, dt))
+         dt = Ti(ic)/Tscale
+
+         X(ic,1) = (u + dt*f1)*Vscale + Voffset
+         X(ic,2) = v_inf + (v - v_inf)*EXP(-kv*dt)
+         X(ic,3) = w_inf + (w - w_inf)*EXP(-kw*dt)
+         X(ic,4) = s_inf + (s - s_inf)*EXP(-dt/tau_s)
+      END DO
 
       RETURN
-      END SUBROUTINE BO_INTEGRK
+      END SUBROUTINE BO_INTEGRLV
 !--------------------------------------------------------------------
 !     Time integration performed using Crank-Nicholson method
       SUBROUTINE BO_INTEGCN2(imyo, nX, Xn, Ts, Ti, Istim, Ksac, IPAR,
@@ -201,6 +265,7 @@
       RETURN
       END SUBROUTINE BO_INTEGCN2
 !--------------------------------------------------------------------
+!     Single cell version of BO_GETFV, used by the implicit integrator
       SUBROUTINE BO_GETF(i, n, X, f, fext, RPAR)
       IMPLICIT NONE
       INTEGER(KIND=IKIND), INTENT(IN) :: i, n
@@ -208,54 +273,75 @@
       REAL(KIND=RKIND), INTENT(OUT) :: f(n)
       REAL(KIND=RKIND), INTENT(INOUT) :: RPAR(5)
 
-      INCLUDE "PARAMS_BO.f"
-
-      REAL(KIND=RKIND) :: u, v, w, s, H_uv, H_uw, H_umv, H_uo, taum_v,
-     2   taum_w, tau_so, tau_s, tau_o, v_inf, w_inf, I_fi, I_so, I_si
-
-!     Create local copies of the 4 state variables
-      u = X(1)
-      v = X(2)
-      w = X(3)
-      s = X(4)
-
-!     Define step functions
-      H_uv  = STEP(u - theta_v(i))
-      H_uw  = STEP(u - theta_w(i))
-      H_umv = STEP(u - thetam_v(i))
-      H_uo  = STEP(u - theta_o(i))
-
-!     Define additional constants
-      taum_v = (1._RKIND-H_umv)*taum_v1(i) + H_umv*taum_v2(i)
-      taum_w = taum_w1(i) + 0.5_RKIND*(taum_w2(i)-taum_w1(i))*
-     2   (1._RKIND + TANH(km_w(i)*(u-um_w(i))))
-      tau_so = tau_so1(i) + 0.5_RKIND*(tau_so2(i)-tau_so1(i))*
-     2   (1._RKIND+DTANH(k_so(i)*(u-u_so(i))))
-      tau_s  = (1._RKIND-H_uw)*tau_s1(i) + H_uw*tau_s2(i)
-      tau_o  = (1._RKIND-H_uo)*tau_o1(i) + H_uo*tau_o2(i)
-      v_inf  = (1._RKIND-H_umv)
-      w_inf  = (1._RKIND-H_uo)*(1._RKIND - u/tau_winf(i)) +
-     2   H_uo*ws_inf(i)
-
-!     Compute RHS of state variable equations
-      I_fi = -v*H_uv*(u-theta_v(i))*(u_u(i) - u)/tau_fi(i)
-      I_so =  (u-u_o(i))*(1._RKIND-H_uw)/tau_o + H_uw/tau_so
-      I_si = -H_uw*w*s/tau_si(i)
+      REAL(KIND=RKIND) :: Xv(1,n), fv(1,n), fe(1)
 
-      f(1) = -(I_fi + I_so + I_si + fext)
+      Xv(1,:) = X(:)
+      fe(1)   = fext
+      CALL BO_GETFV(i, 1, n, Xv, fv, fe, RPAR)
+      f(:) = fv(1,:)
 
-      f(2) = (1._RKIND-H_uv)*(v_inf-v)/taum_v - H_uv*v/taup_v(i)
+      RETURN
+      END SUBROUTINE BO_GETF
+!--------------------------------------------------------------------
+!     Compute time derivatives of state variables for a block of nB
+!     cells. If present, RPAR(3:5) returns the currents of the last cell
+      SUBROUTINE BO_GETFV(i, nB, n, X, f, fext, RPAR)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: i, nB, n
+      REAL(KIND=RKIND), INTENT(IN) :: X(nB,n), fext(nB)
+      REAL(KIND=RKIND), INTENT(OUT) :: f(nB,n)
+      REAL(KIND=RKIND), INTENT(INOUT), OPTIONAL :: RPAR(5)
 
-      f(3) = (1._RKIND-H_uw)*(w_inf-w)/taum_w - H_uw*w/taup_w(i)
+      INCLUDE "PARAMS_BO.f"
 
-      f(4) = (0.5_RKIND*(1._RKIND + TANH(k_s(i)*(u-u_s(i))))-s)/tau_s
+      INTEGER(KIND=IKIND) :: ic
+      REAL(KIND=RKIND) :: u, v, w, s, H_uv, H_uw, H_umv, H_uo, taum_v,
+     2   taum_w, tau_so, tau_s, tau_o, v_inf, w_inf, I_fi, I_so, I_si
 
-      RPAR(3) = I_fi
-      RPAR(4) = I_so
-      RPAR(5) = I_si
+      DO ic=1, nB
+         u = X(ic,1)
+         v = X(ic,2)
+         w = X(ic,3)
+         s = X(ic,4)
+
+         H_uv  = STEP(u - theta_v(i))
+         H_uw  = STEP(u - theta_w(i))
+         H_umv = STEP(u - thetam_v(i))
+         H_uo  = STEP(u - theta_o(i))
+
+         taum_v = (1._RKIND-H_umv)*taum_v1(i) + H_umv*taum_v2(i)
+         taum_w = taum_w1(i) + 0.5_RKIND*(taum_w2(i)-taum_w1(i))*
+     2      (1._RKIND + TANH(km_w(i)*(u-um_w(i))))
+         tau_so = tau_so1(i) + 0.5_RKIND*(tau_so2(i)-tau_so1(i))*
+     2      (1._RKIND+DTANH(k_so(i)*(u-u_so(i))))
+         tau_s  = (1._RKIND-H_uw)*tau_s1(i) + H_uw*tau_s2(i)
+         tau_o  = (1._RKIND-H_uo)*tau_o1(i) + H_uo*tau_o2(i)
+         v_inf  = (1._RKIND-H_umv)
+         w_inf  = (1._RKIND-H_uo)*(1._RKIND - u/tau_winf(i)) +
+     2      H_uo*ws_inf(i)
+
+         I_fi = -v*H_uv*(u-theta_v(i))*(u_u(i) - u)/tau_fi(i)
+         I_so =  (u-u_o(i))*(1._RKIND-H_uw)/tau_o + H_uw/tau_so
+         I_si = -H_uw*w*s/tau_si(i)
+
+         f(ic,1) = -(I_fi + I_so + I_si + fext(ic))
+
+         f(ic,2) = (1._RKIND-H_uv)*(v_inf-v)/taum_v - H_uv*v/taup_v(i)
+
+         f(ic,3) = (1._RKIND-H_uw)*(w_inf-w)/taum_w - H_uw*w/taup_w(i)
+
+         f(ic,4) = (0.5_RKIND*(1._RKIND + TANH(k_s(i)*(u-u_s(i)))) - s)
+     2      /tau_s
+
+         IF (PRESENT(RPAR)) THEN
+            RPAR(3) = I_fi
+            RPAR(4) = I_so
+            RPAR(5) = I_si
+         END IF
+      END DO
 
       RETURN
-      END SUBROUTINE BO_GETF
+      END SUBROUTINE BO_GETFV
 !--------------------------------------------------------------------
       SUBROUTINE BO_GETJ(i, n, X, JAC)
       IMPLICIT NONE
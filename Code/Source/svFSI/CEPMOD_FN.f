@@ -81,69 +81,104 @@
       RETURN
       END SUBROUTINE FN_INITV
 !-----------------------------------------------------------------------
-!     Time integration performed using Forward Euler method
-      SUBROUTINE FN_INTEGFE(nX, X, Ts, Ti, Istim)
+!     Time integration of a block of nB cells stored in structure-of-
+!     arrays layout, X(nB,nX), using Forward Euler method
+      SUBROUTINE FN_INTEGFEV(nB, nX, X, Ti, Istim)
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: nX
-      REAL(KIND=RKIND), INTENT(INOUT) :: X(nX)
-      REAL(KIND=RKIND), INTENT(IN) :: Ts, Ti, Istim
+      INTEGER(KIND=IKIND), INTENT(IN) :: nB, nX
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX)
+      REAL(KIND=RKIND), INTENT(IN) :: Ti, Istim
 
       INCLUDE "PARAMS_FN.f"
 
-      REAL(KIND=RKIND) :: t, dt, f(nX), fext
+      REAL(KIND=RKIND) :: dt, f(nB,nX), fext
 
-      t    = Ts / Tscale
-      dt   = Ti / Tscale
-      fext = Istim * Tscale / Vscale
+      dt     = Ti / Tscale
+      fext   = Istim * Tscale / Vscale
+      X(:,1) = (X(:,1) - Voffset)/Vscale
+
+      CALL FN_GETFV(nB, nX, X, f, fext)
+      X = X + dt*f
 
-      X(1) = (X(1) - Voffset)/Vscale
-      CALL FN_GETF(nX, X, f, fext)
-      X(:) = X(:) + dt*f(:)
-      X(1) = X(1)*Vscale + Voffset
+      X(:,1) = X(:,1)*Vscale + Voffset
 
       RETURN
-      END SUBROUTINE FN_INTEGFE
+      END SUBROUTINE FN_INTEGFEV
 !-----------------------------------------------------------------------
-!     Time integration performed using 4th order Runge-Kutta method
-      SUBROUTINE FN_INTEGRK(nX, X, Ts, Ti, Istim)
+!     Time integration of a block of nB cells stored in structure-of-
+!     arrays layout using 4th order Runge-Kutta method
+      SUBROUTINE FN_INTEGRKV(nB, nX, X, Ti, Istim)
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: nX
-      REAL(KIND=RKIND), INTENT(INOUT) :: X(nX)
-      REAL(KIND=RKIND), INTENT(IN) :: Ts, Ti, Istim
+      INTEGER(KIND=IKIND), INTENT(IN) :: nB, nX
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX)
+      REAL(KIND=RKIND), INTENT(IN) :: Ti, Istim
 
       INCLUDE "PARAMS_FN.f"
 
-      REAL(KIND=RKIND) :: t, dt, dt6, fext, Xrk(nX), frk(nX,4)
+      REAL(KIND=RKIND) :: dt, dt6, fext, Xrk(nB,nX), frk(nB,nX,4)
 
-      t    = Ts / Tscale
-      dt   = Ti / Tscale
-      dt6  = dt / 6._RKIND
-
-      fext = Istim * Tscale / Vscale
-      X(1) = (X(1) - Voffset)/Vscale
+      dt     = Ti / Tscale
+      dt6    = dt / 6._RKIND
+      fext   = Istim * Tscale / Vscale
+      X(:,1) = (X(:,1) - Voffset)/Vscale
 
 !     RK4: 1st pass
-      Xrk  = X
-      CALL FN_GETF(nX, Xrk, frk(:,1), fext)
+      CALL FN_GETFV(nB, nX, X, frk(:,:,1), fext)
 
 !     RK4: 2nd pass
-      Xrk  = X + 0.5_RKIND*dt*frk(:,1)
-      CALL FN_GETF(nX, Xrk, frk(:,2), fext)
+      Xrk  = X + 0.5_RKIND*dt*frk(:,:,1)
+      CALL FN_GETFV(nB, nX, Xrk, frk(:,:,2), fext)
 
 !     RK4: 3rd pass
-      Xrk  = X + 0.5_RKIND*dt*frk(:,2)
-      CALL FN_GETF(nX, Xrk, frk(:,3), fext)
+      Xrk  = X + 0.5_RKIND*dt*frk(:,:,2)
+      CALL FN_GETFV(nB, nX, Xrk, frk(:,:,3), fext)
 
 !     RK4: 4th pass
-      Xrk  = X + dt*frk(:,3)
-      CALL FN_GETF(nX, Xrk, frk(:,4), fext)
+      Xrk  = X + dt*frk(:,:,3)
+      CALL FN_GETFV(nB, nX, Xrk, frk(:,:,4), fext)
 
-      X = X + dt6*(frk(:,1) + 2._RKIND*(frk(:,2) + frk(:,3)) + frk(:,4))
+      X = X + dt6*(frk(:,:,1) + 2._RKIND*(frk(:,:,2) + frk(:,:,3)) +
+     2   frk(:,:,4))
 
-      X(1) = X(1)*Vscale + Voffset
+      X(:,1) = X(:,1)*Vscale + Voffset
 
       RETURN
-      END SUBROUTINE FN_INTEGRK
+      END SUBROUTINE FN_INTEGRKV
+!-----------------------------------------------------------------------
+!     Time integration of a block of nB cells using Rush-Larsen method.
+!     The linear recovery equation is integrated exactly over the step
+!     and the potential uses Forward Euler. See AP_INTEGRLV for the
+!     step size selection.
+      SUBROUTINE FN_INTEGRLV(nB, nX, X, Ti, Tmin, tolV, Istim)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: nB, nX
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX), Ti(nB)
+      REAL(KIND=RKIND), INTENT(IN) :: Tmin, tolV, Istim
+
+      INCLUDE "PARAMS_FN.f"
+
+      INTEGER(KIND=IKIND) :: ic
+      REAL(KIND=RKIND) :: dt, u, v, f1, vinf, fext
+
+      fext = Istim * Tscale / Vscale
+      DO ic=1, nB
+         IF (Ti(ic) .LE. 0._RKIND) CYCLE
+         u    = (X(ic,1) - Voffset)/Vscale
+         v    = X(ic,2)
+
+         f1   = c * ( u*(u-alpha)*(1._RKIND-u) - v ) + fext
+         vinf = (u + a)/b
+
+         dt   = tolV*Tscale/MAX(ABS(f1), EPSILON(f1))
+         Ti(ic) = MIN(Ti(ic), MAX(Tmin, dt))
+         dt   = Ti(ic)/Tscale
+
+         X(ic,1) = (u + dt*f1)*Vscale + Voffset
+         X(ic,2) = vinf + (v - vinf)*EXP(-b*dt)
+      END DO
+
+      RETURN
+      END SUBROUTINE FN_INTEGRLV
 !-----------------------------------------------------------------------
 !     Time integration performed using Crank-Nicholson method
       SUBROUTINE FN_INTEGCN2(nX, Xn, Ts, Ti, Istim, IPAR, RPAR)
@@ -215,20 +250,43 @@
       RETURN
       END SUBROUTINE FN_INTEGCN2
 !-----------------------------------------------------------------------
+!     Single cell version of FN_GETFV, used by the implicit integrator
       SUBROUTINE FN_GETF(n, X, f, fext)
       IMPLICIT NONE
       INTEGER(KIND=IKIND), INTENT(IN) :: n
       REAL(KIND=RKIND), INTENT(IN) :: X(n), fext
       REAL(KIND=RKIND), INTENT(OUT) :: f(n)
 
+      REAL(KIND=RKIND) :: Xv(1,n), fv(1,n)
+
+      Xv(1,:) = X(:)
+      CALL FN_GETFV(1, n, Xv, fv, fext)
+      f(:) = fv(1,:)
+
+      RETURN
+      END SUBROUTINE FN_GETF
+!-----------------------------------------------------------------------
+!     Compute time derivatives of state variables for a block of nB
+!     cells
+      SUBROUTINE FN_GETFV(nB, n, X, f, fext)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: nB, n
+      REAL(KIND=RKIND), INTENT(IN) :: X(nB,n), fext
+      REAL(KIND=RKIND), INTENT(OUT) :: f(nB,n)
+
       INCLUDE "PARAMS_FN.f"
 
-      f(1) = c * ( X(1)*(X(1)-alpha)*(1._RKIND-X(1)) - X(2) ) + fext
+      INTEGER(KIND=IKIND) :: ic
+
+      DO ic=1, nB
+         f(ic,1) = c * ( X(ic,1)*(X(ic,1)-alpha)*(1._RKIND-X(ic,1)) -
+     2      X(ic,2) ) + fext
 
-      f(2) = X(1) - b*X(2) + a
+         f(ic,2) = X(ic,1) - b*X(ic,2) + a
+      END DO
 
       RETURN
-      END SUBROUTINE FN_GETF
+      END SUBROUTINE FN_GETFV
 !-----------------------------------------------------------------------
       SUBROUTINE FN_GETJ(n, X, JAC)
       IMPLICIT NONE
@@ -140,398 +140,499 @@
       RETURN
       END SUBROUTINE TTP_INIT
 !-----------------------------------------------------------------------
-!     Time integration performed using Forward Euler method
-      SUBROUTINE TTP_INTEGFE(imyo, nX, nG, X, Xg, Ts, dt, Istim, Ksac,
-     2   RPAR)
+!     Single cell version of TTP_GETFV, used by the implicit integrator
+      SUBROUTINE TTP_GETF(i, nX, nG, X, Xg, dX, I_stim, K_sac, RPAR)
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: imyo, nX, nG
-      REAL(KIND=RKIND), INTENT(INOUT) :: X(nX), Xg(nG), RPAR(18)
-      REAL(KIND=RKIND), INTENT(IN) :: Ts, dt, Istim, Ksac
+      INTEGER(KIND=IKIND), INTENT(IN) :: i, nX, nG
+      REAL(KIND=RKIND), INTENT(IN) :: X(nX), Xg(nG), I_stim, K_sac
+      REAL(KIND=RKIND), INTENT(OUT) :: dX(nX)
+      REAL(KIND=RKIND), INTENT(INOUT) :: RPAR(18)
+
+      REAL(KIND=RKIND) :: Xv(1,nX), Xgv(1,nG), dXv(1,nX), Ks(1)
+
+      Xv(1,:)  = X(:)
+      Xgv(1,:) = Xg(:)
+      Ks(1)    = K_sac
+      CALL TTP_GETFV(i, 1, nX, nG, Xv, Xgv, dXv, I_stim, Ks, RPAR)
+      dX(:) = dXv(1,:)
+
+      RETURN
+      END SUBROUTINE TTP_GETF
+!-----------------------------------------------------------------------
+!     Single cell version of TTP_UPDATEGV, used by the implicit
+!     integrator
+      SUBROUTINE TTP_UPDATEG(i, dt, n, nG, X, Xg)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: i, n, nG
+      REAL(KIND=RKIND), INTENT(IN) :: dt, X(n)
+      REAL(KIND=RKIND), INTENT(INOUT) :: Xg(nG)
+
+      REAL(KIND=RKIND) :: dtv(1), Xv(1,n), Xgv(1,nG)
 
-      REAL(KIND=RKIND) :: f(nX)
+      dtv(1)   = dt
+      Xv(1,:)  = X(:)
+      Xgv(1,:) = Xg(:)
+      CALL TTP_UPDATEGV(i, dtv, 1, n, nG, Xv, Xgv)
+      Xg(:) = Xgv(1,:)
+
+      RETURN
+      END SUBROUTINE TTP_UPDATEG
+!-----------------------------------------------------------------------
+!     Time integration of a block of nB cells stored in structure-of-
+!     arrays layout, X(nB,nX) and Xg(nB,nG), using Forward Euler method
+      SUBROUTINE TTP_INTEGFEV(imyo, nB, nX, nG, X, Xg, dt, Istim, Ksac)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: imyo, nB, nX, nG
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX), Xg(nB,nG)
+      REAL(KIND=RKIND), INTENT(IN) :: dt, Istim, Ksac(nB)
+
+      REAL(KIND=RKIND) :: f(nB,nX), dtv(nB)
 
 !     Get time derivatives (RHS)
-      CALL TTP_GETF(imyo, nX, nG, X, Xg, f, Istim, Ksac, RPAR)
+      CALL TTP_GETFV(imyo, nB, nX, nG, X, Xg, f, Istim, Ksac)
 
 !     Update gating variables
-      CALL TTP_UPDATEG(imyo, dt, nX, nG, X, Xg)
+      dtv = dt
+      CALL TTP_UPDATEGV(imyo, dtv, nB, nX, nG, X, Xg)
 
 !     Update state variables
-      X = X + dt*f(:)
+      X = X + dt*f
 
       RETURN
-      END SUBROUTINE TTP_INTEGFE
+      END SUBROUTINE TTP_INTEGFEV
 !-----------------------------------------------------------------------
-!     Time integration performed using 4th order Runge-Kutta method
-      SUBROUTINE TTP_INTEGRK(imyo, nX, nG, X, Xg, Ts, dt, Istim, Ksac,
-     2   RPAR)
+!     Time integration of a block of nB cells stored in structure-of-
+!     arrays layout using 4th order Runge-Kutta method
+      SUBROUTINE TTP_INTEGRKV(imyo, nB, nX, nG, X, Xg, dt, Istim, Ksac)
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: imyo, nX, nG
-      REAL(KIND=RKIND), INTENT(INOUT) :: X(nX), Xg(nG), RPAR(18)
-      REAL(KIND=RKIND), INTENT(IN) :: Ts, dt, Istim, Ksac
+      INTEGER(KIND=IKIND), INTENT(IN) :: imyo, nB, nX, nG
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX), Xg(nB,nG)
+      REAL(KIND=RKIND), INTENT(IN) :: dt, Istim, Ksac(nB)
 
-      REAL(KIND=RKIND) :: dt6, Xrk(nX), Xgr(nG), frk(nX,4)
+      REAL(KIND=RKIND) :: dt6, dtv(nB), Xrk(nB,nX), Xgr(nB,nG),
+     2   frk(nB,nX,4)
 
       dt6 = dt/6._RKIND
 
 !     RK4: 1st pass
-      Xrk = X
-      CALL TTP_GETF(imyo, nX, nG, Xrk, Xg, frk(:,1), Istim, Ksac,
-     2   RPAR)
+      CALL TTP_GETFV(imyo, nB, nX, nG, X, Xg, frk(:,:,1), Istim, Ksac)
 
 !     Update gating variables by half-dt
       Xgr = Xg
-      CALL TTP_UPDATEG(imyo, 0.5_RKIND*dt, nX, nG, X, Xgr)
+      dtv = 0.5_RKIND*dt
+      CALL TTP_UPDATEGV(imyo, dtv, nB, nX, nG, X, Xgr)
 
 !     RK4: 2nd pass
-      Xrk = X + 0.5_RKIND*dt*frk(:,1)
-      CALL TTP_GETF(imyo, nX, nG, Xrk, Xgr, frk(:,2), Istim, Ksac,
-     2   RPAR)
+      Xrk = X + 0.5_RKIND*dt*frk(:,:,1)
+      CALL TTP_GETFV(imyo, nB, nX, nG, Xrk, Xgr, frk(:,:,2), Istim,
+     2   Ksac)
 
 !     RK4: 3rd pass
-      Xrk = X + 0.5_RKIND*dt*frk(:,2)
-      CALL TTP_GETF(imyo, nX, nG, Xrk, Xgr, frk(:,3), Istim, Ksac,
-     2   RPAR)
+      Xrk = X + 0.5_RKIND*dt*frk(:,:,2)
+      CALL TTP_GETFV(imyo, nB, nX, nG, Xrk, Xgr, frk(:,:,3), Istim,
+     2   Ksac)
 
 !     Update gating variables by full-dt
       Xgr = Xg
-      CALL TTP_UPDATEG(imyo, dt, nX, nG, X, Xgr)
+      dtv = dt
+      CALL TTP_UPDATEGV(imyo, dtv, nB, nX, nG, X, Xgr)
 
 !     RK4: 4th pass
-      Xrk = X + dt*frk(:,3)
-      CALL TTP_GETF(imyo, nX, nG, Xrk, Xgr, frk(:,4), Istim, Ksac,
-     2   RPAR)
+      Xrk = X + dt*frk(:,:,3)
+      CALL TTP_GETFV(imyo, nB, nX, nG, Xrk, Xgr, frk(:,:,4), Istim,
+     2   Ksac)
 
-      X = X + dt6*(frk(:,1) + 2._RKIND*(frk(:,2) + frk(:,3)) + frk(:,4))
+      X  = X + dt6*(frk(:,:,1) + 2._RKIND*(frk(:,:,2) + frk(:,:,3)) +
+     2   frk(:,:,4))
       Xg = Xgr
 
       RETURN
-      END SUBROUTINE TTP_INTEGRK
+      END SUBROUTINE TTP_INTEGRKV
 !-----------------------------------------------------------------------
-!     Compute currents and time derivatives of state variables
-      SUBROUTINE TTP_GETF(i, nX, nG, X, Xg, dX, I_stim, K_sac, RPAR)
+!     Time integration of a block of nB cells using Rush-Larsen method:
+!     the gating variables are advanced exponentially and the remaining
+!     state variables with Forward Euler. On input, dt(ic) is the max.
+!     step size of each cell. The step is chosen so that the potential
+!     changes by at most tolV times the action potential amplitude, but
+!     it is clamped to [dtMin, dt(ic)]: dtMin is a hard floor that wins
+!     over tolV, so the upstroke never takes steps smaller than dtMin.
+!     The step taken is returned in dt(ic).
+      SUBROUTINE TTP_INTEGRLV(imyo, nB, nX, nG, X, Xg, dt, dtMin, tolV,
+     2   Istim, Ksac)
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: i, nX, nG
-      REAL(KIND=RKIND), INTENT(IN) :: X(nX), Xg(nG), I_stim, K_sac
-      REAL(KIND=RKIND), INTENT(OUT) :: dX(nX)
-      REAL(KIND=RKIND), INTENT(INOUT) :: RPAR(18)
-
-      INCLUDE "PARAMS_TTP.f"
-
-      REAL(KIND=RKIND) :: RT, a, b, tau, sq5, e1, e2, e3, e4, n1, n2,
-     2   d1, d2, d3, I_sac
-
-!     Local copies of state variables
-      V     = X(1)
-      K_i   = X(2)
-      Na_i  = X(3)
-      Ca_i  = X(4)
-      Ca_ss = X(5)
-      Ca_sr = X(6)
-      R_bar = X(7)
-
-!     Local copies of gating variables
-      xr1   = Xg(1)
-      xr2   = Xg(2)
-      xs    = Xg(3)
-      m     = Xg(4)
-      h     = Xg(5)
-      j     = Xg(6)
-      d     = Xg(7)
-      f     = Xg(8)
-      f2    = Xg(9)
-      fcass = Xg(10)
-      s     = Xg(11)
-      r     = Xg(12)
-
-!     Stretch-activated currents
-      I_sac = K_sac * (Vrest - V)
-
-!      Diff = 1._RKIND / (1.0D1 * rho * Cm * sV)
-      RT   = Rc * Tc / Fc
-      E_K  = RT * LOG(K_o/K_i)
-      E_Na = RT * LOG(Na_o/Na_i)
-      E_Ca = 0.5_RKIND * RT * LOG(Ca_o/Ca_i)
-      E_Ks = RT * LOG( (K_o + p_KNa*Na_o)/(K_i + p_KNa*Na_i) )
-
-!     I_Na: Fast sodium current
-      I_Na = G_Na * (m**3._RKIND) * h * j * (V - E_Na)
-
-!     I_to: transient outward current
-      I_to = G_to(i) * r * s * (V - E_K)
-
-!     I_K1: inward rectifier outward current
-      e1   = EXP(0.06_RKIND*(V - E_K - 200._RKIND))
-      e2   = EXP(2.E-4_RKIND*(V - E_K + 100._RKIND))
-      e3   = EXP(0.1_RKIND*(V - E_K - 10._RKIND))
-      e4   = EXP(-0.5_RKIND*(V - E_K))
-      a    = 0.1_RKIND/(1._RKIND + e1)
-      b    = (3._RKIND*e2 + e3) / (1._RKIND + e4)
-      tau  = a / (a + b)
-      sq5  = SQRT(K_o/5.4_RKIND)
-      I_K1 = G_K1 * sq5 * tau * (V - E_K)
+      INTEGER(KIND=IKIND), INTENT(IN) :: imyo, nB, nX, nG
+      REAL(KIND=RKIND), INTENT(INOUT) :: X(nB,nX), Xg(nB,nG), dt(nB)
+      REAL(KIND=RKIND), INTENT(IN) :: dtMin, tolV, Istim, Ksac(nB)
 
-!     I_Kr: rapid delayed rectifier current
-      I_Kr = G_Kr * sq5 * xr1 * xr2 * (V - E_K)
-
-!     I_Ks: slow delayed rectifier current
-      I_Ks = G_Ks(i) * (xs**2._RKIND) * (V - E_Ks)
+!     Action potential amplitude (mV)
+      REAL(KIND=RKIND), PARAMETER :: Vamp = 100._RKIND
 
-!     I_CaL: L-type Ca current
-      a     = 2._RKIND*(V-15._RKIND)/RT
-      b     = 2._RKIND*a*Fc * (0.25_RKIND*Ca_ss*EXP(a) - Ca_o) /
-     2   (EXP(a)-1._RKIND)
-      I_CaL = G_CaL * d * f * f2 * fcass * b
-
-!     I_NaCa: Na-Ca exchanger current
-      e1     = EXP(gamma*V/RT)
-      e2     = EXP((gamma-1._RKIND)*V/RT)
-      n1     = e1*(Na_i**3._RKIND)*Ca_o - e2*(Na_o**3._RKIND)*Ca_i*alpha
-      d1     = K_mNai**3._RKIND + Na_o**3._RKIND
-      d2     = K_mCa + Ca_o
-      d3     = 1._RKIND + K_sat*e2
-      I_NaCa = K_NaCa * n1 / (d1*d2*d3)
+      INTEGER(KIND=IKIND) :: ic
+      REAL(KIND=RKIND) :: f(nB,nX)
 
-!     I_NaK: Na-K pump current
-      e1    = EXP(-0.1_RKIND*V/RT)
-      e2    = EXP(-V/RT)
-      n1    = P_NaK * K_o * Na_i
-      d1    = K_o + K_mK
-      d2    = Na_i + K_mNa
-      d3    = 1._RKIND + 0.1245_RKIND*e1 + 0.0353_RKIND*e2
-      I_NaK = n1 / (d1*d2*d3)
-
-!     I_pCa: plateau Ca current
-      I_pCa = G_pCa * Ca_i / (K_pCa + Ca_i)
-
-!     I_pK: plateau K current
-      I_pK  = G_pK * (V-E_K) /
-     2   (1._RKIND + EXP((25._RKIND-V)/5.98_RKIND))
-
-!     I_bCa: background Ca current
-      I_bCa = G_bCa * (V - E_Ca)
+!     Get time derivatives (RHS)
+      CALL TTP_GETFV(imyo, nB, nX, nG, X, Xg, f, Istim, Ksac)
 
-!     I_bNa: background Na current
-      I_bNa = G_bNa * (V - E_Na)
+!     Select the step size of each cell
+      DO ic=1, nB
+         IF (dt(ic) .LE. 0._RKIND) CYCLE
+         dt(ic) = MIN(dt(ic), MAX(dtMin,
+     2      tolV*Vamp/MAX(ABS(f(ic,1)), EPSILON(Vamp))))
+      END DO
 
-!     I_leak: Sacroplasmic Reticulum Ca leak current
-      I_leak = V_leak * (Ca_sr - Ca_i)
+!     Update gating variables
+      CALL TTP_UPDATEGV(imyo, dt, nB, nX, nG, X, Xg)
 
-!     I_up: Sacroplasmic Reticulum Ca pump current
-      I_up  = Vmax_up / (1._RKIND + (K_up/Ca_i)**2._RKIND)
+!     Update state variables
+      DO ic=1, nB
+         X(ic,:) = X(ic,:) + dt(ic)*f(ic,:)
+      END DO
 
-!     I_rel: Ca induced Ca current (CICR)
-      k_casr = max_sr - ((max_sr-min_sr)/
-     2   (1._RKIND + (EC/Ca_sr)**2._RKIND) )
-      k1     = k1p / k_casr
-      O      = k1 * R_bar * (Ca_ss**2._RKIND) /
-     2   (k3 + k1*(Ca_ss**2._RKIND))
-      I_rel  = V_rel * O * (Ca_sr - Ca_ss)
+      RETURN
+      END SUBROUTINE TTP_INTEGRLV
+!-----------------------------------------------------------------------
+!     Compute currents and time derivatives of state variables for a
+!     block of nB cells. If present, RPAR(3:18) returns the currents of
+!     the last cell
+      SUBROUTINE TTP_GETFV(i, nB, nX, nG, X, Xg, dX, I_stim, K_sac,
+     2   RPAR)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: i, nB, nX, nG
+      REAL(KIND=RKIND), INTENT(IN) :: X(nB,nX), Xg(nB,nG), I_stim,
+     2   K_sac(nB)
+      REAL(KIND=RKIND), INTENT(OUT) :: dX(nB,nX)
+      REAL(KIND=RKIND), INTENT(INOUT), OPTIONAL :: RPAR(18)
 
-!     I_xfer: diffusive Ca current between Ca subspae and cytoplasm
-      I_xfer = V_xfer * (Ca_ss - Ca_i)
+      INCLUDE "PARAMS_TTP.f"
 
-!-----------------------------------------------------------------------
-!     Now compute time derivatives
-!     dV/dt: rate of change of transmembrane voltage
-      dX(1)  = -(I_Na + I_to + I_K1 + I_Kr + I_Ks + I_CaL + I_NaCa +
-     2   I_NaK + I_pCa + I_pK + I_bCa + I_bNa  + I_stim) + I_sac
-
-!     dK_i/dt
-      dX(2)  = -(Cm/(V_c*Fc)) * (I_K1 + I_to + I_Kr + I_Ks + I_pK -
-     2   2._RKIND*I_NaK + I_stim)
-
-!     dNa_i/dt
-      dX(3)  = -(Cm/(V_c*Fc)) * (I_Na + I_bNa +
-     2   3._RKIND*(I_NaK + I_NaCa))
-
-!     dCa_i/dt
-      n1     = (I_leak - I_up)*V_sr/V_c + I_xfer
-      n2     = -(Cm/(V_c*Fc)) * (I_bCa + I_pCa - 2._RKIND*I_Naca)
-     2   / 2._RKIND
-      d1     = 1._RKIND + K_bufc*Buf_c/(Ca_i + K_bufc)**2._RKIND
-      dX(4)  = (n1 + n2)/d1
-
-!     dCa_ss: rate of change of Ca_ss
-      n1     = (-I_CaL*Cm/(2._RKIND*Fc) + I_rel*V_sr - V_c*I_xfer)/V_ss
-      d1     = 1._RKIND + K_bufss*Buf_ss/(Ca_ss + K_bufss)**2._RKIND
-      dX(5)  = n1 / d1
-
-!     dCa_sr: rate of change of Ca_sr
-      n1     = I_up - I_leak - I_rel
-      d1     = 1._RKIND + K_bufsr*Buf_sr/(Ca_sr + K_bufsr)**2._RKIND
-      dX(6)  = n1 / d1
+      INTEGER(KIND=IKIND) :: ic
+      REAL(KIND=RKIND) :: RT, a, b, tau, sq5, e1, e2, e3, e4, n1, n2,
+     2   d1, d2, d3, I_sac
 
-!     Rbar: ryanodine receptor
-      k2     = k2p * k_casr
-      dX(7)  = -k2*Ca_ss*R_bar + k4*(1._RKIND - R_bar)
-
-!     Quantities to be written to file
-      RPAR(3)  = I_Na
-      RPAR(4)  = I_K1
-      RPAR(5)  = I_to
-      RPAR(6)  = I_Kr
-      RPAR(7)  = I_Ks
-      RPAR(8)  = I_CaL
-      RPAR(9)  = I_NaCa
-      RPAR(10) = I_NaK
-      RPAR(11) = I_pCa
-      RPAR(12) = I_pK
-      RPAR(13) = I_bCa
-      RPAR(14) = I_bNa
-      RPAR(15) = I_leak
-      RPAR(16) = I_up
-      RPAR(17) = I_rel
-      RPAR(18) = I_xfer
+      DO ic=1, nB
+!        Local copies of state variables
+         V     = X(ic,1)
+         K_i   = X(ic,2)
+         Na_i  = X(ic,3)
+         Ca_i  = X(ic,4)
+         Ca_ss = X(ic,5)
+         Ca_sr = X(ic,6)
+         R_bar = X(ic,7)
+
+!        Local copies of gating variables
+         xr1   = Xg(ic,1)
+         xr2   = Xg(ic,2)
+         xs    = Xg(ic,3)
+         m     = Xg(ic,4)
+         h     = Xg(ic,5)
+         j     = Xg(ic,6)
+         d     = Xg(ic,7)
+         f     = Xg(ic,8)
+         f2    = Xg(ic,9)
+         fcass = Xg(ic,10)
+         s     = Xg(ic,11)
+         r     = Xg(ic,12)
+
+!        Stretch-activated currents
+         I_sac = K_sac(ic) * (Vrest - V)
+
+         RT   = Rc * Tc / Fc
+         E_K  = RT * LOG(K_o/K_i)
+         E_Na = RT * LOG(Na_o/Na_i)
+         E_Ca = 0.5_RKIND * RT * LOG(Ca_o/Ca_i)
+         E_Ks = RT * LOG( (K_o + p_KNa*Na_o)/(K_i + p_KNa*Na_i) )
+
+!        I_Na: Fast sodium current
+         I_Na = G_Na * (m**3._RKIND) * h * j * (V - E_Na)
+
+!        I_to: transient outward current
+         I_to = G_to(i) * r * s * (V - E_K)
+
+!        I_K1: inward rectifier outward current
+         e1   = EXP(0.06_RKIND*(V - E_K - 200._RKIND))
+         e2   = EXP(2.E-4_RKIND*(V - E_K + 100._RKIND))
+         e3   = EXP(0.1_RKIND*(V - E_K - 10._RKIND))
+         e4   = EXP(-0.5_RKIND*(V - E_K))
+         a    = 0.1_RKIND/(1._RKIND + e1)
+         b    = (3._RKIND*e2 + e3) / (1._RKIND + e4)
+         tau  = a / (a + b)
+         sq5  = SQRT(K_o/5.4_RKIND)
+         I_K1 = G_K1 * sq5 * tau * (V - E_K)
+
+!        I_Kr: rapid delayed rectifier current
+         I_Kr = G_Kr * sq5 * xr1 * xr2 * (V - E_K)
+
+!        I_Ks: slow delayed rectifier current
+         I_Ks = G_Ks(i) * (xs**2._RKIND) * (V - E_Ks)
+
+!        I_CaL: L-type Ca current
+         a     = 2._RKIND*(V-15._RKIND)/RT
+         b     = 2._RKIND*a*Fc * (0.25_RKIND*Ca_ss*EXP(a) - Ca_o) /
+     2      (EXP(a)-1._RKIND)
+         I_CaL = G_CaL * d * f * f2 * fcass * b
+
+!        I_NaCa: Na-Ca exchanger current
+         e1     = EXP(gamma*V/RT)
+         e2     = EXP((gamma-1._RKIND)*V/RT)
+         n1     = e1*(Na_i**3._RKIND)*Ca_o -
+     2      e2*(Na_o**3._RKIND)*Ca_i*alpha
+         d1     = K_mNai**3._RKIND + Na_o**3._RKIND
+         d2     = K_mCa + Ca_o
+         d3     = 1._RKIND + K_sat*e2
+         I_NaCa = K_NaCa * n1 / (d1*d2*d3)
+
+!        I_NaK: Na-K pump current
+         e1    = EXP(-0.1_RKIND*V/RT)
+         e2    = EXP(-V/RT)
+         n1    = P_NaK * K_o * Na_i
+         d1    = K_o + K_mK
+         d2    = Na_i + K_mNa
+         d3    = 1._RKIND + 0.1245_RKIND*e1 + 0.0353_RKIND*e2
+         I_NaK = n1 / (d1*d2*d3)
+
+!        I_pCa: plateau Ca current
+         I_pCa = G_pCa * Ca_i / (K_pCa + Ca_i)
+
+!        I_pK: plateau K current
+         I_pK  = G_pK * (V-E_K) /
+     2      (1._RKIND + EXP((25._RKIND-V)/5.98_RKIND))
+
+!        I_bCa: background Ca current
+         I_bCa = G_bCa * (V - E_Ca)
+
+!        I_bNa: background Na current
+         I_bNa = G_bNa * (V - E_Na)
+
+!        I_leak: Sacroplasmic Reticulum Ca leak current
+         I_leak = V_leak * (Ca_sr - Ca_i)
+
+!        I_up: Sacroplasmic Reticulum Ca pump current
+         I_up  = Vmax_up / (1._RKIND + (K_up/Ca_i)**2._RKIND)
+
+!        I_rel: Ca induced Ca current (CICR)
+         k_casr = max_sr - ((max_sr-min_sr)/
+     2      (1._RKIND + (EC/Ca_sr)**2._RKIND) )
+         k1     = k1p / k_casr
+         O      = k1 * R_bar * (Ca_ss**2._RKIND) /
+     2      (k3 + k1*(Ca_ss**2._RKIND))
+         I_rel  = V_rel * O * (Ca_sr - Ca_ss)
+
+!        I_xfer: diffusive Ca current between Ca subspae and cytoplasm
+         I_xfer = V_xfer * (Ca_ss - Ca_i)
+
+!        Now compute time derivatives
+!        dV/dt: rate of change of transmembrane voltage
+         dX(ic,1) = -(I_Na + I_to + I_K1 + I_Kr + I_Ks + I_CaL +
+     2      I_NaCa + I_NaK + I_pCa + I_pK + I_bCa + I_bNa  + I_stim) +
+     3      I_sac
+
+!        dK_i/dt
+         dX(ic,2) = -(Cm/(V_c*Fc)) * (I_K1 + I_to + I_Kr + I_Ks +
+     2      I_pK - 2._RKIND*I_NaK + I_stim)
+
+!        dNa_i/dt
+         dX(ic,3)  = -(Cm/(V_c*Fc)) * (I_Na + I_bNa +
+     2      3._RKIND*(I_NaK + I_NaCa))
+
+!        dCa_i/dt
+         n1     = (I_leak - I_up)*V_sr/V_c + I_xfer
+         n2     = -(Cm/(V_c*Fc)) * (I_bCa + I_pCa - 2._RKIND*I_Naca)
+     2      / 2._RKIND
+         d1     = 1._RKIND + K_bufc*Buf_c/(Ca_i + K_bufc)**2._RKIND
+         dX(ic,4)  = (n1 + n2)/d1
+
+!        dCa_ss: rate of change of Ca_ss
+         n1     = (-I_CaL*Cm/(2._RKIND*Fc) + I_rel*V_sr -
+     2      V_c*I_xfer)/V_ss
+         d1     = 1._RKIND + K_bufss*Buf_ss/(Ca_ss + K_bufss)**2._RKIND
+         dX(ic,5)  = n1 / d1
+
+!        dCa_sr: rate of change of Ca_sr
+         n1     = I_up - I_leak - I_rel
+         d1     = 1._RKIND + K_bufsr*Buf_sr/(Ca_sr + K_bufsr)**2._RKIND
+         dX(ic,6)  = n1 / d1
+
+!        Rbar: ryanodine receptor
+         k2     = k2p * k_casr
+         dX(ic,7)  = -k2*Ca_ss*R_bar + k4*(1._RKIND - R_bar)
+
+!        Quantities to be written to file
+         IF (PRESENT(RPAR)) THEN
+            RPAR(3)  = I_Na
+            RPAR(4)  = I_K1
+            RPAR(5)  = I_to
+            RPAR(6)  = I_Kr
+            RPAR(7)  = I_Ks
+            RPAR(8)  = I_CaL
+            RPAR(9)  = I_NaCa
+            RPAR(10) = I_NaK
+            RPAR(11) = I_pCa
+            RPAR(12) = I_pK
+            RPAR(13) = I_bCa
+            RPAR(14) = I_bNa
+            RPAR(15) = I_leak
+            RPAR(16) = I_up
+            RPAR(17) = I_rel
+            RPAR(18) = I_xfer
+         END IF
+      END DO
 
       RETURN
-      END SUBROUTINE TTP_GETF
+      END SUBROUTINE TTP_GETFV
 !-----------------------------------------------------------------------
-!     Update all the gating variables
-      SUBROUTINE TTP_UPDATEG(i, dt, n, nG, X, Xg)
+!     Update all the gating variables for a block of cells, each cell
+!     with its own time step size dt(ic)
+      SUBROUTINE TTP_UPDATEGV(i, dt, nB, n, nG, X, Xg)
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: i, n, nG
-      REAL(KIND=RKIND), INTENT(IN) :: dt, X(n)
-      REAL(KIND=RKIND), INTENT(INOUT) :: Xg(nG)
+      INTEGER(KIND=IKIND), INTENT(IN) :: i, nB, n, nG
+      REAL(KIND=RKIND), INTENT(IN) :: dt(nB), X(nB,n)
+      REAL(KIND=RKIND), INTENT(INOUT) :: Xg(nB,nG)
 
       INCLUDE "PARAMS_TTP.f"
 
+      INTEGER(KIND=IKIND) :: ic
       REAL(KIND=RKIND) :: a, b, c, tau
 
-      V     = X(1)
-      Ca_ss = X(5)
-
-      xr1   = Xg(1)
-      xr2   = Xg(2)
-      xs    = Xg(3)
-      m     = Xg(4)
-      h     = Xg(5)
-      j     = Xg(6)
-      d     = Xg(7)
-      f     = Xg(8)
-      f2    = Xg(9)
-      fcass = Xg(10)
-      s     = Xg(11)
-      r     = Xg(12)
+      DO ic=1, nB
+         IF (dt(ic) .LE. 0._RKIND) CYCLE
+         V     = X(ic,1)
+         Ca_ss = X(ic,5)
+
+         xr1   = Xg(ic,1)
+         xr2   = Xg(ic,2)
+         xs    = Xg(ic,3)
+         m     = Xg(ic,4)
+         h     = Xg(ic,5)
+         j     = Xg(ic,6)
+         d     = Xg(ic,7)
+         f     = Xg(ic,8)
+         f2    = Xg(ic,9)
+         fcass = Xg(ic,10)
+         s     = Xg(ic,11)
+         r     = Xg(ic,12)
+
+!        xr1: activation gate for I_Kr
+         xr1i   = 1._RKIND/(1._RKIND + EXP(-(26._RKIND+V)/7._RKIND))
+         a      = 450._RKIND/(1._RKIND + EXP(-(45._RKIND+V)/10._RKIND))
+         b      = 6._RKIND/(1._RKIND + EXP((30._RKIND+V)/11.5_RKIND))
+         tau    = a*b
+         Xg(ic,1)  = xr1i - (xr1i - xr1)*EXP(-dt(ic)/tau)
+
+!        xr2: inactivation gate for I_Kr
+         xr2i   = 1._RKIND /(1._RKIND + EXP((88._RKIND+V)/24._RKIND))
+         a      = 3._RKIND /(1._RKIND + EXP(-(60._RKIND+V)/20._RKIND))
+         b      = 1.12_RKIND/(1._RKIND + EXP(-(60._RKIND-V)/20._RKIND))
+         tau    = a*b
+         Xg(ic,2)  = xr2i - (xr2i - xr2)*EXP(-dt(ic)/tau)
+
+!        xs: activation gate for I_Ks
+         xsi    = 1._RKIND/(1._RKIND + EXP(-(5._RKIND+V)/14._RKIND))
+         a      = 1400._RKIND/
+     2      SQRT(1._RKIND + EXP((5._RKIND-V)/6._RKIND))
+         b      = 1._RKIND/(1._RKIND + EXP((V-35._RKIND)/15._RKIND))
+         tau    = a*b + 80._RKIND
+         Xg(ic,3)  = xsi - (xsi - xs)*EXP(-dt(ic)/tau)
+
+!        m: activation gate for I_Na
+         mi     = 1._RKIND/( (1._RKIND +
+     2      EXP(-(56.86_RKIND+V)/9.03_RKIND))**2._RKIND )
+         a      = 1._RKIND/(1._RKIND + EXP(-(60._RKIND+V)/5._RKIND))
+         b      = 0.1_RKIND/(1._RKIND + EXP((35._RKIND+V)/5._RKIND))
+     2          + 0.1_RKIND/(1._RKIND + EXP((V-50._RKIND)/200._RKIND))
+         tau    = a*b
+         Xg(ic,4)  = mi - (mi - m)*EXP(-dt(ic)/tau)
+
+!        h: fast inactivation gate for I_Na
+         hi     = 1._RKIND/( (1._RKIND
+     2          + EXP((71.55_RKIND+V)/7.43_RKIND))**2._RKIND )
+         IF (V .GE. -40._RKIND) THEN
+            a   = 0._RKIND
+            b   = 0.77_RKIND/(0.13_RKIND*(1._RKIND
+     2          + EXP(-(10.66_RKIND+V)/11.1_RKIND)))
+         ELSE
+            a   = 5.7E-2_RKIND*EXP(-(80._RKIND+V)/6.8_RKIND)
+            b   = 2.7_RKIND*EXP(0.079_RKIND*V)
+     2          + 310000._RKIND*EXP(0.3485_RKIND*V)
+         END IF
+         tau    = 1._RKIND / (a + b)
+         Xg(ic,5)  = hi - (hi - h)*EXP(-dt(ic)/tau)
+
+!        j: slow inactivation gate for I_Na
+         ji     = 1._RKIND/( (1._RKIND
+     2          + EXP((71.55_RKIND+V)/7.43_RKIND))**2._RKIND )
+         IF (V .GE. -40._RKIND) THEN
+            a   = 0._RKIND
+            b   = 0.6_RKIND*EXP(5.7E-2_RKIND*V)
+     2          / (1._RKIND + EXP(-0.1_RKIND*(V+32._RKIND)))
+         ELSE
+            a   = -(25428._RKIND*EXP(0.2444_RKIND*V)
+     2          + 6.948E-6_RKIND*EXP(-0.04391_RKIND*V))
+     3          * (V+37.78_RKIND)
+     4          / (1._RKIND + EXP(0.311_RKIND*(79.23_RKIND+V)))
+            b   = 0.02424_RKIND*EXP(-0.01052_RKIND*V) /
+     2            (1._RKIND + EXP(-0.1378_RKIND*(40.14_RKIND+V)))
+         END IF
+         tau    = 1._RKIND / (a + b)
+         Xg(ic,6)  = ji - (ji - j)*EXP(-dt(ic)/tau)
+
+!        d: activation gate for I_CaL
+         di     = 1._RKIND/(1._RKIND + EXP(-(8._RKIND+V)/7.5_RKIND))
+         a      = 1.4_RKIND/(1._RKIND + EXP(-(35._RKIND+V)/13._RKIND))
+     2          + 0.25_RKIND
+         b      = 1.4_RKIND/(1._RKIND + EXP((5._RKIND+V)/5._RKIND))
+         c      = 1._RKIND/(1._RKIND + EXP((50._RKIND-V)/20._RKIND))
+         tau    = a*b + c
+         Xg(ic,7)  = di - (di - d)*EXP(-dt(ic)/tau)
+
+!        f: slow inactivation gate for I_CaL
+         fi     = 1._RKIND/(1._RKIND + EXP((20._RKIND+V)/7._RKIND))
+         a      = 1102.5_RKIND*
+     2      EXP(-((V+27._RKIND)**2._RKIND)/225._RKIND)
+         b      = 200._RKIND/(1._RKIND + EXP((13._RKIND-V)/10._RKIND))
+         c      = 180._RKIND/(1._RKIND + EXP((30._RKIND+V)/10._RKIND))
+     2          + 20._RKIND
+         tau    = a + b + c
+         Xg(ic,8)  = fi - (fi - f)*EXP(-dt(ic)/tau)
+
+!        f2: fast inactivation gate for I_CaL
+         f2i    = 0.67_RKIND/(1._RKIND + EXP((35._RKIND+V)/7._RKIND))
+     2          + 0.33_RKIND
+         a      = 562._RKIND*EXP(-((27._RKIND+V)**2._RKIND) /240._RKIND)
+         b      = 31._RKIND/(1._RKIND + EXP((25._RKIND-V)/10._RKIND))
+         c      = 80._RKIND/(1._RKIND + EXP((30._RKIND+V)/10._RKIND))
+         tau    = a + b + c
+         Xg(ic,9)  = f2i - (f2i - f2)*EXP(-dt(ic)/tau)
+
+!        fCass: inactivation gate for I_CaL into subspace
+         c      = 1._RKIND/(1._RKIND + (Ca_ss/0.05_RKIND)**2._RKIND)
+         fcassi = 0.6_RKIND*c  + 0.4_RKIND
+         tau    = 80._RKIND*c + 2._RKIND
+         Xg(ic,10) = fcassi - (fcassi - fcass)*EXP(-dt(ic)/tau)
+
+!        s: inactivation gate for I_to
+         IF (i.EQ.1 .OR. i.EQ.3) THEN
+            si  = 1._RKIND/(1._RKIND + EXP((20._RKIND+V)/5._RKIND))
+            tau = 85._RKIND*EXP(-((V+45._RKIND)**2._RKIND) /320._RKIND)
+     2          + 5._RKIND/(1._RKIND+EXP((V-20._RKIND)/5._RKIND))
+     3          + 3._RKIND
+         ELSE IF (i .EQ. 2) THEN
+            si  = 1._RKIND/(1._RKIND + EXP((28._RKIND+V)/5._RKIND))
+            tau = 1000._RKIND*
+     2          EXP(-((V+67._RKIND)**2._RKIND) /1000._RKIND)
+     3          + 8._RKIND
+         END IF
+         Xg(ic,11) = si - (si - s)*EXP(-dt(ic)/tau)
 
-!     xr1: activation gate for I_Kr
-      xr1i   = 1._RKIND/(1._RKIND + EXP(-(26._RKIND+V)/7._RKIND))
-      a      = 450._RKIND/(1._RKIND + EXP(-(45._RKIND+V)/10._RKIND))
-      b      = 6._RKIND/(1._RKIND + EXP((30._RKIND+V)/11.5_RKIND))
-      tau    = a*b
-      Xg(1)  = xr1i - (xr1i - xr1)*EXP(-dt/tau)
-
-!     xr2: inactivation gate for I_Kr
-      xr2i   = 1._RKIND /(1._RKIND + EXP((88._RKIND+V)/24._RKIND))
-      a      = 3._RKIND /(1._RKIND + EXP(-(60._RKIND+V)/20._RKIND))
-      b      = 1.12_RKIND/(1._RKIND + EXP(-(60._RKIND-V)/20._RKIND))
-      tau    = a*b
-      Xg(2)  = xr2i - (xr2i - xr2)*EXP(-dt/tau)
-
-!     xs: activation gate for I_Ks
-      xsi    = 1._RKIND/(1._RKIND + EXP(-(5._RKIND+V)/14._RKIND))
-      a      = 1400._RKIND/SQRT(1._RKIND + EXP((5._RKIND-V)/6._RKIND))
-      b      = 1._RKIND/(1._RKIND + EXP((V-35._RKIND)/15._RKIND))
-      tau    = a*b + 80._RKIND
-      Xg(3)  = xsi - (xsi - xs)*EXP(-dt/tau)
-
-!     m: activation gate for I_Na
-      mi     = 1._RKIND/( (1._RKIND +
-     2   EXP(-(56.86_RKIND+V)/9.03_RKIND))**2._RKIND )
-      a      = 1._RKIND/(1._RKIND + EXP(-(60._RKIND+V)/5._RKIND))
-      b      = 0.1_RKIND/(1._RKIND + EXP((35._RKIND+V)/5._RKIND))
-     2       + 0.1_RKIND/(1._RKIND + EXP((V-50._RKIND)/200._RKIND))
-      tau    = a*b
-      Xg(4)  = mi - (mi - m)*EXP(-dt/tau)
-
-!     h: fast inactivation gate for I_Na
-      hi     = 1._RKIND/( (1._RKIND
-     2       + EXP((71.55_RKIND+V)/7.43_RKIND))**2._RKIND )
-      IF (V .GE. -40._RKIND) THEN
-         a   = 0._RKIND
-         b   = 0.77_RKIND/(0.13_RKIND*(1._RKIND
-     2       + EXP(-(10.66_RKIND+V)/11.1_RKIND)))
-      ELSE
-         a   = 5.7E-2_RKIND*EXP(-(80._RKIND+V)/6.8_RKIND)
-         b   = 2.7_RKIND*EXP(0.079_RKIND*V)
-     2       + 310000._RKIND*EXP(0.3485_RKIND*V)
-      END IF
-      tau    = 1._RKIND / (a + b)
-      Xg(5)  = hi - (hi - h)*EXP(-dt/tau)
-
-!     j: slow inactivation gate for I_Na
-      ji     = 1._RKIND/( (1._RKIND
-     2       + EXP((71.55_RKIND+V)/7.43_RKIND))**2._RKIND )
-      IF (V .GE. -40._RKIND) THEN
-         a   = 0._RKIND
-         b   = 0.6_RKIND*EXP(5.7E-2_RKIND*V)
-     2       / (1._RKIND + EXP(-0.1_RKIND*(V+32._RKIND)))
-      ELSE
-         a   = -(25428._RKIND*EXP(0.2444_RKIND*V)
-     2       + 6.948E-6_RKIND*EXP(-0.04391_RKIND*V)) * (V+37.78_RKIND)
-     3       / (1._RKIND + EXP(0.311_RKIND*(79.23_RKIND+V)))
-         b   = 0.02424_RKIND*EXP(-0.01052_RKIND*V) /
-     2         (1._RKIND + EXP(-0.1378_RKIND*(40.14_RKIND+V)))
-      END IF
-      tau    = 1._RKIND / (a + b)
-      Xg(6)  = ji - (ji - j)*EXP(-dt/tau)
-
-!     d: activation gate for I_CaL
-      di     = 1._RKIND/(1._RKIND + EXP(-(8._RKIND+V)/7.5_RKIND))
-      a      = 1.4_RKIND/(1._RKIND + EXP(-(35._RKIND+V)/13._RKIND))
-     2       + 0.25_RKIND
-      b      = 1.4_RKIND/(1._RKIND + EXP((5._RKIND+V)/5._RKIND))
-      c      = 1._RKIND/(1._RKIND + EXP((50._RKIND-V)/20._RKIND))
-      tau    = a*b + c
-      Xg(7)  = di - (di - d)*EXP(-dt/tau)
-
-!     f: slow inactivation gate for I_CaL
-      fi     = 1._RKIND/(1._RKIND + EXP((20._RKIND+V)/7._RKIND))
-      a      = 1102.5_RKIND*EXP(-((V+27._RKIND)**2._RKIND)/225._RKIND)
-      b      = 200._RKIND/(1._RKIND + EXP((13._RKIND-V)/10._RKIND))
-      c      = 180._RKIND/(1._RKIND + EXP((30._RKIND+V)/10._RKIND))
-     2       + 20._RKIND
-      tau    = a + b + c
-c!     for spiral wave breakup
-c      IF (V .GT. 0._RKIND) tau = tau*2._RKIND
-      Xg(8)  = fi - (fi - f)*EXP(-dt/tau)
-
-!     f2: fast inactivation gate for I_CaL
-      f2i    = 0.67_RKIND/(1._RKIND + EXP((35._RKIND+V)/7._RKIND))
-     2       + 0.33_RKIND
-      a      = 562._RKIND*EXP(-((27._RKIND+V)**2._RKIND) /240._RKIND)
-      b      = 31._RKIND/(1._RKIND + EXP((25._RKIND-V)/10._RKIND))
-      c      = 80._RKIND/(1._RKIND + EXP((30._RKIND+V)/10._RKIND))
-      tau    = a + b + c
-      Xg(9)  = f2i - (f2i - f2)*EXP(-dt/tau)
-
-!     fCass: inactivation gate for I_CaL into subspace
-      c      = 1._RKIND/(1._RKIND + (Ca_ss/0.05_RKIND)**2._RKIND)
-      fcassi = 0.6_RKIND*c  + 0.4_RKIND
-      tau    = 80._RKIND*c + 2._RKIND
-      Xg(10) = fcassi - (fcassi - fcass)*EXP(-dt/tau)
-
-!     s: inactivation gate for I_to
-      IF (i.EQ.1 .OR. i.EQ.3) THEN
-         si  = 1._RKIND/(1._RKIND + EXP((20._RKIND+V)/5._RKIND))
-         tau = 85._RKIND*EXP(-((V+45._RKIND)**2._RKIND) /320._RKIND)
-     2       + 5._RKIND/(1._RKIND+EXP((V-20._RKIND)/5._RKIND))
-     3       + 3._RKIND
-      ELSE IF (i .EQ. 2) THEN
-         si  = 1._RKIND/(1._RKIND + EXP((28._RKIND+V)/5._RKIND))
-         tau = 1000._RKIND*EXP(-((V+67._RKIND)**2._RKIND) /1000._RKIND)
-     2       + 8._RKIND
-      END IF
-      Xg(11) = si - (si - s)*EXP(-dt/tau)
+!        r: activation gate for I_to
+         ri     = 1._RKIND/(1._RKIND + EXP((20._RKIND-V)/6._RKIND))
+         tau    = 9.5_RKIND*EXP(-((V+40._RKIND)**2._RKIND) /1800._RKIND)
+     2          + 0.8_RKIND
+         Xg(ic,12) = ri - (ri - r)*EXP(-dt(ic)/tau)
 
-!     r: activation gate for I_to
-      ri     = 1._RKIND/(1._RKIND + EXP((20._RKIND-V)/6._RKIND))
-      tau    = 9.5_RKIND*EXP(-((V+40._RKIND)**2._RKIND) /1800._RKIND)
-     2       + 0.8_RKIND
-      Xg(12) = ri - (ri - r)*EXP(-dt/tau)
+      END DO
 
       RETURN
-      END SUBROUTINE TTP_UPDATEG
+      END SUBROUTINE TTP_UPDATEGV
 !-----------------------------------------------------------------------
 !     Time integration performed using Crank-Nicholson method
       SUBROUTINE TTP_INTEGCN2(imyo, nX, nG, Xn, Xg, Ts, dt, Istim,
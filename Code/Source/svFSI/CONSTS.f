@@ -200,7 +200,7 @@
      3   PREC_TRILINOS_BLOCK_JACOBI = 703, PREC_TRILINOS_ILU = 704,
      4   PREC_TRILINOS_ILUT = 705, PREC_TRILINOS_IC = 706,
      5   PREC_TRILINOS_ICT = 707, PREC_TRILINOS_ML = 708,
-     6   PREC_RCS = 709
+     6   PREC_RCS = 709, PREC_FSILS_BJ = 710, PREC_FSILS_BILU = 711
 !--------------------------------------------------------------------
 !     Solver definitions
       INTEGER(KIND=IKIND), PARAMETER :: lSolver_NA = 799,
@@ -223,4 +223,8 @@
       INTEGER(KIND=IKIND), PARAMETER :: ibIntrp_NA = 900,
      2   ibIntrp_DI = 901, ibIntrp_L2 = 902
 !--------------------------------------------------------------------
+!     Output probe: face nodes, nodes inside a box, points
+      INTEGER(KIND=IKIND), PARAMETER :: prbType_NA = 950,
+     2   prbType_face = 951, prbType_box = 952, prbType_pnts = 953
+!--------------------------------------------------------------------
 !#######################################################################
@@ -43,12 +43,12 @@
       REAL(KIND=RKIND), INTENT(IN) :: Dg(tDof,tnNo)
 
       LOGICAL :: flag
-      INTEGER(KIND=IKIND) :: i, j, k, l, m, iM, jM, e, a, Ac, b, Bc, g,
-     2   eNoN, insd, nnb, maxNnb
+      INTEGER(KIND=IKIND) :: i, j, k, iM, e, a, Ac, Bc, g, eNoN, insd,
+     2   nNb
       REAL(KIND=RKIND) :: kl, hl, w, Jac, al, c, d, pk, nV1(nsd),
-     2   nV2(nsd), x1(nsd), x2(nsd), x12(nsd), xmin(nsd), xmax(nsd)
+     2   nV2(nsd), x1(nsd), x2(nsd), x12(nsd)
 
-      INTEGER(KIND=IKIND), ALLOCATABLE :: incNd(:), bBox(:,:)
+      INTEGER(KIND=IKIND), ALLOCATABLE :: incNd(:)
       REAL(KIND=RKIND), ALLOCATABLE :: sA(:), sF(:,:), N(:), Nx(:,:),
      2   gCov(:,:), gCnv(:,:), xl(:,:), lR(:,:)
 
@@ -104,76 +104,36 @@
          IF (.NOT.ISZERO(Jac)) sF(:,Ac) = sF(:,Ac) / Jac
       END DO
 
-!     Create a bounding box around possible region of contact and bin
-!     the box with neighboring nodes
-      maxNnb = 15
- 101  maxNnb = maxNnb + 5
-      IF (ALLOCATED(bBox)) DEALLOCATE(bBox)
-      ALLOCATE(bBox(maxNnb,tnNo))
-      bBox = 0
-      DO iM=1, nMsh
-         IF (.NOT.msh(iM)%lShl) CYCLE
-         DO a=1, msh(iM)%nNo
-            Ac = msh(iM)%gN(a)
-            x1(1) = x(1,Ac) + Dg(i,Ac)
-            x1(2) = x(2,Ac) + Dg(j,Ac)
-            x1(3) = x(3,Ac) + Dg(k,Ac)
-
-!           Box limits for each node
-            xmin(:) = x1(:) - cntctM%c
-            xmax(:) = x1(:) + cntctM%c
-
-!           Load the box with neighboring nodes lying within it
-            DO jM=1, nMsh
-               IF (iM.EQ.jM .OR. .NOT.msh(jM)%lShl) CYCLE
-               DO b=1, msh(jM)%nNo
-                  Bc = msh(jM)%gN(b)
-                  x2(1) = x(1,Bc) + Dg(i,Bc)
-                  x2(2) = x(2,Bc) + Dg(j,Bc)
-                  x2(3) = x(3,Bc) + Dg(k,Bc)
-                  IF (x2(1).GE.xmin(1) .AND. x2(1).LE.xmax(1) .AND.
-     2                x2(2).GE.xmin(2) .AND. x2(2).LE.xmax(2) .AND.
-     3                x2(3).GE.xmin(3) .AND. x2(3).LE.xmax(3)) THEN
-                     DO l=1, maxNnb
-                        IF (bBox(l,Ac) .EQ. 0) THEN
-                           bBox(l,Ac) = Bc
-                           EXIT
-                        END IF
-                        IF (Bc .GT. bBox(l,Ac)) CYCLE
-                        IF (Bc .EQ. bBox(l,Ac)) EXIT
-                        IF (bBox(maxNnb,Ac) .NE. 0) GOTO 101
-                        DO m=maxNnb, l+1, -1
-                           bBox(m,Ac) = bBox(m-1,Ac)
-                        END DO
-                        bBox(l,Ac) = Bc
-                        EXIT
-                     END DO
-                     IF (l .GT. maxNnb) GOTO 101
-                  END IF
-               END DO ! b
-            END DO ! jM
-         END DO ! a
-      END DO ! iM
+!     Update the list of neighboring nodes from other shell meshes
+!     that are possibly in contact with each shell node. Neighbors
+!     owned by other processes are appended as halo nodes
+      CALL CNTCTNBRS(Dg, sF)
 
 !     Check if any node is strictly involved in contact and compute
-!     corresponding penalty forces assembled to the residue
+!     corresponding penalty forces assembled to the residue. Forces are
+!     only computed on the nodes owned by this process, so that they
+!     are not counted twice when the residue is communicated
       ALLOCATE(lR(dof,tnNo), incNd(tnNo))
       lR    = 0._RKIND
       incNd = 0
       DO Ac=1, tnNo
-         IF (bBox(1,Ac) .EQ. 0) CYCLE
+         IF (cntctM%nbPtr(Ac) .EQ. cntctM%nbPtr(Ac+1)) CYCLE
          x1(1)  = x(1,Ac) + Dg(i,Ac)
          x1(2)  = x(2,Ac) + Dg(j,Ac)
          x1(3)  = x(3,Ac) + Dg(k,Ac)
          nV1(:) = sF(:,Ac)
          nNb    = 0
-         DO a=1, maxNnb
-            Bc = bBox(a,Ac)
-            IF (Bc .EQ. 0) CYCLE
-            x2(1)  = x(1,Bc) + Dg(i,Bc)
-            x2(2)  = x(2,Bc) + Dg(j,Bc)
-            x2(3)  = x(3,Bc) + Dg(k,Bc)
-            nV2(:) = sF(:,Bc)
+         DO a=cntctM%nbPtr(Ac), cntctM%nbPtr(Ac+1)-1
+            Bc = cntctM%nbList(a)
+            IF (Bc .LE. tnNo) THEN
+               x2(1)  = x(1,Bc) + Dg(i,Bc)
+               x2(2)  = x(2,Bc) + Dg(j,Bc)
+               x2(3)  = x(3,Bc) + Dg(k,Bc)
+               nV2(:) = sF(:,Bc)
+            ELSE
+               x2(:)  = cntctM%xh(:,Bc-tnNo)
+               nV2(:) = cntctM%nh(:,Bc-tnNo)
+            END IF
 
             x12 = x1(:) - x2(:)
             c   = SQRT(NORM(x12))
@@ -200,7 +160,7 @@
          END DO
          IF (nNb .NE. 0) lR(:,Ac) = lR(:,Ac) / REAL(nNb, KIND=RKIND)
       END DO
-      DEALLOCATE(sA, sF, bBox)
+      DEALLOCATE(sA, sF)
 
 !     Return if no penalty forces are to be added
       IF (SUM(incNd) .EQ. 0) RETURN
@@ -215,3 +175,366 @@
       RETURN
       END SUBROUTINE CONTACTFORCES
 !####################################################################
+!     Builds the neighbor lists (CSR format) of shell nodes that could
+!     come in contact with nodes from other shell meshes. Nodes are
+!     binned on a uniform grid whose cell size is not smaller than the
+!     search radius, c + skin, so that only the adjacent cells need to
+!     be searched. The lists are reused during the Newton iterations of
+!     a time step as long as no shell node has moved by more than half
+!     the skin distance since the lists were built.
+!     In parallel, the bounding boxes of the shell nodes are exchanged
+!     between processes, and each process receives the shell nodes of
+!     other processes that lie within the search radius of its box.
+!     These halo nodes are numbered from tnNo+1 in the neighbor lists,
+!     which are only built for the nodes owned by this process.
+      SUBROUTINE CNTCTNBRS(Dg, sF)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      REAL(KIND=RKIND), INTENT(IN) :: Dg(tDof,tnNo), sF(nsd,tnNo)
+
+      LOGICAL flag
+      INTEGER(KIND=IKIND) :: i, j, k, l, m, iM, jM, a, b, Ac, Bc, ic,
+     2   nEnt, nC, nNb, ipass, ilo(nsd), ihi(nsd), nc3(nsd), i1, i2, i3,
+     3   nHl, nS, nR, p, ierr
+      INTEGER(KIND=8) :: ncTot
+      REAL(KIND=RKIND) :: rs, hc, dmax, x1(nsd), x12(nsd), xmn(nsd),
+     2   xmx(nsd), bl(2*nsd)
+
+      INTEGER(KIND=IKIND), ALLOCATABLE :: sMsh(:), eNd(:), eMsh(:),
+     2   eC(:), cPtr(:), cEnt(:), mark(:), sDsp(:), rDsp(:), iS(:,:),
+     3   iR(:,:)
+      REAL(KIND=RKIND), ALLOCATABLE :: xs(:,:), xe(:,:), bb(:,:)
+
+      i  = eq(cEq)%s
+      j  = i + 1
+      k  = j + 1
+      rs = cntctM%c + cntctM%skin
+
+!     Current position of shell nodes
+      ALLOCATE(sMsh(tnNo), xs(nsd,tnNo))
+      sMsh = 0
+      xs   = 0._RKIND
+      nEnt = 0
+      DO iM=1, nMsh
+         IF (.NOT.msh(iM)%lShl) CYCLE
+         DO a=1, msh(iM)%nNo
+            Ac = msh(iM)%gN(a)
+            xs(1,Ac) = x(1,Ac) + Dg(i,Ac)
+            xs(2,Ac) = x(2,Ac) + Dg(j,Ac)
+            xs(3,Ac) = x(3,Ac) + Dg(k,Ac)
+!           Shell mesh the node belongs to. Nodes shared between shell
+!           meshes are marked with -1 and could contact any shell mesh
+            IF (sMsh(Ac).EQ.0) THEN
+               sMsh(Ac) = iM
+            ELSE IF (sMsh(Ac) .NE. iM) THEN
+               sMsh(Ac) = -1
+            END IF
+         END DO
+         nEnt = nEnt + msh(iM)%nNo
+      END DO
+
+!     Check whether the existing lists could be reused. All processes
+!     must agree as the halo is rebuilt collectively
+      dmax = HUGE(dmax)
+      IF (ALLOCATED(cntctM%nbPtr) .AND. cntctM%nbTS.EQ.cTS) THEN
+         IF (SIZE(cntctM%nbPtr) .EQ. tnNo+1) THEN
+            dmax = 0._RKIND
+            DO Ac=1, tnNo
+               IF (sMsh(Ac) .EQ. 0) CYCLE
+               dmax = MAX(dmax, SUM((xs(:,Ac) - cntctM%xb(:,Ac))**2))
+            END DO
+            dmax = SQRT(dmax)
+         END IF
+      END IF
+      dmax = cm%reduce(dmax, MPI_MAX)
+      IF (dmax .LE. 0.5_RKIND*cntctM%skin) THEN
+         CALL CNTCTHALO(xs, sF)
+         DEALLOCATE(sMsh, xs)
+         RETURN
+      END IF
+
+      IF (ALLOCATED(cntctM%nbPtr))  DEALLOCATE(cntctM%nbPtr)
+      IF (ALLOCATED(cntctM%nbList)) DEALLOCATE(cntctM%nbList)
+      IF (ALLOCATED(cntctM%xb))     DEALLOCATE(cntctM%xb)
+      IF (ALLOCATED(cntctM%sCnt))   DEALLOCATE(cntctM%sCnt)
+      IF (ALLOCATED(cntctM%rCnt))   DEALLOCATE(cntctM%rCnt)
+      IF (ALLOCATED(cntctM%sNd))    DEALLOCATE(cntctM%sNd)
+      IF (ALLOCATED(cntctM%rMap))   DEALLOCATE(cntctM%rMap)
+      IF (ALLOCATED(cntctM%xh))     DEALLOCATE(cntctM%xh)
+      IF (ALLOCATED(cntctM%nh))     DEALLOCATE(cntctM%nh)
+      ALLOCATE(cntctM%nbPtr(tnNo+1))
+      cntctM%nbPtr = 0
+      cntctM%nbTS  = cTS
+
+!     Exchange the halo entries, i.e. (node, shell mesh) pairs lying
+!     within the search radius of the bounding box of other processes
+      nHl = 0
+      nR  = 0
+      ALLOCATE(iR(2,0))
+      IF (.NOT.cm%seq()) THEN
+         ALLOCATE(bb(2*nsd,cm%np()), cntctM%sCnt(cm%np()),
+     2      cntctM%rCnt(cm%np()), sDsp(cm%np()), rDsp(cm%np()))
+         bl(1:nsd)       = HUGE(rs)
+         bl(nsd+1:2*nsd) = -HUGE(rs)
+         DO Ac=1, tnNo
+            IF (sMsh(Ac) .EQ. 0) CYCLE
+            bl(1:nsd)       = MIN(bl(1:nsd), xs(:,Ac))
+            bl(nsd+1:2*nsd) = MAX(bl(nsd+1:2*nsd), xs(:,Ac))
+         END DO
+         CALL MPI_ALLGATHER(bl, 2*nsd, mpreal, bb, 2*nsd, mpreal,
+     2      cm%com(), ierr)
+
+         ALLOCATE(iS(2,0), cntctM%sNd(0))
+         DO ipass=1, 2
+            cntctM%sCnt = 0
+            nS = 0
+            DO p=1, cm%np()
+               IF (p .EQ. cm%tF()) CYCLE
+               DO iM=1, nMsh
+                  IF (.NOT.msh(iM)%lShl) CYCLE
+                  DO a=1, msh(iM)%nNo
+                     Ac = msh(iM)%gN(a)
+                     IF (ANY(xs(:,Ac) .LT. bb(1:nsd,p)-rs) .OR.
+     2                   ANY(xs(:,Ac) .GT. bb(nsd+1:2*nsd,p)+rs)) CYCLE
+                     nS = nS + 1
+                     cntctM%sCnt(p) = cntctM%sCnt(p) + 1
+                     IF (ipass .EQ. 2) THEN
+                        cntctM%sNd(nS) = Ac
+                        iS(1,nS) = ltg(Ac)
+                        iS(2,nS) = iM
+                     END IF
+                  END DO
+               END DO
+            END DO
+            IF (ipass .EQ. 1) THEN
+               DEALLOCATE(iS, cntctM%sNd)
+               ALLOCATE(iS(2,nS), cntctM%sNd(nS))
+            END IF
+         END DO
+
+         CALL MPI_ALLTOALL(cntctM%sCnt, 1, mpint, cntctM%rCnt, 1, mpint,
+     2      cm%com(), ierr)
+         sDsp(1) = 0
+         rDsp(1) = 0
+         DO p=2, cm%np()
+            sDsp(p) = sDsp(p-1) + cntctM%sCnt(p-1)
+            rDsp(p) = rDsp(p-1) + cntctM%rCnt(p-1)
+         END DO
+         nR = SUM(cntctM%rCnt)
+         DEALLOCATE(iR)
+         ALLOCATE(iR(2,nR))
+         CALL MPI_ALLTOALLV(iS, 2*cntctM%sCnt, 2*sDsp, mpint, iR,
+     2      2*cntctM%rCnt, 2*rDsp, mpint, cm%com(), ierr)
+
+!        Received nodes that are not local become halo nodes. The
+!        global map is allocated once and only the entries set here are
+!        cleared afterwards, so a rebuild costs O(tnNo + nR)
+         IF (ALLOCATED(cntctM%gtl)) THEN
+            IF (SIZE(cntctM%gtl) .NE. gtnNo) DEALLOCATE(cntctM%gtl)
+         END IF
+         IF (.NOT.ALLOCATED(cntctM%gtl)) THEN
+            ALLOCATE(cntctM%gtl(gtnNo))
+            cntctM%gtl = 0
+         END IF
+         ALLOCATE(cntctM%rMap(nR))
+         DO Ac=1, tnNo
+            cntctM%gtl(ltg(Ac)) = Ac
+         END DO
+         DO l=1, nR
+            IF (cntctM%gtl(iR(1,l)) .EQ. 0) THEN
+               nHl = nHl + 1
+               cntctM%gtl(iR(1,l)) = tnNo + nHl
+            END IF
+            cntctM%rMap(l) = cntctM%gtl(iR(1,l))
+         END DO
+         DO Ac=1, tnNo
+            cntctM%gtl(ltg(Ac)) = 0
+         END DO
+         DO l=1, nR
+            cntctM%gtl(iR(1,l)) = 0
+         END DO
+         DEALLOCATE(bb, sDsp, rDsp, iS)
+      END IF
+      cntctM%nHl = nHl
+      ALLOCATE(cntctM%xh(nsd,nHl), cntctM%nh(nsd,nHl))
+      CALL CNTCTHALO(xs, sF)
+
+      ALLOCATE(xe(nsd,tnNo+nHl))
+      xe(:,1:tnNo) = xs(:,:)
+      xe(:,tnNo+1:tnNo+nHl) = cntctM%xh(:,:)
+      CALL MOVE_ALLOC(xs, cntctM%xb)
+      IF (nEnt+nR .EQ. 0) THEN
+         cntctM%nbPtr = 1
+         ALLOCATE(cntctM%nbList(0))
+         DEALLOCATE(sMsh, iR, xe)
+         RETURN
+      END IF
+
+!     Every local or received (node, shell mesh) pair is an entry of
+!     the grid
+      ALLOCATE(eNd(nEnt+nR), eMsh(nEnt+nR), eC(nEnt+nR))
+      xmn  = HUGE(rs)
+      xmx  = -HUGE(rs)
+      nEnt = 0
+      DO iM=1, nMsh
+         IF (.NOT.msh(iM)%lShl) CYCLE
+         DO a=1, msh(iM)%nNo
+            nEnt = nEnt + 1
+            eNd(nEnt)  = msh(iM)%gN(a)
+            eMsh(nEnt) = iM
+         END DO
+      END DO
+      DO l=1, nR
+         nEnt = nEnt + 1
+         eNd(nEnt)  = cntctM%rMap(l)
+         eMsh(nEnt) = iR(2,l)
+      END DO
+      DO l=1, nEnt
+         xmn(:) = MIN(xmn(:), xe(:,eNd(l)))
+         xmx(:) = MAX(xmx(:), xe(:,eNd(l)))
+      END DO
+
+!     Grid cell size is at least the search radius, and is coarsened
+!     if needed to keep the number of cells proportional to entries
+      hc = MAX(rs, cntctM%tol)
+      DO
+         nc3(:) = INT((xmx(:) - xmn(:))/hc, KIND=IKIND) + 1
+         ncTot  = PRODUCT(INT(nc3(:), KIND=8))
+         IF (ncTot .LE. INT(4*nEnt, KIND=8)) EXIT
+         hc = 2._RKIND*hc
+      END DO
+      nC = INT(ncTot, KIND=IKIND)
+
+!     Bin the entries in the grid cells using a counting sort
+      ALLOCATE(cPtr(nC+1), cEnt(nEnt))
+      cPtr = 0
+      DO l=1, nEnt
+         ilo(:) = INT((xe(:,eNd(l)) - xmn(:))/hc, KIND=IKIND)
+         ilo(:) = MIN(ilo(:), nc3(:)-1)
+         eC(l) = 1 + ilo(1) + nc3(1)*(ilo(2) + nc3(2)*ilo(3))
+         cPtr(eC(l)+1) = cPtr(eC(l)+1) + 1
+      END DO
+      cPtr(1) = 1
+      DO ic=1, nC
+         cPtr(ic+1) = cPtr(ic+1) + cPtr(ic)
+      END DO
+      DO l=1, nEnt
+         ic = eC(l)
+         cEnt(cPtr(ic)) = l
+         cPtr(ic) = cPtr(ic) + 1
+      END DO
+      DO ic=nC, 1, -1
+         cPtr(ic+1) = cPtr(ic)
+      END DO
+      cPtr(1) = 1
+
+!     Search the neighboring cells of each owned shell node. The first
+!     pass counts the neighbors and the second pass fills the lists
+      ALLOCATE(mark(tnNo+nHl))
+      DO ipass=1, 2
+         mark = 0
+         IF (ipass .EQ. 2) THEN
+            DO Ac=1, tnNo
+               cntctM%nbPtr(Ac+1) = cntctM%nbPtr(Ac+1) +
+     2            cntctM%nbPtr(Ac)
+            END DO
+            ALLOCATE(cntctM%nbList(cntctM%nbPtr(tnNo+1)-1))
+         END IF
+         DO Ac=1, tnNo
+            IF (sMsh(Ac).EQ.0 .OR. lhs%map(Ac).GT.lhs%mynNo) CYCLE
+            x1(:) = xe(:,Ac)
+            ilo(:) = INT((x1(:) - rs - xmn(:))/hc, KIND=IKIND)
+            ihi(:) = INT((x1(:) + rs - xmn(:))/hc, KIND=IKIND)
+            ilo(:) = MAX(ilo(:), 0)
+            ihi(:) = MIN(ihi(:), nc3(:)-1)
+            nNb = 0
+            DO i3=ilo(3), ihi(3)
+               DO i2=ilo(2), ihi(2)
+                  DO i1=ilo(1), ihi(1)
+                     ic = 1 + i1 + nc3(1)*(i2 + nc3(2)*i3)
+                     DO l=cPtr(ic), cPtr(ic+1)-1
+                        jM = eMsh(cEnt(l))
+                        Bc = eNd(cEnt(l))
+                        IF (jM.EQ.sMsh(Ac) .OR. mark(Bc).EQ.Ac) CYCLE
+                        x12(:) = x1(:) - xe(:,Bc)
+                        IF (SUM(x12(:)**2) .GT. rs*rs) CYCLE
+                        mark(Bc) = Ac
+                        nNb = nNb + 1
+                        IF (ipass .EQ. 2) THEN
+                           b = cntctM%nbPtr(Ac) + nNb - 1
+                           cntctM%nbList(b) = Bc
+                        END IF
+                     END DO
+                  END DO
+               END DO
+            END DO
+            IF (ipass .EQ. 1) THEN
+               cntctM%nbPtr(Ac+1) = nNb
+            ELSE
+!              Sort the neighbors for a deterministic assembly order
+               a = cntctM%nbPtr(Ac)
+               DO l=a+1, a+nNb-1
+                  Bc = cntctM%nbList(l)
+                  m  = l - 1
+                  DO WHILE (m .GE. a)
+                     IF (cntctM%nbList(m) .LE. Bc) EXIT
+                     cntctM%nbList(m+1) = cntctM%nbList(m)
+                     m = m - 1
+                  END DO
+                  cntctM%nbList(m+1) = Bc
+               END DO
+            END IF
+         END DO
+         IF (ipass .EQ. 1) cntctM%nbPtr(1) = 1
+      END DO
+
+      DEALLOCATE(sMsh, iR, xe, eNd, eMsh, eC, cPtr, cEnt, mark)
+
+      RETURN
+      END SUBROUTINE CNTCTNBRS
+!####################################################################
+!     Updates the current position and normal vector of the halo nodes
+!     by sending the local shell nodes listed during the last build of
+!     the neighbor lists to the processes that requested them
+      SUBROUTINE CNTCTHALO(xs, sF)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      REAL(KIND=RKIND), INTENT(IN) :: xs(nsd,tnNo), sF(nsd,tnNo)
+
+      INTEGER(KIND=IKIND) :: l, m, p, Ac, Bc, nS, nR, ierr
+      INTEGER(KIND=IKIND), ALLOCATABLE :: sDsp(:), rDsp(:)
+      REAL(KIND=RKIND), ALLOCATABLE :: rS(:,:), rR(:,:)
+
+      IF (cm%seq()) RETURN
+
+      m  = 2*nsd
+      nS = SIZE(cntctM%sNd)
+      nR = SIZE(cntctM%rMap)
+      ALLOCATE(sDsp(cm%np()), rDsp(cm%np()), rS(m,nS), rR(m,nR))
+      DO l=1, nS
+         Ac = cntctM%sNd(l)
+         rS(1:nsd,l)   = xs(:,Ac)
+         rS(nsd+1:m,l) = sF(:,Ac)
+      END DO
+      sDsp(1) = 0
+      rDsp(1) = 0
+      DO p=2, cm%np()
+         sDsp(p) = sDsp(p-1) + cntctM%sCnt(p-1)
+         rDsp(p) = rDsp(p-1) + cntctM%rCnt(p-1)
+      END DO
+      CALL MPI_ALLTOALLV(rS, m*cntctM%sCnt, m*sDsp, mpreal, rR,
+     2   m*cntctM%rCnt, m*rDsp, mpreal, cm%com(), ierr)
+
+      DO l=1, nR
+         Bc = cntctM%rMap(l) - tnNo
+         IF (Bc .LE. 0) CYCLE
+         cntctM%xh(:,Bc) = rR(1:nsd,l)
+         cntctM%nh(:,Bc) = rR(nsd+1:m,l)
+      END DO
+      DEALLOCATE(sDsp, rDsp, rS, rR)
+
+      RETURN
+      END SUBROUTINE CNTCTHALO
+!####################################################################
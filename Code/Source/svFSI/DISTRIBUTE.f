@@ -182,6 +182,8 @@
          CALL cm%bcast(nEq)
          CALL cm%bcast(dt)
          CALL cm%bcast(zeroAve)
+         CALL cm%bcast(ave%nPh)
+         CALL cm%bcast(ave%nCyc)
          CALL cm%bcast(cmmInit)
          CALL cm%bcast(cmmVarWall)
          CALL cm%bcast(shlEq)
@@ -192,6 +194,8 @@
             CALL cm%bcast(rmsh%method)
             CALL cm%bcast(rmsh%freq)
             CALL cm%bcast(rmsh%cpVar)
+            CALL cm%bcast(rmsh%ovlp)
+            CALL cm%bcast(rmsh%ovlpJ)
             IF (cm%slv()) THEN
                ALLOCATE(rmsh%maxEdgeSize(nMsh))
                rmsh%minDihedAng = 0._RKIND
@@ -206,6 +210,7 @@
             CALL cm%bcast(cntctM%c)
             CALL cm%bcast(cntctM%h)
             CALL cm%bcast(cntctM%al)
+            CALL cm%bcast(cntctM%skin)
          END IF
          CALL cm%bcast(ibFlag)
          IF (ibFlag) CALL DISTIB()
@@ -311,6 +316,13 @@
          dbg = "Distributed equation "//iEq
       END DO
 
+!     Output probes
+      CALL cm%bcast(nPrb)
+      IF (cm%slv()) ALLOCATE(prb(nPrb))
+      DO i=1, nPrb
+         CALL DISTPRB(prb(i))
+      END DO
+
 !     For CMM initialization
       flag = ALLOCATED(cmmBdry)
       CALL cm%bcast(flag)
@@ -493,6 +505,29 @@
 
       RETURN
       END SUBROUTINE DISTIBFa
+!####################################################################
+      SUBROUTINE DISTPRB(lPrb)
+      USE COMMOD
+      IMPLICIT NONE
+      TYPE(prbType), INTENT(INOUT) :: lPrb
+
+      CALL cm%bcast(lPrb%name)
+      CALL cm%bcast(lPrb%pType)
+      CALL cm%bcast(lPrb%incr)
+      CALL cm%bcast(lPrb%iM)
+      CALL cm%bcast(lPrb%iFa)
+      CALL cm%bcast(lPrb%gn)
+      CALL cm%bcast(lPrb%nFld)
+      IF (cm%slv()) ALLOCATE(lPrb%fld(2,lPrb%nFld))
+      CALL cm%bcast(lPrb%fld)
+      CALL cm%bcast(lPrb%xb)
+      IF (lPrb%pType .EQ. prbType_pnts) THEN
+         IF (cm%slv()) ALLOCATE(lPrb%x(nsd,lPrb%gn))
+         CALL cm%bcast(lPrb%x)
+      END IF
+
+      RETURN
+      END SUBROUTINE DISTPRB
 !####################################################################
 !     This routine distributes equations between processors
       SUBROUTINE DISTEQ(lEq, tMs, gmtl)
@@ -526,6 +561,12 @@
 !     Distribute linear solver settings
       CALL cm%bcast(lEq%FSILS%foC)
       CALL cm%bcast(lEq%FSILS%LS_type)
+      CALL cm%bcast(lEq%FSILS%mixP)
+      CALL cm%bcast(lEq%FSILS%mRef)
+      CALL cm%bcast(lEq%FSILS%sFrz)
+      CALL cm%bcast(lEq%FSILS%nPrj)
+      CALL cm%bcast(lEq%FSILS%ewFlag)
+      CALL cm%bcast(lEq%FSILS%ewMax)
       CALL cm%bcast(lEq%FSILS%RI%relTol)
       CALL cm%bcast(lEq%FSILS%GM%relTol)
       CALL cm%bcast(lEq%FSILS%CG%relTol)
@@ -545,6 +586,7 @@
       CALL cm%bcast(lEq%ls%absTol)
       CALL cm%bcast(lEq%ls%mItr)
       CALL cm%bcast(lEq%ls%sD)
+      CALL cm%bcast(lEq%ls%mFree)
 
 !     Distribute domain properties
       IF (cm%slv()) ALLOCATE(lEq%dmn(lEq%nDmn))
@@ -575,6 +617,11 @@
                CALL cm%bcast(lEq%dmn(iDmn)%cep%odes%absTol)
                CALL cm%bcast(lEq%dmn(iDmn)%cep%odes%relTol)
             END IF
+            IF (lEq%dmn(iDmn)%cep%odes%tIntType .EQ. tIntType_RL) THEN
+               CALL cm%bcast(lEq%dmn(iDmn)%cep%odes%adapt)
+               CALL cm%bcast(lEq%dmn(iDmn)%cep%odes%dtMax)
+               CALL cm%bcast(lEq%dmn(iDmn)%cep%odes%tolV)
+            END IF
          END IF
 
          IF ((lEq%dmn(iDmn)%phys .EQ. phys_struct)  .OR.
@@ -1137,6 +1184,7 @@
       CALL cm%bcast(lM%lShpF)
       CALL cm%bcast(lM%lShl)
       CALL cm%bcast(lM%lFib)
+      CALL cm%bcast(lM%lCNx)
       CALL cm%bcast(lM%eType)
       CALL cm%bcast(lM%eNoN)
       CALL cm%bcast(lM%nFa)
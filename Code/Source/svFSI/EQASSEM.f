@@ -103,13 +103,17 @@
 
       iM   = lFa%iM
       eNoN = lFa%eNoN
+
+!     Element-local arrays are allocated once and reused for all the
+!     elements of the face
+      ALLOCATE(ptr(eNoN), N(eNoN), hl(eNoN), yl(tDof,eNoN),
+     2   lR(dof,eNoN), lK(dof*dof,eNoN,eNoN))
+
       DO e=1, lFa%nEl
          Ec    = lFa%gE(e)
          cDmn  = DOMAIN(msh(iM), cEq, Ec)
          cPhys = eq(cEq)%dmn(cDmn)%phys
 
-         ALLOCATE(ptr(eNoN), N(eNoN), hl(eNoN), yl(tDof,eNoN),
-     2      lR(dof,eNoN), lK(dof*dof,eNoN,eNoN))
          lK = 0._RKIND
          lR = 0._RKIND
          DO a=1, eNoN
@@ -185,8 +189,8 @@
 #ifdef WITH_TRILINOS
          END IF
 #endif
-         DEALLOCATE(ptr, N, hl, yl, lR, lK)
       END DO
+      DEALLOCATE(ptr, N, hl, yl, lR, lK)
 
       RETURN
       END SUBROUTINE BASSEMNEUBC
@@ -213,20 +217,21 @@
       iM    = lFa%iM
       eNoN  = msh(iM)%eNoN
       eNoNb = lFa%eNoN
+
+!     Element-local arrays are allocated once and reused for all the
+!     elements of the face
+      ALLOCATE(ptr(eNoN), hl(eNoN), xl(nsd,eNoN), dl(tDof,eNoN),
+     2   N(eNoN), Nxi(nsd,eNoN), Nx(nsd,eNoN), lR(dof,eNoN),
+     3   lK(dof*dof,eNoN,eNoN), lKd(dof*nsd,eNoN,eNoN))
+
       DO e=1, lFa%nEl
          Ec    = lFa%gE(e)
          cDmn  = DOMAIN(msh(iM), cEq, Ec)
          cPhys = eq(cEq)%dmn(cDmn)%phys
 
-         ALLOCATE(ptr(eNoN), hl(eNoN), xl(nsd,eNoN), dl(tDof,eNoN),
-     2      N(eNoN), Nxi(nsd,eNoN), Nx(nsd,eNoN), lR(dof,eNoN),
-     3      lK(dof*dof,eNoN,eNoN))
          lR = 0._RKIND
          lK = 0._RKIND
-         IF (cPhys .EQ. phys_ustruct) THEN
-            ALLOCATE(lKd(dof*nsd,eNoN,eNoN))
-            lKd = 0._RKIND
-         END IF
+         IF (cPhys .EQ. phys_ustruct) lKd = 0._RKIND
 
 !        Create local copies
          DO a=1, eNoN
@@ -288,7 +293,6 @@
 #endif
             IF (cPhys .EQ. phys_ustruct) THEN
                CALL USTRUCT_DOASSEM(eNoN, ptr, lKd, lK, lR)
-               DEALLOCATE(lKd)
 
             ELSE IF (cPhys .EQ. phys_struct) THEN
                CALL DOASSEM(eNoN, ptr, lK, lR)
@@ -297,8 +301,8 @@
 #ifdef WITH_TRILINOS
          END IF
 #endif
-         DEALLOCATE(ptr, hl, xl, dl, N, Nxi, Nx, lR, lK)
       END DO
+      DEALLOCATE(ptr, hl, xl, dl, N, Nxi, Nx, lR, lK, lKd)
 
       RETURN
       END SUBROUTINE BNEUFOLWP
@@ -82,7 +82,11 @@
          lR = 0._RKIND
          lK = 0._RKIND
          DO g=1, lM%nG
-            IF (g.EQ.1 .OR. .NOT.lM%lShpF) THEN
+            IF (lM%lCNx) THEN
+               Nx   = lM%cNx(:,:,g,e)
+               Jac  = lM%cJac(g,e)
+               ksix = lM%cKs(:,:,g,e)
+            ELSE IF (g.EQ.1 .OR. .NOT.lM%lShpF) THEN
                CALL GNN(eNoN, nsd, lM%Nx(:,:,g), xl, Nx, Jac, ksix)
                IF (ISZERO(Jac)) err = "Jac < 0 @ element "//e
             END IF
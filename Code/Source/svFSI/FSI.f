@@ -44,22 +44,26 @@
       REAL(KIND=RKIND), INTENT(IN) :: Ag(tDof,tnNo), Yg(tDof,tnNo),
      2   Dg(tDof,tnNo)
 
-      INTEGER(KIND=IKIND) a, e, g, Ac, eNoN, cPhys, iFn, nFn
+      INTEGER(KIND=IKIND) a, e, g, Ac, eNoN, nG, cPhys, iFn, nFn
       REAL(KIND=RKIND) w, Jac, ksix(nsd,nsd)
 
       INTEGER(KIND=IKIND), ALLOCATABLE :: ptr(:)
       REAL(KIND=RKIND), ALLOCATABLE :: xl(:,:), al(:,:), yl(:,:),
      2   dl(:,:), bfl(:,:), fN(:,:), pS0l(:,:), pSl(:), ya_l(:), N(:),
-     3   Nx(:,:), lR(:,:), lK(:,:,:), lKd(:,:,:)
+     3   Nx(:,:), lR(:,:), lK(:,:,:), lKd(:,:,:), wg(:), Nxg(:,:,:),
+     4   ksixg(:,:,:), Fg(:,:,:), Sg(:,:,:), Dmg(:,:,:), Jag(:)
 
       eNoN = lM%eNoN
+      nG   = lM%nG
       nFn  = lM%nFn
       IF (nFn .EQ. 0) nFn = 1
 
       ALLOCATE(ptr(eNoN), xl(nsd,eNoN), al(tDof,eNoN), yl(tDof,eNoN),
      2   dl(tDof,eNoN), bfl(nsd,eNoN), fN(nsd,nFn), pS0l(nsymd,eNoN),
      3   pSl(nsymd), ya_l(eNoN), N(eNoN), Nx(nsd,eNoN), lR(dof,eNoN),
-     3   lK(dof*dof,eNoN,eNoN), lKd(dof*nsd,eNoN,eNoN))
+     3   lK(dof*dof,eNoN,eNoN), lKd(dof*nsd,eNoN,eNoN), wg(nG),
+     4   Nxg(nsd,eNoN,nG), ksixg(nsd,nsd,nG), Fg(nsd,nsd,nG),
+     5   Sg(nsd,nsd,nG), Dmg(nsymd,nsymd,nG), Jag(nG))
 
 !     Loop over all elements of mesh
       DO e=1, lM%nEl
@@ -99,17 +103,33 @@
             xl(:,:) = xl(:,:) + dl(nsd+2:2*nsd+1,:)
          END IF
 
-!        Gauss integration
-         lR  = 0._RKIND
-         lK  = 0._RKIND
-         lKd = 0._RKIND
-         DO g=1, lM%nG
+!        Shape function derivatives at all the Gauss points
+         DO g=1, nG
             IF (g.EQ.1 .OR. .NOT.lM%lShpF) THEN
                CALL GNN(eNoN, nsd, lM%Nx(:,:,g), xl, Nx, Jac, ksix)
                IF (ISZERO(Jac)) err = "Jac < 0 @ element "//e
             END IF
-            w = lM%w(g) * Jac
-            N = lM%N(:,g)
+            wg(g) = lM%w(g) * Jac
+            Nxg(:,:,g)   = Nx
+            ksixg(:,:,g) = ksix
+         END DO
+
+!        Material response of the structure at all the Gauss points,
+!        evaluated as one batch
+         IF (cPhys .EQ. phys_struct) THEN
+            CALL GETPK2CCe(eq(cEq)%dmn(cDmn), .FALSE., eNoN, nG, nFn,
+     2         lM%N, Nxg, dl, fN, ya_l, Fg, Sg, Dmg, Jag)
+         END IF
+
+!        Gauss integration
+         lR  = 0._RKIND
+         lK  = 0._RKIND
+         lKd = 0._RKIND
+         DO g=1, nG
+            w    = wg(g)
+            N    = lM%N(:,g)
+            Nx   = Nxg(:,:,g)
+            ksix = ksixg(:,:,g)
 
             IF (nsd .EQ. 3) THEN
                SELECT CASE (cPhys)
@@ -121,8 +141,8 @@
      2               lR, lK)
 
                CASE (phys_struct)
-                  CALL STRUCT3D(eNoN, nFn, w, N, Nx, al, yl, dl, bfl,
-     2               fN, pS0l, pSl, ya_l, lR, lK)
+                  CALL STRUCT3D(eNoN, w, N, Nx, al, yl, bfl, pS0l,
+     2               Fg(:,:,g), Sg(:,:,g), Dmg(:,:,g), pSl, lR, lK)
 
                CASE (phys_ustruct)
 c                  CALL USTRUCT3D(eNoN, nFn, w, Jac, N, Nx, al, yl, dl,
@@ -140,8 +160,8 @@ c     2               bfl, fN, ya_l, lR, lK, lKd)
      2               lR, lK)
 
                CASE (phys_struct)
-                  CALL STRUCT2D(eNoN, nFn, w, N, Nx, al, yl, dl, bfl,
-     2               fN, pS0l, pSl, ya_l, lR, lK)
+                  CALL STRUCT2D(eNoN, w, N, Nx, al, yl, bfl, pS0l,
+     2               Fg(:,:,g), Sg(:,:,g), Dmg(:,:,g), pSl, lR, lK)
 
                CASE (phys_ustruct)
 c                  CALL USTRUCT2D(eNoN, nFn, w, Jac, N, Nx, al, yl, dl,
@@ -170,7 +190,7 @@ c     2               bfl, fN, ya_l, lR, lK, lKd)
       END DO ! e: loop
 
       DEALLOCATE(ptr, xl, al, yl, dl, bfl, fN, pS0l, pSl, ya_l, N, Nx,
-     2   lR, lK, lKd)
+     2   lR, lK, lKd, wg, Nxg, ksixg, Fg, Sg, Dmg, Jag)
 
       RETURN
       END SUBROUTINE CONSTRUCT_FSI
@@ -3792,7 +3792,7 @@ c      END DO
      2   Dg(tDof,tnNo), Aug(nsd,ib%tnNo), Ubg(nsd,ib%tnNo)
 
       INTEGER(KIND=IKIND) a, b, e, g, i, j, Ac, Bc, Ec, iM, jM, eNoNb,
-     2   eNoN, nFn, ibl
+     2   eNoN, nFn, ibl, eNoNl
       REAL(KIND=RKIND) w, Jac, dtF, rt, xi(nsd), Kxi(nsd,nsd), tt(2)
 
       INTEGER, ALLOCATABLE :: ptr(:)
@@ -3818,7 +3818,9 @@ c      END DO
 !     weighting function spaces used in the weak form for residue is
 !     based on the background fluid mesh, while the integration is
 !     performed on the IB mesh in its reference configuration.
-!     Loop over all IB mesh
+!     Loop over all IB mesh. Background element arrays are only
+!     reallocated when the element type of the background mesh changes
+      eNoNl = 0
       DO iM=1, ib%nMsh
          eNoNb = ib%msh(iM)%eNoN
          nFn   = MAX(ib%msh(iM)%nFn, 1)
@@ -3864,10 +3866,16 @@ c      END DO
             w = ib%msh(iM)%w(g) * Jac
 
             eNoN = msh(jM)%eNoN
-            ALLOCATE(N(eNoN), Nxi(nsd,eNoN), Nx(nsd,eNoN), xl(nsd,eNoN),
-     2         al(tDof,eNoN), yl(tDof,eNoN), ul(nsd,eNoN), ptr(eNoN),
-     3         lR(nsd+1,eNoN), lRu(nsd,eNoN), lK(dof*dof,eNoN,eNoN),
-     4         lKu((nsd+1)*nsd,eNoN,eNoN))
+            IF (eNoN .NE. eNoNl) THEN
+               IF (eNoNl .NE. 0) DEALLOCATE(N, Nxi, Nx, xl, al, yl, ul,
+     2            ptr, lR, lRu, lK, lKu)
+               ALLOCATE(N(eNoN), Nxi(nsd,eNoN), Nx(nsd,eNoN),
+     2            xl(nsd,eNoN), al(tDof,eNoN), yl(tDof,eNoN),
+     3            ul(nsd,eNoN), ptr(eNoN), lR(nsd+1,eNoN),
+     4            lRu(nsd,eNoN), lK(dof*dof,eNoN,eNoN),
+     5            lKu((nsd+1)*nsd,eNoN,eNoN))
+               eNoNl = eNoN
+            END IF
 
             lR   = 0._RKIND
             lK   = 0._RKIND
@@ -3936,10 +3944,11 @@ c      END DO
                CALL IB_DOASSEM(eNoN, ptr, lKu, lK)
             END IF
 
-            DEALLOCATE(N, Nxi, Nx, xl, al, yl, ul, ptr, lR, lRu, lK,lKu)
          END DO
          DEALLOCATE(Nb, Nbx, xbl, ubl, aul, fN)
       END DO
+      IF (eNoNl .NE. 0) DEALLOCATE(N, Nxi, Nx, xl, al, yl, ul, ptr, lR,
+     2   lRu, lK, lKu)
 
       tt(2) = CPUT()
       CALL COMMU(ib%R)
@@ -256,6 +256,8 @@
       IF (.NOT.resetSim) THEN
          IF (.NOT.ALLOCATED(rmsh%flag)) ALLOCATE(rmsh%flag(nMsh))
          rmsh%flag(:) = .FALSE.
+         IF (.NOT.ALLOCATED(rmsh%minJ)) ALLOCATE(rmsh%minJ(nMsh))
+         rmsh%minJ(:) = 1._RKIND
          rmsh%fTS = rmsh%freq
          IF (rmsh%isReqd) THEN
             ALLOCATE(rmsh%A0(tDof,tnNo))
@@ -341,6 +343,11 @@
          END DO
       END DO
 
+!     Cache shape function gradients, if requested
+      DO iM=1, nMsh
+         IF (msh(iM)%lCNx) CALL GNNCACHE(msh(iM))
+      END DO
+
 !     Initialize Immersed Boundary data structures
       ALLOCATE(iblank(tnNo))
       iblank = 0
@@ -614,6 +621,7 @@
          DEALLOCATE(msh)
       END IF
       IF (ALLOCATED(rmsh%flag)) DEALLOCATE(rmsh%flag)
+      IF (ALLOCATED(rmsh%minJ)) DEALLOCATE(rmsh%minJ)
 
 !     Deallocating equations
       IF (ALLOCATED(eq)) THEN
@@ -622,6 +630,7 @@
          END DO
          DEALLOCATE(eq)
       END IF
+      IF (ALLOCATED(prb)) DEALLOCATE(prb)
 
 !     Deallocating sparse matrix structures
       IF(lhs%foc) CALL FSILS_LHS_FREE(lhs)
@@ -650,6 +659,8 @@
       IF (ALLOCATED(Do))       DEALLOCATE(Do)
       IF (ALLOCATED(Dn))       DEALLOCATE(Dn)
       IF (ALLOCATED(R))        DEALLOCATE(R)
+      IF (ALLOCATED(mfD))      DEALLOCATE(mfD, mfU, mfKU)
+      IF (ALLOCATED(mfAg))     DEALLOCATE(mfAg, mfYg, mfDg)
       IF (ALLOCATED(x))        DEALLOCATE(x)
       IF (ALLOCATED(Yo))       DEALLOCATE(Yo)
       IF (ALLOCATED(Yn))       DEALLOCATE(Yn)
@@ -674,6 +685,19 @@
 
       IF (ALLOCATED(varWallProps)) DEALLOCATE(varWallProps)
 
+!     Contact model neighbor lists
+      IF (ALLOCATED(cntctM%nbPtr))  DEALLOCATE(cntctM%nbPtr)
+      IF (ALLOCATED(cntctM%nbList)) DEALLOCATE(cntctM%nbList)
+      IF (ALLOCATED(cntctM%xb))     DEALLOCATE(cntctM%xb)
+      IF (ALLOCATED(cntctM%sCnt))   DEALLOCATE(cntctM%sCnt)
+      IF (ALLOCATED(cntctM%rCnt))   DEALLOCATE(cntctM%rCnt)
+      IF (ALLOCATED(cntctM%sNd))    DEALLOCATE(cntctM%sNd)
+      IF (ALLOCATED(cntctM%rMap))   DEALLOCATE(cntctM%rMap)
+      IF (ALLOCATED(cntctM%gtl))    DEALLOCATE(cntctM%gtl)
+      IF (ALLOCATED(cntctM%xh))     DEALLOCATE(cntctM%xh)
+      IF (ALLOCATED(cntctM%nh))     DEALLOCATE(cntctM%nh)
+      cntctM%nHl = 0
+
 !     Electrophysiology and Electromechanics
       IF (cepEq) THEN
          IF (ALLOCATED(Xion))  DEALLOCATE(Xion)
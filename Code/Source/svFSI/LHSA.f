@@ -265,13 +265,18 @@
 !     global stiffness matrix (Val sparse matrix formatted as a vector)
       SUBROUTINE DOASSEM (d, eqN, lK, lR)
       USE TYPEMOD
-      USE COMMOD, ONLY: dof, rowPtr, colPtr, R, Val
+      USE COMMOD, ONLY: dof, rowPtr, colPtr, R, Val, eq, cEq
       IMPLICIT NONE
       INTEGER(KIND=IKIND), INTENT(IN) :: d, eqN(d)
       REAL(KIND=RKIND), INTENT(IN) :: lK(dof*dof,d,d), lR(dof,d)
 
       INTEGER(KIND=IKIND) a, b, ptr, rowN, colN, left, right
 
+      IF (eq(cEq)%ls%mFree) THEN
+         CALL MFASSEM(d, eqN, lK, lR)
+         RETURN
+      END IF
+
       DO a=1, d
          rowN = eqN(a)
          IF (rowN .EQ. 0) CYCLE
@@ -296,4 +301,45 @@
 
       RETURN
       END SUBROUTINE DOASSEM
+!--------------------------------------------------------------------
+!     Matrix-free counterpart of DOASSEM. Only the residue and the
+!     diagonal of the LHS are assembled, or, while the operator is
+!     evaluated, the element tangent is applied to mfU
+      SUBROUTINE MFASSEM (d, eqN, lK, lR)
+      USE TYPEMOD
+      USE COMMOD, ONLY: dof, R, mfD, mfU, mfKU, mfApply
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: d, eqN(d)
+      REAL(KIND=RKIND), INTENT(IN) :: lK(dof*dof,d,d), lR(dof,d)
+
+      INTEGER(KIND=IKIND) a, b, i, j, rowN, colN
+
+      IF (mfApply) THEN
+         DO a=1, d
+            rowN = eqN(a)
+            IF (rowN .EQ. 0) CYCLE
+            DO b=1, d
+               colN = eqN(b)
+               IF (colN .EQ. 0) CYCLE
+               DO i=1, dof
+                  DO j=1, dof
+                     mfKU(i,rowN) = mfKU(i,rowN) +
+     2                  lK((i-1)*dof+j,a,b)*mfU(j,colN)
+                  END DO
+               END DO
+            END DO
+         END DO
+      ELSE
+         DO a=1, d
+            rowN = eqN(a)
+            IF (rowN .EQ. 0) CYCLE
+            R(:,rowN) = R(:,rowN) + lR(:,a)
+            DO i=1, dof
+               mfD(i,rowN) = mfD(i,rowN) + lK((i-1)*dof+i,a,a)
+            END DO
+         END DO
+      END IF
+
+      RETURN
+      END SUBROUTINE MFASSEM
 !####################################################################
@@ -44,13 +44,23 @@
       TYPE(listType), INTENT(INOUT) :: list
       TYPE(mshType), INTENT(INOUT) :: lM
 
+      LOGICAL :: lSvm
       INTEGER(KIND=IKIND) :: iFa, e, a, Ac
+      CHARACTER(LEN=stdL) :: fMsh
       TYPE(listType), POINTER :: lPtr, lPBC
       TYPE(fileType) :: ftmp
 
       lPtr => list%get(ftmp,"Mesh file path")
       IF (.NOT.ASSOCIATED(lPtr)) RETURN
-      CALL READVTU(lM, ftmp%fname)
+      fMsh = ftmp%fname
+      a    = LEN(TRIM(fMsh))
+      lSvm = .FALSE.
+      IF (a .GT. 4) lSvm = fMsh(a-3:a) .EQ. ".svm"
+      IF (lSvm) THEN
+         CALL READSVM(lM, fMsh)
+      ELSE
+         CALL READVTU(lM, fMsh)
+      END IF
 
       CALL SELECTELE(lM)
       IF (ichckIEN) CALL CHECKIEN(lM)
@@ -64,9 +74,16 @@
       DO iFa=1, lM%nFa
          lPBC => list%get(lM%fa(iFa)%name,"Add face",iFa)
          IF (.NOT.lM%lFib) THEN
+!           Faces of a binary mesh file are used unless a face file
+!           is given explicitly
             lPtr => lPBC%get(ftmp,"Face file path")
-            IF (.NOT.ASSOCIATED(lPtr)) err = "Face file not provided"
-            CALL READVTP(lM%fa(iFa), ftmp%fname)
+            IF (ASSOCIATED(lPtr)) THEN
+               CALL READVTP(lM%fa(iFa), ftmp%fname)
+            ELSE IF (lSvm) THEN
+               CALL READSVMFA(lM%fa(iFa), fMsh)
+            ELSE
+               err = "Face file not provided"
+            END IF
             IF (ALLOCATED(lM%fa(iFa)%x)) DEALLOCATE(lM%fa(iFa)%x)
             IF (.NOT.ALLOCATED(lM%fa(iFa)%gN)) THEN
                CALL CALCNBC(lM, lM%fa(iFa))
@@ -87,6 +104,10 @@
          CALL SELECTELEB(lM, lM%fa(iFa))
       END DO
 
+!     Converting the mesh and its faces to a binary mesh file
+      lPtr => list%get(ftmp,"Save binary mesh file path")
+      IF (ASSOCIATED(lPtr)) CALL WRITESVM(list, lM, ftmp%fname)
+
       RETURN
       END SUBROUTINE READSV
 !--------------------------------------------------------------------
@@ -121,6 +142,375 @@
       RETURN
       END SUBROUTINE READENDNLFF
 !####################################################################
+!     Binary mesh files (svm) hold the mesh and its faces in sections
+!     that are stored contiguously and can be read at their offset:
+!        header (64 bytes): "SVFSIMSH", byte order marker (=1),
+!           version, number of sections, nsd
+!        table (128 bytes per section): name (96 chars), kind (1:
+!           integer, 2: real), bytes per value, n1, n2 (8 byte int),
+!           offset of the data from the start of the file (8 byte int)
+!        data: n1 x n2 arrays in column major order, 64 bytes aligned
+!     Sections are "X", "IEN", "DOMAIN_ID_MASK", "FIB_DIR" and, for
+!     each face, "FACE_GN:<face>", "FACE_IEN:<face>", "FACE_GE:<face>".
+!     Read a mesh from a binary mesh file
+      SUBROUTINE READSVM(lM, fName)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      TYPE(mshType), INTENT(INOUT) :: lM
+      CHARACTER(LEN=*), INTENT(IN) :: fName
+
+      INTEGER(KIND=IKIND) :: fid, m, n, ios
+      INTEGER(KIND=IKIND8) :: pos
+
+      CALL SVMOPEN(fName, fid)
+
+      CALL SVMSEC(fid, "X", 2, m, lM%gnNo, pos)
+      IF (pos .LT. 0) err = "Coordinates not found in <"//
+     2   TRIM(fName)//">"
+      IF (m .NE. nsd) err = "Mismatch in num dims in <"//
+     2   TRIM(fName)//">"
+      ALLOCATE(lM%x(nsd,lM%gnNo))
+      READ(fid, POS=pos+1, IOSTAT=ios) lM%x
+      IF (ios .NE. 0) err = "Failed to read section <X> of <"//
+     2   TRIM(fName)//">"
+
+      CALL SVMSEC(fid, "IEN", 1, lM%eNoN, lM%gnEl, pos)
+      IF (pos .LT. 0) err = "Connectivity not found in <"//
+     2   TRIM(fName)//">"
+      ALLOCATE(lM%gIEN(lM%eNoN,lM%gnEl))
+      READ(fid, POS=pos+1, IOSTAT=ios) lM%gIEN
+      IF (ios .NE. 0) err = "Failed to read section <IEN> of <"//
+     2   TRIM(fName)//">"
+
+      CALL SVMSEC(fid, "DOMAIN_ID_MASK", 1, m, n, pos)
+      IF (pos .GE. 0) THEN
+         IF (rmsh%isReqd) err = "Variable domain properties is not"//
+     2      " allowed with remeshing"
+         IF (n .NE. lM%gnEl) err = "Mismatch in num elems for "//
+     2      "DOMAIN_ID_MASK"
+         ALLOCATE(lM%eId(lM%gnEl))
+         READ(fid, POS=pos+1, IOSTAT=ios) lM%eId
+         IF (ios .NE. 0) err = "Failed to read section "//
+     2      "<DOMAIN_ID_MASK> of <"//TRIM(fName)//">"
+      END IF
+
+      CALL SVMSEC(fid, "FIB_DIR", 2, m, n, pos)
+      IF (pos .GE. 0) THEN
+         IF (rmsh%isReqd) err = "Fiber directions read from "//
+     2      "file is not allowed with remeshing"
+         IF (n.NE.lM%gnEl .OR. MOD(m,nsd).NE.0) err = "Mismatch in"//
+     2      " num elems for FIB_DIR"
+         lM%nFn = m/nsd
+         ALLOCATE(lM%fN(m,lM%gnEl))
+         READ(fid, POS=pos+1, IOSTAT=ios) lM%fN
+         IF (ios .NE. 0) err = "Failed to read section <FIB_DIR>"//
+     2      " of <"//TRIM(fName)//">"
+      END IF
+      CLOSE(fid)
+
+      RETURN
+      END SUBROUTINE READSVM
+!--------------------------------------------------------------------
+!     Read a face from a binary mesh file. Similar to READVTP, face
+!     connectivity is stored with mesh node numbers.
+      SUBROUTINE READSVMFA(lFa, fName)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      TYPE(faceType), INTENT(INOUT) :: lFa
+      CHARACTER(LEN=*), INTENT(IN) :: fName
+
+      INTEGER(KIND=IKIND) :: fid, m, n, ios
+      INTEGER(KIND=IKIND8) :: pos
+
+      CALL SVMOPEN(fName, fid)
+
+      CALL SVMSEC(fid, "FACE_GN:"//TRIM(lFa%name), 1, m, lFa%nNo,
+     2   pos)
+      IF (pos .LT. 0) err = "Face <"//TRIM(lFa%name)//"> not "//
+     2   "found in <"//TRIM(fName)//">"
+      ALLOCATE(lFa%gN(lFa%nNo))
+      READ(fid, POS=pos+1, IOSTAT=ios) lFa%gN
+      IF (ios .NE. 0) err = "Failed to read section <FACE_GN:"//
+     2   TRIM(lFa%name)//"> of <"//TRIM(fName)//">"
+
+      CALL SVMSEC(fid, "FACE_IEN:"//TRIM(lFa%name), 1, lFa%eNoN,
+     2   lFa%nEl, pos)
+      IF (pos .LT. 0) err = "Face <"//TRIM(lFa%name)//"> "//
+     2   "connectivity not found in <"//TRIM(fName)//">"
+      ALLOCATE(lFa%IEN(lFa%eNoN,lFa%nEl))
+      READ(fid, POS=pos+1, IOSTAT=ios) lFa%IEN
+      IF (ios .NE. 0) err = "Failed to read section <FACE_IEN:"//
+     2   TRIM(lFa%name)//"> of <"//TRIM(fName)//">"
+
+      CALL SVMSEC(fid, "FACE_GE:"//TRIM(lFa%name), 1, m, n, pos)
+      IF (pos .GE. 0) THEN
+         IF (n .NE. lFa%nEl) err = "Mismatch in num elems for "//
+     2      "FACE_GE:"//TRIM(lFa%name)
+         ALLOCATE(lFa%gE(lFa%nEl))
+         READ(fid, POS=pos+1, IOSTAT=ios) lFa%gE
+         IF (ios .NE. 0) err = "Failed to read section <FACE_GE:"//
+     2      TRIM(lFa%name)//"> of <"//TRIM(fName)//">"
+         lFa%gnEl = lFa%nEl
+         ALLOCATE(lFa%gebc(1+lFa%eNoN,lFa%gnEl))
+         lFa%gebc(1,:) = lFa%gE(:)
+         lFa%gebc(2:1+lFa%eNoN,:) = lFa%IEN(:,:)
+      END IF
+      CLOSE(fid)
+
+      RETURN
+      END SUBROUTINE READSVMFA
+!--------------------------------------------------------------------
+!     Write a mesh and its faces to a binary mesh file. Domains and
+!     fibers given as files are included.
+      SUBROUTINE WRITESVM(list, lM, fName)
+      USE COMMOD
+      USE LISTMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      TYPE(listType), INTENT(INOUT) :: list
+      TYPE(mshType), INTENT(INOUT) :: lM
+      CHARACTER(LEN=*), INTENT(IN) :: fName
+
+      INTEGER(KIND=IKIND), PARAMETER :: hdrL = 64, entL = 128,
+     2   nmL = 96, algn = 64
+
+      LOGICAL :: flag, fDmn, fFib
+      INTEGER(KIND=IKIND) :: i, fid, nSec, iFa
+      INTEGER(KIND=IKIND8) :: off
+      CHARACTER(LEN=stdL) :: ctmp, fExt
+      TYPE(listType), POINTER :: lPtr
+      TYPE(fileType) :: fTmp
+
+      INTEGER(KIND=IKIND), ALLOCATABLE :: sKd(:), sBs(:)
+      INTEGER(KIND=IKIND8), ALLOCATABLE :: sN(:,:), sOff(:)
+      CHARACTER(LEN=nmL), ALLOCATABLE :: sNm(:)
+
+      IF (lM%lFib) err = "Binary mesh file is not supported for "//
+     2   "fiber-based mesh"
+
+!     Domains and fibers that are otherwise read in READMSH
+      fDmn = .FALSE.
+      lPtr => list%get(fTmp,"Domain file path")
+      IF (ASSOCIATED(lPtr) .AND. .NOT.ALLOCATED(lM%eId)) THEN
+         fDmn = .TRUE.
+         i = LEN(TRIM(fTmp%fname))
+         fExt = fTmp%fname(i-2:i)
+         IF (TRIM(fExt).EQ."vtp" .OR. TRIM(fExt).EQ."vtu") THEN
+            CALL SETDMNIDVTK(lM, fTmp%fname, "DOMAIN_ID")
+         ELSE
+            CALL SETDMNIDFF(lM, fTmp%open())
+         END IF
+      END IF
+
+      fFib = .FALSE.
+      IF (.NOT.ALLOCATED(lM%fN)) THEN
+         lM%nFn = list%srch("Fiber direction file path")
+         IF (lM%nFn .NE. 0) THEN
+            fFib = .TRUE.
+            ALLOCATE(lM%fN(lM%nFn*nsd,lM%gnEl))
+            lM%fN = 0._RKIND
+            DO i=1, lM%nFn
+               lPtr => list%get(ctmp, "Fiber direction file path", i)
+               CALL READFIBNFF(lM, ctmp, "FIB_DIR", i)
+            END DO
+         END IF
+      END IF
+
+!     Section table
+      nSec = 2
+      IF (ALLOCATED(lM%eId)) nSec = nSec + 1
+      IF (ALLOCATED(lM%fN)) nSec = nSec + 1
+      DO iFa=1, lM%nFa
+         nSec = nSec + 2
+         IF (ALLOCATED(lM%fa(iFa)%gE)) nSec = nSec + 1
+      END DO
+      ALLOCATE(sNm(nSec), sKd(nSec), sBs(nSec), sN(2,nSec),
+     2   sOff(nSec))
+
+      off  = INT(hdrL + nSec*entL, KIND=IKIND8)
+      nSec = 0
+      CALL ADDSEC("X", 2, nsd, lM%gnNo)
+      CALL ADDSEC("IEN", 1, lM%eNoN, lM%gnEl)
+      IF (ALLOCATED(lM%eId)) CALL ADDSEC("DOMAIN_ID_MASK", 1, 1,
+     2   lM%gnEl)
+      IF (ALLOCATED(lM%fN)) CALL ADDSEC("FIB_DIR", 2, lM%nFn*nsd,
+     2   lM%gnEl)
+      DO iFa=1, lM%nFa
+         ASSOCIATE(lFa => lM%fa(iFa))
+         CALL ADDSEC("FACE_GN:"//TRIM(lFa%name), 1, 1, lFa%nNo)
+         CALL ADDSEC("FACE_IEN:"//TRIM(lFa%name), 1, lFa%eNoN,
+     2      lFa%nEl)
+         IF (ALLOCATED(lFa%gE)) CALL ADDSEC("FACE_GE:"//
+     2      TRIM(lFa%name), 1, 1, lFa%nEl)
+         END ASSOCIATE
+      END DO
+
+      std = " Writing binary mesh file <"//TRIM(fName)//">"
+      DO fid=11, 1024
+         INQUIRE(UNIT=fid, OPENED=flag)
+         IF (.NOT.flag) EXIT
+      END DO
+      OPEN(UNIT=fid, FILE=TRIM(fName), STATUS='REPLACE',
+     2   ACCESS='STREAM', FORM='UNFORMATTED')
+      WRITE(fid, POS=1) "SVFSIMSH", 1_IKIND, 1_IKIND, nSec, nsd
+      DO i=1, nSec
+         WRITE(fid, POS=hdrL+(i-1)*entL+1) sNm(i), sKd(i), sBs(i),
+     2      sN(:,i), sOff(i)
+      END DO
+
+      i = 1
+      WRITE(fid, POS=sOff(i)+1) lM%x
+      i = i + 1
+      WRITE(fid, POS=sOff(i)+1) lM%gIEN
+      IF (ALLOCATED(lM%eId)) THEN
+         i = i + 1
+         WRITE(fid, POS=sOff(i)+1) lM%eId
+      END IF
+      IF (ALLOCATED(lM%fN)) THEN
+         i = i + 1
+         WRITE(fid, POS=sOff(i)+1) lM%fN
+      END IF
+      DO iFa=1, lM%nFa
+         i = i + 1
+         WRITE(fid, POS=sOff(i)+1) lM%fa(iFa)%gN
+         i = i + 1
+         WRITE(fid, POS=sOff(i)+1) lM%fa(iFa)%IEN
+         IF (ALLOCATED(lM%fa(iFa)%gE)) THEN
+            i = i + 1
+            WRITE(fid, POS=sOff(i)+1) lM%fa(iFa)%gE
+         END IF
+      END DO
+      CLOSE(fid)
+
+      IF (fDmn) DEALLOCATE(lM%eId)
+      IF (fFib) THEN
+         DEALLOCATE(lM%fN)
+         lM%nFn = 0
+      END IF
+
+      RETURN
+      CONTAINS
+!--------------------------------------------------------------------
+      SUBROUTINE ADDSEC(sName, dTyp, n1, n2)
+      IMPLICIT NONE
+      CHARACTER(LEN=*), INTENT(IN) :: sName
+      INTEGER(KIND=IKIND), INTENT(IN) :: dTyp, n1, n2
+
+      IF (LEN_TRIM(sName) .GT. nmL) err = "Section name <"//
+     2   TRIM(sName)//"> is too long for binary mesh file"
+
+      nSec = nSec + 1
+      sNm(nSec)  = sName
+      sKd(nSec)  = dTyp
+      sN(1,nSec) = INT(n1, KIND=IKIND8)
+      sN(2,nSec) = INT(n2, KIND=IKIND8)
+
+!     Data are aligned to algn bytes
+      off = ((off + algn - 1)/algn)*algn
+      sOff(nSec) = off
+      IF (dTyp .EQ. 1) THEN
+         sBs(nSec) = STORAGE_SIZE(0_IKIND)/8
+      ELSE
+         sBs(nSec) = STORAGE_SIZE(0._RKIND)/8
+      END IF
+      off = off + INT(sBs(nSec), KIND=IKIND8)*sN(1,nSec)*sN(2,nSec)
+
+      RETURN
+      END SUBROUTINE ADDSEC
+!--------------------------------------------------------------------
+      END SUBROUTINE WRITESVM
+!--------------------------------------------------------------------
+!     Open a binary mesh file for reading and check its header
+      SUBROUTINE SVMOPEN(fName, fid)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      CHARACTER(LEN=*), INTENT(IN) :: fName
+      INTEGER(KIND=IKIND), INTENT(OUT) :: fid
+
+      LOGICAL :: flag
+      INTEGER(KIND=IKIND) :: bom, ver, ios
+      CHARACTER(LEN=8) :: magic
+
+      INQUIRE(FILE=TRIM(fName), EXIST=flag)
+      IF (.NOT.flag) err = "File does not exist or can not be "//
+     2   "opened: "//TRIM(fName)
+
+      std = " Loading binary mesh file <"//TRIM(fName)//">"
+      DO fid=11, 1024
+         INQUIRE(UNIT=fid, OPENED=flag)
+         IF (.NOT.flag) EXIT
+      END DO
+      OPEN(UNIT=fid, FILE=TRIM(fName), STATUS='OLD', ACTION='READ',
+     2   ACCESS='STREAM', FORM='UNFORMATTED')
+
+      READ(fid, POS=1, IOSTAT=ios) magic, bom, ver
+      IF (ios .NE. 0) err = "Failed to read the header of <"//
+     2   TRIM(fName)//">"
+      IF (magic .NE. "SVFSIMSH") err = "<"//TRIM(fName)//"> is not"//
+     2   " a binary mesh file"
+      IF (bom .NE. 1) err = "Byte order of <"//TRIM(fName)//"> is"//
+     2   " not supported"
+      IF (ver .NE. 1) err = "Version of <"//TRIM(fName)//"> is not"//
+     2   " supported"
+
+      RETURN
+      END SUBROUTINE SVMOPEN
+!--------------------------------------------------------------------
+!     Find a section in a binary mesh file. Returns its size and the
+!     offset of its data, or pos < 0 if the section does not exist.
+      SUBROUTINE SVMSEC(fid, sName, dTyp, m, n, pos)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: fid, dTyp
+      CHARACTER(LEN=*), INTENT(IN) :: sName
+      INTEGER(KIND=IKIND), INTENT(OUT) :: m, n
+      INTEGER(KIND=IKIND8), INTENT(OUT) :: pos
+
+      INTEGER(KIND=IKIND), PARAMETER :: hdrL = 64, entL = 128,
+     2   nmL = 96
+
+      INTEGER(KIND=IKIND) :: i, nSec, sKd, sBs, nb, ios
+      INTEGER(KIND=IKIND8) :: n1, n2, off
+      CHARACTER(LEN=nmL) :: tName
+      CHARACTER(LEN=stdL) :: fName
+
+      INQUIRE(UNIT=fid, NAME=fName)
+      IF (dTyp .EQ. 1) THEN
+         nb = STORAGE_SIZE(0_IKIND)/8
+      ELSE
+         nb = STORAGE_SIZE(0._RKIND)/8
+      END IF
+
+      m   = 0
+      n   = 0
+      pos = -1
+      READ(fid, POS=17, IOSTAT=ios) nSec
+      IF (ios .NE. 0) err = "Failed to read the header of <"//
+     2   TRIM(fName)//">"
+      DO i=1, nSec
+         READ(fid, POS=hdrL+(i-1)*entL+1, IOSTAT=ios) tName, sKd, sBs,
+     2      n1, n2, off
+         IF (ios .NE. 0) err = "Failed to read the section table of <"
+     2      //TRIM(fName)//">"
+         IF (tName .NE. sName) CYCLE
+         IF (sKd.NE.dTyp .OR. sBs.NE.nb) err = "Unexpected data type"//
+     2      " for section <"//TRIM(sName)//"> of <"//TRIM(fName)//">"
+         IF (n1.LT.0 .OR. n2.LT.0 .OR. off.LT.0 .OR.
+     2      n1.GT.HUGE(m) .OR. n2.GT.HUGE(n)) err = "Corrupt entry "//
+     3      "for section <"//TRIM(sName)//"> of <"//TRIM(fName)//">"
+         m   = INT(n1, KIND=IKIND)
+         n   = INT(n2, KIND=IKIND)
+         pos = off
+         EXIT
+      END DO
+
+      RETURN
+      END SUBROUTINE SVMSEC
+!####################################################################
 !     This reads coordinate, connectivity, and ebc/vtk files
       SUBROUTINE READCCNE(list, lM)
       USE COMMOD
@@ -45,7 +45,13 @@
       ALLOCATE (R(dof,tnNo))
       R(:,:) = 0._RKIND
 
-      IF (.NOT.lEq%assmTLS) THEN
+      IF (lEq%ls%mFree) THEN
+         IF (ALLOCATED(mfD)) DEALLOCATE(mfD, mfU, mfKU)
+         ALLOCATE(mfD(dof,tnNo), mfU(dof,tnNo), mfKU(dof,tnNo))
+         mfD(:,:) = 0._RKIND
+         IF (.NOT.ALLOCATED(mfAg)) ALLOCATE(mfAg(tDof,tnNo),
+     2      mfYg(tDof,tnNo), mfDg(tDof,tnNo))
+      ELSE IF (.NOT.lEq%assmTLS) THEN
          IF (ALLOCATED(Val)) DEALLOCATE(Val)
          ALLOCATE (Val(dof*dof,lhs%nnz))
          Val(:,:) = 0._RKIND
@@ -73,9 +79,22 @@
       INTEGER(KIND=IKIND), INTENT(IN) :: incL(nFacesLS)
       REAL(KIND=RKIND), INTENT(IN) :: res(nFacesLS)
 
+      EXTERNAL MFMATVEC
 #ifdef WITH_TRILINOS
       INTEGER(KIND=IKIND) a
+#endif
+
+!     First nonlinear iteration of the time step, the inexact Newton
+!     tolerance starts from its upper bound
+      IF (lEq%itr .EQ. 0) lEq%FSILS%ewN = 0._RKIND
+
+      IF (lEq%ls%mFree) THEN
+         CALL FSILS_MFSOLVE(lhs, lEq%FSILS, dof, R, mfD, MFMATVEC,
+     2      incL=incL, res=res)
+         RETURN
+      END IF
 
+#ifdef WITH_TRILINOS
       IF (lEq%useTLS) CALL INIT_DIR_AND_COUPNEU_BC(incL, res)
 
       IF (lEq%assmTLS) THEN
@@ -109,6 +128,35 @@
 
       RETURN
       END SUBROUTINE LSSOLVE
+!--------------------------------------------------------------------
+!     Product of the LHS with U for the matrix-free linear solver. The
+!     element tangents are recomputed about the saved state and applied
+!     to U in DOASSEM, so anything contributing to the LHS has to go
+!     through DOASSEM.
+      SUBROUTINE MFMATVEC(lDof, nNo, U, KU)
+      USE COMMOD
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: lDof, nNo
+      REAL(KIND=RKIND), INTENT(IN) :: U(lDof,nNo)
+      REAL(KIND=RKIND), INTENT(OUT) :: KU(lDof,nNo)
+
+      INTEGER(KIND=IKIND) iM
+
+      mfU(:,:)  = U(:,:)
+      mfKU(:,:) = 0._RKIND
+
+      mfApply = .TRUE.
+      DO iM=1, nMsh
+         CALL GLOBALEQASSEM(msh(iM), mfAg, mfYg, mfDg)
+      END DO
+      CALL SETBCNEU(mfYg, mfDg)
+      CALL SETBCDIRW(mfYg, mfDg)
+      mfApply = .FALSE.
+
+      KU(:,:) = mfKU(:,:)
+
+      RETURN
+      END SUBROUTINE MFMATVEC
 !--------------------------------------------------------------------
       SUBROUTINE INIT_DIR_AND_COUPNEU_BC(incL, res)
       USE COMMOD
@@ -82,6 +82,12 @@
       ALLOCATE(Ag(tDof,tnNo), Yg(tDof,tnNo), Dg(tDof,tnNo),
      2   res(nFacesLS), incL(nFacesLS))
 
+!     Averages are accumulated during the time loop
+      IF (saveAve) CALL AVEINIT(Ao, Yo, Do)
+
+!     Locating the output probes
+      IF (nPrb .GT. 0) CALL PRBINIT()
+
 !--------------------------------------------------------------------
 !     Outer loop for marching in time. When entring this loop, all old
 !     variables are completely set and satisfy BCs.
@@ -187,6 +193,13 @@
                END IF
             END DO
 
+!        The matrix-free operator is linearized about this state
+            IF (eq(cEq)%ls%mFree) THEN
+               mfAg = Ag
+               mfYg = Yg
+               mfDg = Dg
+            END IF
+
             dbg = "Solving equation <"//eq(cEq)%sym//">"
             CALL LSSOLVE(eq(cEq), incL, res)
 
@@ -213,6 +226,10 @@
             END IF
          END IF
 
+!     Post-processed fields are shared by the TXT and VTK outputs of
+!     this time step
+         CALL PSTCACHE(.TRUE.)
+
 !     Saving the TXT files containing average and fluxes
          CALL TXT(.FALSE.)
 
@@ -225,6 +242,7 @@
                rmsh%A0(:,:) = Ao(:,:)
                rmsh%Y0(:,:) = Yo(:,:)
                rmsh%D0(:,:) = Do(:,:)
+               IF (rmsh%ovlp) CALL REMESHAHEAD()
             END IF
          END IF
 
@@ -259,6 +277,13 @@
          ELSE
             CALL OUTRESULT(timeP, 2, iEqOld)
          END IF
+         IF (ave%strm) THEN
+            l2 = MOD(cTS,saveIncr) .EQ. 0
+            l3 = cTS .GE. saveATS
+            IF (l2 .AND. l3) CALL AVESTEP(An, Yn, Dn)
+         END IF
+         IF (nPrb .GT. 0) CALL PRBOUT(An, Yn, Dn)
+         CALL PSTCACHE(.FALSE.)
          IF (pstEq) CALL OUTDNORM()
 
          IF (ibFlag) CALL IB_OUTCPUT()
@@ -287,6 +312,7 @@
       IF (l1 .AND. saveAve) CALL CALCAVE
 
       DEALLOCATE(Ag, Yg, Dg, incL, res)
+      IF (rmsh%ovlp) CALL REMESHDROP()
       CALL FINALIZE()
       CALL MPI_FINALIZE(ierr)
 
@@ -43,6 +43,11 @@
 
       INTEGER(KIND=IKIND), ALLOCATABLE :: t_ind(:,:)
 
+!     Voigt index maps, (i,j) of the symmetric tensor components
+      INTEGER(KIND=IKIND), PARAMETER :: v3_i(6) = (/1, 2, 3, 1, 2, 3/),
+     2   v3_j(6) = (/1, 2, 3, 2, 3, 1/), v2_i(3) = (/1, 2, 1/),
+     3   v2_j(3) = (/1, 2, 2/)
+
       PRIVATE :: ISZERO
 
       INTERFACE TEN_DDOT
@@ -417,28 +422,6 @@
       RETURN
       END FUNCTION TEN_DYADPROD
 !--------------------------------------------------------------------
-!     Create a 4th order tensor from symmetric outer product of two
-!     matrices
-      FUNCTION TEN_SYMMPROD(A, B, nd) RESULT(C)
-      IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: nd
-      REAL(KIND=RKIND), INTENT(IN) :: A(nd,nd), B(nd,nd)
-      REAL(KIND=RKIND) :: C(nd,nd,nd,nd)
-
-      INTEGER(KIND=IKIND) :: ii, nn, i, j, k, l
-
-      nn = nd**4
-      DO ii=1, nn
-         i = t_ind(1,ii)
-         j = t_ind(2,ii)
-         k = t_ind(3,ii)
-         l = t_ind(4,ii)
-         C(i,j,k,l) = 0.5_RKIND * ( A(i,k)*B(j,l) + A(i,l)*B(j,k) )
-      END DO
-
-      RETURN
-      END FUNCTION TEN_SYMMPROD
-!--------------------------------------------------------------------
 !     Transpose of a 4th order tensor [A^T]_ijkl = [A]_klij
       FUNCTION TEN_TRANSPOSE(A, nd) RESULT(B)
       IMPLICIT NONE
@@ -535,92 +518,158 @@
 
       RETURN
       END FUNCTION TEN_DDOT_3434
+!####################################################################
+!     Symmetric 4th order tensors in Voigt notation, i.e. as matrices of
+!     rank 3*(nd-1) ordered by the index maps v3_i/v3_j (v2_i/v2_j in
+!     2D). These avoid forming the full nd^4 tensors in the material
+!     models.
 !--------------------------------------------------------------------
-!     T_ijkl = A_ijmn * B_kmln
-      FUNCTION TEN_DDOT_3424(A, B, nd) RESULT(C)
+!     Voigt vector of a symmetric matrix
+      FUNCTION VGT_VEC(A, nd) RESULT(v)
       IMPLICIT NONE
       INTEGER(KIND=IKIND), INTENT(IN) :: nd
-      REAL(KIND=RKIND), INTENT(IN) :: A(nd,nd,nd,nd), B(nd,nd,nd,nd)
-      REAL(KIND=RKIND) :: C(nd,nd,nd,nd)
-
-      INTEGER(KIND=IKIND) :: ii, nn, i, j, k, l
+      REAL(KIND=RKIND), INTENT(IN) :: A(nd,nd)
+      REAL(KIND=RKIND) :: v(3*(nd-1))
+
+      IF (nd .EQ. 3) THEN
+         v(1) = A(1,1)
+         v(2) = A(2,2)
+         v(3) = A(3,3)
+         v(4) = A(1,2)
+         v(5) = A(2,3)
+         v(6) = A(3,1)
+      ELSE
+         v(1) = A(1,1)
+         v(2) = A(2,2)
+         v(3) = A(1,2)
+      END IF
 
-      C  = 0._RKIND
-      nn = nd**4
-      IF (nd .EQ. 2) THEN
-         DO ii=1, nn
-            i = t_ind(1,ii)
-            j = t_ind(2,ii)
-            k = t_ind(3,ii)
-            l = t_ind(4,ii)
-            C(i,j,k,l) = C(i,j,k,l) + A(i,j,1,1)*B(k,1,l,1)
-     2                              + A(i,j,1,2)*B(k,1,l,2)
-     3                              + A(i,j,2,1)*B(k,2,l,1)
-     4                              + A(i,j,2,2)*B(k,2,l,2)
+      RETURN
+      END FUNCTION VGT_VEC
+!--------------------------------------------------------------------
+!     Symmetric outer product of two symmetric matrices in Voigt
+!     notation, D_ijkl = (A_ik*B_jl + A_il*B_jk)/2
+      FUNCTION VGT_SYMMPROD(A, B, nd) RESULT(D)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: nd
+      REAL(KIND=RKIND), INTENT(IN) :: A(nd,nd), B(nd,nd)
+      REAL(KIND=RKIND) :: D(3*(nd-1),3*(nd-1))
+
+      INTEGER(KIND=IKIND) :: ii, jj, i, j, k, l
+
+      IF (nd .EQ. 3) THEN
+         DO jj=1, 6
+            k = v3_i(jj)
+            l = v3_j(jj)
+            DO ii=1, 6
+               i = v3_i(ii)
+               j = v3_j(ii)
+               D(ii,jj) = 0.5_RKIND*(A(i,k)*B(j,l) + A(i,l)*B(j,k))
+            END DO
          END DO
       ELSE
-         DO ii=1, nn
-            i = t_ind(1,ii)
-            j = t_ind(2,ii)
-            k = t_ind(3,ii)
-            l = t_ind(4,ii)
-            C(i,j,k,l) = C(i,j,k,l) + A(i,j,1,1)*B(k,1,l,1)
-     2                              + A(i,j,1,2)*B(k,1,l,2)
-     3                              + A(i,j,1,3)*B(k,1,l,3)
-     4                              + A(i,j,2,1)*B(k,2,l,1)
-     5                              + A(i,j,2,2)*B(k,2,l,2)
-     6                              + A(i,j,2,3)*B(k,2,l,3)
-     7                              + A(i,j,3,1)*B(k,3,l,1)
-     8                              + A(i,j,3,2)*B(k,3,l,2)
-     9                              + A(i,j,3,3)*B(k,3,l,3)
+         DO jj=1, 3
+            k = v2_i(jj)
+            l = v2_j(jj)
+            DO ii=1, 3
+               i = v2_i(ii)
+               j = v2_j(ii)
+               D(ii,jj) = 0.5_RKIND*(A(i,k)*B(j,l) + A(i,l)*B(j,k))
+            END DO
          END DO
       END IF
 
       RETURN
-      END FUNCTION TEN_DDOT_3424
+      END FUNCTION VGT_SYMMPROD
 !--------------------------------------------------------------------
-!     T_ijkl = A_imjn * B_mnkl
-      FUNCTION TEN_DDOT_2412(A, B, nd) RESULT(C)
+!     4th order symmetric identity tensor, same as TEN_IDs, in Voigt
+!     notation
+      FUNCTION VGT_IDs(nd) RESULT(D)
       IMPLICIT NONE
       INTEGER(KIND=IKIND), INTENT(IN) :: nd
-      REAL(KIND=RKIND), INTENT(IN) :: A(nd,nd,nd,nd), B(nd,nd,nd,nd)
-      REAL(KIND=RKIND) :: C(nd,nd,nd,nd)
+      REAL(KIND=RKIND) :: D(3*(nd-1),3*(nd-1))
 
-      INTEGER(KIND=IKIND) :: ii, nn, i, j, k, l
+      INTEGER(KIND=IKIND) :: i
 
-      C  = 0._RKIND
-      nn = nd**4
-      IF (nd .EQ. 2) THEN
-         DO ii=1, nn
-            i = t_ind(1,ii)
-            j = t_ind(2,ii)
-            k = t_ind(3,ii)
-            l = t_ind(4,ii)
-            C(i,j,k,l) = C(i,j,k,l) + A(i,1,j,1)*B(1,1,k,l)
-     2                              + A(i,1,j,2)*B(1,2,k,l)
-     3                              + A(i,2,j,1)*B(2,1,k,l)
-     4                              + A(i,2,j,2)*B(2,2,k,l)
+      D = 0._RKIND
+      DO i=1, nd
+         D(i,i) = 1._RKIND
+      END DO
+      DO i=nd+1, 3*(nd-1)
+         D(i,i) = 0.5_RKIND
+      END DO
+
+      RETURN
+      END FUNCTION VGT_IDs
+!--------------------------------------------------------------------
+!     Isochoric projection of an elasticity tensor, D := PP:D:PP^T with
+!     PP = IDs - 1/nd (Ci x C). Since D has minor symmetries, this is a
+!     rank two update of D.
+      SUBROUTINE VGT_PROJ(D, C, Ci, nd)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: nd
+      REAL(KIND=RKIND), INTENT(IN) :: C(nd,nd), Ci(nd,nd)
+      REAL(KIND=RKIND), INTENT(INOUT) :: D(3*(nd-1),3*(nd-1))
+
+      INTEGER(KIND=IKIND) :: i, j, n
+      REAL(KIND=RKIND) :: r1, cw(3*(nd-1)), vCi(3*(nd-1)),
+     2   DC(3*(nd-1)), CD(3*(nd-1))
+
+      n   = 3*(nd-1)
+      r1  = 1._RKIND/REAL(nd, KIND=RKIND)
+      vCi = VGT_VEC(Ci, nd)
+
+!     Shear components appear twice in the contractions with C
+      cw  = VGT_VEC(C, nd)
+      cw(nd+1:n) = 2._RKIND*cw(nd+1:n)
+      DC  = MATMUL(D, cw)
+      CD  = MATMUL(cw, D)
+      r1  = r1*r1*DOT_PRODUCT(cw, DC)
+      DO j=1, n
+         DO i=1, n
+            D(i,j) = D(i,j) + r1*vCi(i)*vCi(j) - (DC(i)*vCi(j) +
+     2         vCi(i)*CD(j))/REAL(nd, KIND=RKIND)
          END DO
-      ELSE
-         DO ii=1, nn
-            i = t_ind(1,ii)
-            j = t_ind(2,ii)
-            k = t_ind(3,ii)
-            l = t_ind(4,ii)
-            C(i,j,k,l) = C(i,j,k,l) + A(i,1,j,1)*B(1,1,k,l)
-     2                              + A(i,1,j,2)*B(1,2,k,l)
-     3                              + A(i,1,j,3)*B(1,3,k,l)
-     4                              + A(i,2,j,1)*B(2,1,k,l)
-     5                              + A(i,2,j,2)*B(2,2,k,l)
-     6                              + A(i,2,j,3)*B(2,3,k,l)
-     7                              + A(i,3,j,1)*B(3,1,k,l)
-     8                              + A(i,3,j,2)*B(3,2,k,l)
-     9                              + A(i,3,j,3)*B(3,3,k,l)
+      END DO
+
+      RETURN
+      END SUBROUTINE VGT_PROJ
+!--------------------------------------------------------------------
+!     Push forward of an elasticity tensor with F, i.e.
+!     D_ijkl := F_im F_jn D_mnpq F_kp F_lq, as D := T D T^T
+      SUBROUTINE VGT_PUSH(D, F, nd)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: nd
+      REAL(KIND=RKIND), INTENT(IN) :: F(nd,nd)
+      REAL(KIND=RKIND), INTENT(INOUT) :: D(3*(nd-1),3*(nd-1))
+
+      INTEGER(KIND=IKIND) :: ii, jj, i, j, m, n
+      REAL(KIND=RKIND) :: T(3*(nd-1),3*(nd-1))
+
+      DO jj=1, 3*(nd-1)
+         IF (nd .EQ. 3) THEN
+            m = v3_i(jj)
+            n = v3_j(jj)
+         ELSE
+            m = v2_i(jj)
+            n = v2_j(jj)
+         END IF
+         DO ii=1, 3*(nd-1)
+            IF (nd .EQ. 3) THEN
+               i = v3_i(ii)
+               j = v3_j(ii)
+            ELSE
+               i = v2_i(ii)
+               j = v2_j(ii)
+            END IF
+            T(ii,jj) = F(i,m)*F(j,n)
+            IF (m .NE. n) T(ii,jj) = T(ii,jj) + F(i,n)*F(j,m)
          END DO
-      END IF
+      END DO
+      D = MATMUL(T, MATMUL(D, TRANSPOSE(T)))
 
       RETURN
-      END FUNCTION TEN_DDOT_2412
+      END SUBROUTINE VGT_PUSH
 !--------------------------------------------------------------------
       FUNCTION ISZERO(ia)
       IMPLICIT NONE
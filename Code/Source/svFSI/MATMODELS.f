@@ -37,9 +37,9 @@
 !--------------------------------------------------------------------
 
 !     Compute 2nd Piola-Kirchhoff stress and material stiffness tensors
-!     including both dilational and isochoric components
+!     including both dilational and isochoric components. The stiffness
+!     is built directly in Voigt notation.
       SUBROUTINE GETPK2CC(lDmn, F, nfd, fl, ya, S, Dm)
-      USE MATFUN
       USE COMMOD
       IMPLICIT NONE
       TYPE(dmnType), INTENT(IN) :: lDmn
@@ -47,67 +47,177 @@
       REAL(KIND=RKIND), INTENT(IN) :: F(nsd,nsd), fl(nsd,nfd), ya
       REAL(KIND=RKIND), INTENT(OUT) :: S(nsd,nsd), Dm(nsymd,nsymd)
 
+      REAL(KIND=RKIND) :: yv(1), Ja(1)
+
+      yv(1) = ya
+      CALL GETPK2CCv(lDmn, .FALSE., 1, F, nfd, fl, yv, S, Dm, Ja)
+
+      RETURN
+      END SUBROUTINE GETPK2CC
+!--------------------------------------------------------------------
+!     Batched version of GETPK2CC/GETPK2CCdev evaluated at nP points
+!     sharing the same material, e.g. all the Gauss points of an
+!     element. The material model is dispatched once for the whole
+!     batch and the kinematic quantities are computed in a single pass
+!     over the points. If lDev is true, only the isochoric components
+!     are computed (GETPK2CCdev) and Ja is the determinant of the active
+!     deformation gradient.
+      SUBROUTINE GETPK2CCv(lDmn, lDev, nP, F, nfd, fl, ya, S, Dm, Ja)
+      USE MATFUN
+      USE COMMOD
+      IMPLICIT NONE
+      TYPE(dmnType), INTENT(IN) :: lDmn
+      LOGICAL, INTENT(IN) :: lDev
+      INTEGER(KIND=IKIND), INTENT(IN) :: nP, nfd
+      REAL(KIND=RKIND), INTENT(IN) :: F(nsd,nsd,nP), fl(nsd,nfd,nP),
+     2   ya(nP)
+      REAL(KIND=RKIND), INTENT(OUT) :: S(nsd,nsd,nP),
+     2   Dm(nsymd,nsymd,nP), Ja(nP)
+
       TYPE(stModelType) :: stM
-      REAL(KIND=RKIND) :: nd, Kp, J, J2d, J4d, trE, p, pl, Inv1, Inv2,
-     2   Inv4, Inv6, Inv8, Tfa, IDm(nsd,nsd), C(nsd,nsd), E(nsd,nsd),
-     3   Ci(nsd,nsd), Sb(nsd,nsd), CCb(nsd,nsd,nsd,nsd),
-     3   PP(nsd,nsd,nsd,nsd), CC(nsd,nsd,nsd,nsd)
-      REAL(KIND=RKIND) :: r1, r2, g1, g2, g3
+      INTEGER(KIND=IKIND) :: g, i
+      REAL(KIND=RKIND) :: nd, Kp, Tf0, J4d, trE, Inv4, Inv6, Inv8,
+     2   IDm(nsd,nsd), E(nsd,nsd), Sb(nsd,nsd), Fa(nsd,nsd), vI(nsymd),
+     3   vCi(nsymd), vS(nsymd), vH(nsymd)
+      REAL(KIND=RKIND) :: r2, g1, g2, g3
 !     Guccione
-      REAL(KIND=RKIND) :: QQ, Rm(nsd,nsd), Es(nsd,nsd), RmRm(nsd,nsd,6)
+      REAL(KIND=RKIND) :: QQ, Rm(nsd,nsd), Es(nsd,nsd), RmRm(nsd,nsd,6),
+     2   vR(nsymd,6)
 !     HGO/HO model
       REAL(KIND=RKIND) :: Eff, Ess, Efs, kap, Hff(nsd,nsd),
-     4   Hss(nsd,nsd), Hfs(nsd,nsd)
-!     Active strain for electromechanics
-      REAL(KIND=RKIND) :: Fe(nsd,nsd), Fa(nsd,nsd), Fai(nsd,nsd)
+     2   Hss(nsd,nsd), Hfs(nsd,nsd)
+!     Kinematics and scalar coefficients at each point of the batch
+      REAL(KIND=RKIND) :: J(nP), J2d(nP), Inv1(nP), Tfa(nP), p(nP),
+     2   pl(nP), r1(nP), Fe(nsd,nsd,nP), Fai(nsd,nsd,nP), C(nsd,nsd,nP),
+     3   Ci(nsd,nsd,nP), Db(nsymd,nsymd,nP)
 
       S    = 0._RKIND
       Dm   = 0._RKIND
+      Db   = 0._RKIND
+      r1   = 0._RKIND
 
-!     Some preliminaries
+!     Some preliminaries, common to all the points
       stM  = lDmn%stM
       nd   = REAL(nsd, KIND=RKIND)
       Kp   = stM%Kpen
+      IDm  = MAT_ID(nsd)
+      vI   = VGT_VEC(IDm, nsd)
+
+      IF (lDev) THEN
+         SELECT CASE (stM%isoType)
+         CASE (stIso_nHook, stIso_MR, stIso_HGO, stIso_Gucci, stIso_HO)
+         CASE DEFAULT
+            err = "Undefined isochoric material constitutive model"
+         END SELECT
+      END IF
+
+      SELECT CASE (stM%isoType)
+      CASE (stIso_HGO)
+         IF (nfd .NE. 2) err = "Min fiber directions not defined for "//
+     2      "HGO material model (2)"
+      CASE (stIso_Gucci)
+         IF (nfd .NE. 2) err = "Min fiber directions not defined for "//
+     2      "Guccione material model (2)"
+      CASE (stIso_HO)
+         IF (nfd .NE. 2) err = "Min fiber directions not defined for "//
+     2      "Holzapfel material model (2)"
+      END SELECT
 
 !     Fiber-reinforced stress
-      CALL GETFIBSTRESS(stM%Tf, Tfa)
+      CALL GETFIBSTRESS(stM%Tf, Tf0)
 
 !     Electromechanics coupling - active stress
+      Tfa = Tf0
       IF (cem%aStress) Tfa = Tfa + ya
 
 !     Electromechanics coupling - active strain
       Fe   = F
-      Fa   = MAT_ID(nsd)
-      Fai  = Fa
+      Ja   = 1._RKIND
       IF (cem%aStrain) THEN
-         CALL ACTVSTRAIN(ya, nfd, fl, Fa)
-         Fai  = MAT_INV(Fa, nsd)
-         Fe   = MATMUL(F, Fai)
+         DO g=1, nP
+            Fa = IDm
+            CALL ACTVSTRAIN(ya(g), nfd, fl(:,:,g), Fa)
+            Fai(:,:,g) = MAT_INV(Fa, nsd)
+            Fe(:,:,g)  = MATMUL(F(:,:,g), Fai(:,:,g))
+            Ja(g)      = MAT_DET(Fa, nsd)
+         END DO
       END IF
 
-      J    = MAT_DET(Fe, nsd)
-      J2d  = J**(-2._RKIND/nd)
-      J4d  = J2d*J2d
-
-      IDm  = MAT_ID(nsd)
-      C    = MATMUL(TRANSPOSE(Fe), Fe)
-      E    = 0.5_RKIND * (C - IDm)
-      Ci   = MAT_INV(C, nsd)
+!     Right Cauchy-Green tensor, its inverse and the Jacobian using
+!     closed-form expressions for nsd = 2, 3
+      IF (nsd .EQ. 3) THEN
+         DO g=1, nP
+            J(g) = Fe(1,1,g)*(Fe(2,2,g)*Fe(3,3,g)-Fe(2,3,g)*Fe(3,2,g))
+     2           + Fe(1,2,g)*(Fe(2,3,g)*Fe(3,1,g)-Fe(2,1,g)*Fe(3,3,g))
+     3           + Fe(1,3,g)*(Fe(2,1,g)*Fe(3,2,g)-Fe(2,2,g)*Fe(3,1,g))
+
+            C(1,1,g) = Fe(1,1,g)*Fe(1,1,g) + Fe(2,1,g)*Fe(2,1,g) +
+     2                 Fe(3,1,g)*Fe(3,1,g)
+            C(2,2,g) = Fe(1,2,g)*Fe(1,2,g) + Fe(2,2,g)*Fe(2,2,g) +
+     2                 Fe(3,2,g)*Fe(3,2,g)
+            C(3,3,g) = Fe(1,3,g)*Fe(1,3,g) + Fe(2,3,g)*Fe(2,3,g) +
+     2                 Fe(3,3,g)*Fe(3,3,g)
+            C(1,2,g) = Fe(1,1,g)*Fe(1,2,g) + Fe(2,1,g)*Fe(2,2,g) +
+     2                 Fe(3,1,g)*Fe(3,2,g)
+            C(2,3,g) = Fe(1,2,g)*Fe(1,3,g) + Fe(2,2,g)*Fe(2,3,g) +
+     2                 Fe(3,2,g)*Fe(3,3,g)
+            C(1,3,g) = Fe(1,1,g)*Fe(1,3,g) + Fe(2,1,g)*Fe(2,3,g) +
+     2                 Fe(3,1,g)*Fe(3,3,g)
+            C(2,1,g) = C(1,2,g)
+            C(3,2,g) = C(2,3,g)
+            C(3,1,g) = C(1,3,g)
+
+            g1 = 1._RKIND / (J(g)*J(g))
+            Ci(1,1,g) = g1*(C(2,2,g)*C(3,3,g) - C(2,3,g)*C(2,3,g))
+            Ci(2,2,g) = g1*(C(1,1,g)*C(3,3,g) - C(1,3,g)*C(1,3,g))
+            Ci(3,3,g) = g1*(C(1,1,g)*C(2,2,g) - C(1,2,g)*C(1,2,g))
+            Ci(1,2,g) = g1*(C(1,3,g)*C(2,3,g) - C(1,2,g)*C(3,3,g))
+            Ci(2,3,g) = g1*(C(1,2,g)*C(1,3,g) - C(1,1,g)*C(2,3,g))
+            Ci(1,3,g) = g1*(C(1,2,g)*C(2,3,g) - C(1,3,g)*C(2,2,g))
+            Ci(2,1,g) = Ci(1,2,g)
+            Ci(3,2,g) = Ci(2,3,g)
+            Ci(3,1,g) = Ci(1,3,g)
+         END DO
+      ELSE
+         DO g=1, nP
+            J(g) = Fe(1,1,g)*Fe(2,2,g) - Fe(1,2,g)*Fe(2,1,g)
+
+            C(1,1,g) = Fe(1,1,g)*Fe(1,1,g) + Fe(2,1,g)*Fe(2,1,g)
+            C(2,2,g) = Fe(1,2,g)*Fe(1,2,g) + Fe(2,2,g)*Fe(2,2,g)
+            C(1,2,g) = Fe(1,1,g)*Fe(1,2,g) + Fe(2,1,g)*Fe(2,2,g)
+            C(2,1,g) = C(1,2,g)
+
+            g1 = 1._RKIND / (J(g)*J(g))
+            Ci(1,1,g) =  g1*C(2,2,g)
+            Ci(2,2,g) =  g1*C(1,1,g)
+            Ci(1,2,g) = -g1*C(1,2,g)
+            Ci(2,1,g) = Ci(1,2,g)
+         END DO
+      END IF
 
-      trE  = MAT_TRACE(E, nsd)
-      Inv1 = J2d*MAT_TRACE(C,nsd)
-      Inv2 = 0.5_RKIND*( Inv1*Inv1 - J4d*MAT_TRACE(MATMUL(C,C), nsd) )
+      DO g=1, nP
+         J2d(g)  = J(g)**(-2._RKIND/nd)
+         Inv1(g) = J2d(g)*MAT_TRACE(C(:,:,g), nsd)
+      END DO
 
 !     Contribution of dilational penalty terms to S and CC
       p  = 0._RKIND
       pl = 0._RKIND
-      IF (.NOT.ISZERO(Kp)) CALL GETSVOLP(stM, J, p, pl)
+      IF (.NOT.lDev .AND. .NOT.ISZERO(Kp)) THEN
+         DO g=1, nP
+            CALL GETSVOLP(stM, J(g), p(g), pl(g))
+         END DO
+      END IF
 
-!     Now, compute isochoric and total stress, elasticity tensors
+!     Now, compute isochoric and total stress, elasticity tensors. For
+!     the hyperelastic models, Db is the fictitious elasticity tensor
+!     that is projected below.
       SELECT CASE (stM%isoType)
       CASE (stIso_lin)
          g1 = stM%C10            ! mu
-         S  = g1*Idm
+         DO g=1, nP
+            S(:,:,g) = g1*IDm
+         END DO
          RETURN
 
 !     St.Venant-Kirchhoff
@@ -115,261 +225,294 @@
          g1 = stM%C10            ! lambda
          g2 = stM%C01 * 2._RKIND      ! 2*mu
 
-         S  = g1*trE*IDm + g2*E
-         CC = g1*TEN_DYADPROD(IDm, IDm, nsd) + g2*TEN_IDs(nsd)
+         DO g=1, nP
+            E   = 0.5_RKIND * (C(:,:,g) - IDm)
+            trE = MAT_TRACE(E, nsd)
+            S(:,:,g)  = g1*trE*IDm + g2*E
+            Dm(:,:,g) = g1*MAT_DYADPROD(vI, vI, nsymd) +
+     2         g2*VGT_IDs(nsd)
+         END DO
+         RETURN
 
 !     modified St.Venant-Kirchhoff
       CASE (stIso_mStVK)
          g1 = stM%C10 ! kappa
          g2 = stM%C01 ! mu
 
-         S  = g1*LOG(J)*Ci + g2*(C-IDm)
-         CC = g1 * ( -2._RKIND*LOG(J)*TEN_SYMMPROD(Ci, Ci, nsd) +
-     2      TEN_DYADPROD(Ci, Ci, nsd) ) + 2._RKIND*g2*TEN_IDs(nsd)
+         DO g=1, nP
+            vCi = VGT_VEC(Ci(:,:,g), nsd)
+            S(:,:,g)  = g1*LOG(J(g))*Ci(:,:,g) + g2*(C(:,:,g)-IDm)
+            Dm(:,:,g) = g1 * ( MAT_DYADPROD(vCi, vCi, nsymd) -
+     2         2._RKIND*LOG(J(g))*VGT_SYMMPROD(Ci(:,:,g), Ci(:,:,g),
+     3         nsd) ) + 2._RKIND*g2*VGT_IDs(nsd)
+         END DO
+         RETURN
 
 !     NeoHookean model
       CASE (stIso_nHook)
          g1 = 2._RKIND * stM%C10
-         Sb = g1*IDm
-
-!        Fiber reinforcement/active stress
-         Sb = Sb + Tfa*MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
+         DO g=1, nP
+            Sb = g1*IDm
 
-         r1 = g1*Inv1/nd
-         S  = J2d*Sb - r1*Ci
-         CC = (-2._RKIND/nd) * ( TEN_DYADPROD(Ci, S, nsd) +
-     2                      TEN_DYADPROD(S, Ci, nsd))
+!           Fiber reinforcement/active stress
+            Sb = Sb + Tfa(g)*MAT_DYADPROD(fl(:,1,g), fl(:,1,g), nsd)
 
-         S  = S + p*J*Ci
-         CC = CC + 2._RKIND*(r1 - p*J) * TEN_SYMMPROD(Ci, Ci, nsd) +
-     2         (pl*J - 2._RKIND*r1/nd) * TEN_DYADPROD(Ci, Ci, nsd)
+            r1(g) = g1*Inv1(g)/nd
+            S(:,:,g) = J2d(g)*Sb - r1(g)*Ci(:,:,g)
+         END DO
 
 !     Mooney-Rivlin model
       CASE (stIso_MR)
-         g1  = 2._RKIND * (stM%C10 + Inv1*stM%C01)
-         g2  = -2._RKIND * stM%C01
-         Sb  = g1*IDm + g2*J2d*C
-
-!        Fiber reinforcement/active stress
-         Sb  = Sb + Tfa*MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
-
-         g1  = 4._RKIND*J4d* stM%C01
-         CCb = g1 * (TEN_DYADPROD(IDm, IDm, nsd) - TEN_IDs(nsd))
+         DO g=1, nP
+            J4d = J2d(g)*J2d(g)
+            g1  = 2._RKIND * (stM%C10 + Inv1(g)*stM%C01)
+            g2  = -2._RKIND * stM%C01
+            Sb  = g1*IDm + g2*J2d(g)*C(:,:,g)
 
-         r1  = J2d*MAT_DDOT(C, Sb, nsd) / nd
-         S   = J2d*Sb - r1*Ci
+!           Fiber reinforcement/active stress
+            Sb  = Sb + Tfa(g)*MAT_DYADPROD(fl(:,1,g), fl(:,1,g), nsd)
 
-         PP  = TEN_IDs(nsd) - (1._RKIND/nd) * TEN_DYADPROD(Ci, C, nsd)
-         CC  = TEN_DDOT(CCb, PP, nsd)
-         CC  = TEN_TRANSPOSE(CC, nsd)
-         CC  = TEN_DDOT(PP, CC, nsd)
-         CC  = CC - (2._RKIND/nd) * ( TEN_DYADPROD(Ci, S, nsd) +
-     2                           TEN_DYADPROD(S, Ci, nsd) )
+            g1  = 4._RKIND*J4d* stM%C01
+            Db(:,:,g) = g1 * (MAT_DYADPROD(vI, vI, nsymd) -
+     2         VGT_IDs(nsd))
 
-         S   = S + p*J*Ci
-         CC  = CC + 2._RKIND*(r1 - p*J) * TEN_SYMMPROD(Ci, Ci, nsd) +
-     2          (pl*J - 2._RKIND*r1/nd) * TEN_DYADPROD(Ci, Ci, nsd)
+            r1(g) = J2d(g)*MAT_DDOT(C(:,:,g), Sb, nsd) / nd
+            S(:,:,g) = J2d(g)*Sb - r1(g)*Ci(:,:,g)
+         END DO
 
 !     HGO (Holzapfel-Gasser-Ogden) model with additive splitting of
 !     the anisotropic fiber-based strain-energy terms
       CASE (stIso_HGO)
-         IF (nfd .NE. 2) err = "Min fiber directions not defined for "//
-     2      "HGO material model (2)"
          kap  = stM%kap
-         Inv4 = J2d*NORM(fl(:,1), MATMUL(C, fl(:,1)))
-         Inv6 = J2d*NORM(fl(:,2), MATMUL(C, fl(:,2)))
-
-         Eff  = kap*Inv1 + (1._RKIND-3._RKIND*kap)*Inv4 - 1._RKIND
-         Ess  = kap*Inv1 + (1._RKIND-3._RKIND*kap)*Inv6 - 1._RKIND
-
-         Hff  = MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
-         Hff  = kap*IDm + (1._RKIND-3._RKIND*kap)*Hff
-         Hss  = MAT_DYADPROD(fl(:,2), fl(:,2), nsd)
-         Hss  = kap*IDm + (1._RKIND-3._RKIND*kap)*Hss
-
-         g1   = stM%C10
-         g2   = stM%aff * Eff * EXP(stM%bff*Eff*Eff)
-         g3   = stM%ass * Ess * EXP(stM%bss*Ess*Ess)
-         Sb   = 2._RKIND*(g1*IDm + g2*Hff + g3*Hss)
-
-!        Fiber reinforcement/active stress
-         Sb   = Sb + Tfa*MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
-
-         g1   = stM%aff*(1._RKIND + 2._RKIND*stM%bff*Eff*Eff)*
-     2      EXP(stM%bff*Eff*Eff)
-         g2   = stM%ass*(1._RKIND + 2._RKIND*stM%bss*Ess*Ess)*
-     2      EXP(stM%bss*Ess*Ess)
-         g1   = 4._RKIND*J4d*g1
-         g2   = 4._RKIND*J4d*g2
-
-         CCb  = g1 * TEN_DYADPROD(Hff, Hff, nsd) +
-     2          g2 * TEN_DYADPROD(Hss, Hss, nsd)
-
-         r1  = J2d*MAT_DDOT(C, Sb, nsd) / nd
-         S   = J2d*Sb - r1*Ci
-
-         PP  = TEN_IDs(nsd) - (1._RKIND/nd) * TEN_DYADPROD(Ci, C, nsd)
-         CC  = TEN_DDOT(CCb, PP, nsd)
-         CC  = TEN_TRANSPOSE(CC, nsd)
-         CC  = TEN_DDOT(PP, CC, nsd)
-         CC  = CC - (2._RKIND/nd) * ( TEN_DYADPROD(Ci, S, nsd) +
-     2                           TEN_DYADPROD(S, Ci, nsd) )
-
-         S   = S + p*J*Ci
-         CC  = CC + 2._RKIND*(r1 - p*J) * TEN_SYMMPROD(Ci, Ci, nsd) +
-     2          (pl*J - 2._RKIND*r1/nd) * TEN_DYADPROD(Ci, Ci, nsd)
+         DO g=1, nP
+            J4d  = J2d(g)*J2d(g)
+            Inv4 = J2d(g)*NORM(fl(:,1,g), MATMUL(C(:,:,g), fl(:,1,g)))
+            Inv6 = J2d(g)*NORM(fl(:,2,g), MATMUL(C(:,:,g), fl(:,2,g)))
+
+            Eff  = kap*Inv1(g) + (1._RKIND-3._RKIND*kap)*Inv4 - 1._RKIND
+            Ess  = kap*Inv1(g) + (1._RKIND-3._RKIND*kap)*Inv6 - 1._RKIND
+
+            Hff  = MAT_DYADPROD(fl(:,1,g), fl(:,1,g), nsd)
+            Hff  = kap*IDm + (1._RKIND-3._RKIND*kap)*Hff
+            Hss  = MAT_DYADPROD(fl(:,2,g), fl(:,2,g), nsd)
+            Hss  = kap*IDm + (1._RKIND-3._RKIND*kap)*Hss
+
+            g1   = stM%C10
+            g2   = stM%aff * Eff * EXP(stM%bff*Eff*Eff)
+            g3   = stM%ass * Ess * EXP(stM%bss*Ess*Ess)
+            Sb   = 2._RKIND*(g1*IDm + g2*Hff + g3*Hss)
+
+!           Fiber reinforcement/active stress
+            Sb   = Sb + Tfa(g)*MAT_DYADPROD(fl(:,1,g), fl(:,1,g), nsd)
+
+            g1   = stM%aff*(1._RKIND + 2._RKIND*stM%bff*Eff*Eff)*
+     2         EXP(stM%bff*Eff*Eff)
+            g2   = stM%ass*(1._RKIND + 2._RKIND*stM%bss*Ess*Ess)*
+     2         EXP(stM%bss*Ess*Ess)
+            g1   = 4._RKIND*J4d*g1
+            g2   = 4._RKIND*J4d*g2
+
+            vH   = VGT_VEC(Hff, nsd)
+            Db(:,:,g) = g1 * MAT_DYADPROD(vH, vH, nsymd)
+            vH   = VGT_VEC(Hss, nsd)
+            Db(:,:,g) = Db(:,:,g) + g2 * MAT_DYADPROD(vH, vH, nsymd)
+
+            r1(g) = J2d(g)*MAT_DDOT(C(:,:,g), Sb, nsd) / nd
+            S(:,:,g) = J2d(g)*Sb - r1(g)*Ci(:,:,g)
+         END DO
 
 !     Guccione (1995) transversely isotropic model
       CASE (stIso_Gucci)
-         IF (nfd .NE. 2) err = "Min fiber directions not defined for "//
-     2      "Guccione material model (2)"
-!        Compute isochoric component of E
-         E = 0.5_RKIND * (J2d*C - Idm)
-
-!        Transform into local orthogonal coordinate system
-         Rm(:,1) = fl(:,1)
-         Rm(:,2) = fl(:,2)
-         Rm(:,3) = CROSS(fl)
-
-!        Project E to local orthogocal coordinate system
-         Es = MATMUL(E, Rm)
-         Es = MATMUL(TRANSPOSE(Rm), Es)
-
          g1 = stM%bff
          g2 = stM%bss
          g3 = stM%bfs
+         DO g=1, nP
+            J4d = J2d(g)*J2d(g)
 
-         QQ = g1 * Es(1,1)*Es(1,1) +
-     2        g2 *(Es(2,2)*Es(2,2) + Es(3,3)*Es(3,3)  +
-     3             Es(2,3)*Es(2,3) + Es(3,2)*Es(3,2)) +
-     4        g3 *(Es(1,2)*Es(1,2) + Es(2,1)*Es(2,1)  +
-     5             Es(1,3)*Es(1,3) + Es(3,1)*Es(3,1))
+!           Compute isochoric component of E
+            E = 0.5_RKIND * (J2d(g)*C(:,:,g) - Idm)
 
-         r2 = stM%C10 * EXP(QQ)
+!           Transform into local orthogonal coordinate system
+            Rm(:,1) = fl(:,1,g)
+            Rm(:,2) = fl(:,2,g)
+            Rm(:,3) = CROSS(fl(:,:,g))
 
-!        Fiber stiffness contribution := (dE*_ab / dE_IJ)
-         RmRm(:,:,1) = MAT_DYADPROD(Rm(:,1), Rm(:,1), nsd)
-         RmRm(:,:,2) = MAT_DYADPROD(Rm(:,2), Rm(:,2), nsd)
-         RmRm(:,:,3) = MAT_DYADPROD(Rm(:,3), Rm(:,3), nsd)
+!           Project E to local orthogocal coordinate system
+            Es = MATMUL(E, Rm)
+            Es = MATMUL(TRANSPOSE(Rm), Es)
 
-         RmRm(:,:,4) = MAT_SYMMPROD(Rm(:,1), Rm(:,2), nsd)
-         RmRm(:,:,5) = MAT_SYMMPROD(Rm(:,2), Rm(:,3), nsd)
-         RmRm(:,:,6) = MAT_SYMMPROD(Rm(:,3), Rm(:,1), nsd)
+            QQ = g1 * Es(1,1)*Es(1,1) +
+     2           g2 *(Es(2,2)*Es(2,2) + Es(3,3)*Es(3,3)  +
+     3                Es(2,3)*Es(2,3) + Es(3,2)*Es(3,2)) +
+     4           g3 *(Es(1,2)*Es(1,2) + Es(2,1)*Es(2,1)  +
+     5                Es(1,3)*Es(1,3) + Es(3,1)*Es(3,1))
 
-         Sb = g1*Es(1,1)*RmRm(:,:,1) + g2*(Es(2,2)*RmRm(:,:,2) +
-     2      Es(3,3)*RmRm(:,:,3) + 2._RKIND*Es(2,3)*RmRm(:,:,5)) +
-     4      2._RKIND*g3*(Es(1,2)*RmRm(:,:,4) + Es(1,3)*RmRm(:,:,6))
+            r2 = stM%C10 * EXP(QQ)
 
-         CCb = 2._RKIND*TEN_DYADPROD(Sb, Sb, nsd)
-         Sb  = Sb * r2
+!           Fiber stiffness contribution := (dE*_ab / dE_IJ)
+            RmRm(:,:,1) = MAT_DYADPROD(Rm(:,1), Rm(:,1), nsd)
+            RmRm(:,:,2) = MAT_DYADPROD(Rm(:,2), Rm(:,2), nsd)
+            RmRm(:,:,3) = MAT_DYADPROD(Rm(:,3), Rm(:,3), nsd)
 
-!        Fiber reinforcement/active stress
-         Sb  = Sb + Tfa*MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
+            RmRm(:,:,4) = MAT_SYMMPROD(Rm(:,1), Rm(:,2), nsd)
+            RmRm(:,:,5) = MAT_SYMMPROD(Rm(:,2), Rm(:,3), nsd)
+            RmRm(:,:,6) = MAT_SYMMPROD(Rm(:,3), Rm(:,1), nsd)
 
-         r1  = J2d*MAT_DDOT(C, Sb, nsd) / nd
-         S   = J2d*Sb - r1*Ci
+            Sb = g1*Es(1,1)*RmRm(:,:,1) + g2*(Es(2,2)*RmRm(:,:,2) +
+     2         Es(3,3)*RmRm(:,:,3) + 2._RKIND*Es(2,3)*RmRm(:,:,5)) +
+     3         2._RKIND*g3*(Es(1,2)*RmRm(:,:,4) + Es(1,3)*RmRm(:,:,6))
 
-         r2  = r2*J4d
-         CCb = r2*(CCb + g1*TEN_DYADPROD(RmRm(:,:,1), RmRm(:,:,1), nsd)
-     2       + g2*(TEN_DYADPROD(RmRm(:,:,2), RmRm(:,:,2), nsd)
-     3       + TEN_DYADPROD(RmRm(:,:,3), RmRm(:,:,3), nsd)
-     4       + TEN_DYADPROD(RmRm(:,:,5), RmRm(:,:,5), nsd)*2._RKIND)
-     5       + 2._RKIND*g3*(TEN_DYADPROD(RmRm(:,:,4), RmRm(:,:,4), nsd)
-     6       + TEN_DYADPROD(RmRm(:,:,6), RmRm(:,:,6), nsd)))
+            vS  = VGT_VEC(Sb, nsd)
+            Db(:,:,g) = 2._RKIND*MAT_DYADPROD(vS, vS, nsymd)
+            Sb  = Sb * r2
 
+!           Fiber reinforcement/active stress
+            Sb  = Sb + Tfa(g)*MAT_DYADPROD(fl(:,1,g), fl(:,1,g), nsd)
 
-         PP  = TEN_IDs(nsd) - (1._RKIND/nd) * TEN_DYADPROD(Ci, C, nsd)
-         CC  = TEN_DDOT(CCb, PP, nsd)
-         CC  = TEN_TRANSPOSE(CC, nsd)
-         CC  = TEN_DDOT(PP, CC, nsd)
-         CC  = CC - (2._RKIND/nd) * ( TEN_DYADPROD(Ci, S, nsd) +
-     2                           TEN_DYADPROD(S, Ci, nsd) )
+            r1(g) = J2d(g)*MAT_DDOT(C(:,:,g), Sb, nsd) / nd
+            S(:,:,g) = J2d(g)*Sb - r1(g)*Ci(:,:,g)
 
-         S   = S + p*J*Ci
-         CC  = CC + 2._RKIND*(r1 - p*J) * TEN_SYMMPROD(Ci, Ci, nsd) +
-     2          (pl*J - 2._RKIND*r1/nd) * TEN_DYADPROD(Ci, Ci, nsd)
+            r2  = r2*J4d
+            DO i=1, 6
+               vR(:,i) = VGT_VEC(RmRm(:,:,i), nsd)
+            END DO
+            Db(:,:,g) = r2*(Db(:,:,g)
+     2         + g1*MAT_DYADPROD(vR(:,1), vR(:,1), nsymd)
+     3         + g2*(MAT_DYADPROD(vR(:,2), vR(:,2), nsymd)
+     4         + MAT_DYADPROD(vR(:,3), vR(:,3), nsymd)
+     5         + MAT_DYADPROD(vR(:,5), vR(:,5), nsymd)*2._RKIND)
+     6         + 2._RKIND*g3*(MAT_DYADPROD(vR(:,4), vR(:,4), nsymd)
+     7         + MAT_DYADPROD(vR(:,6), vR(:,6), nsymd)))
+         END DO
 
 !     HO (Holzapfel-Ogden) model for myocardium (2009)
       CASE (stIso_HO)
-         IF (nfd .NE. 2) err = "Min fiber directions not defined for "//
-     2      "Holzapfel material model (2)"
-         Inv4 = J2d*NORM(fl(:,1), MATMUL(C, fl(:,1)))
-         Inv6 = J2d*NORM(fl(:,2), MATMUL(C, fl(:,2)))
-         Inv8 = J2d*NORM(fl(:,1), MATMUL(C, fl(:,2)))
-
-         Eff  = Inv4 - 1._RKIND
-         Ess  = Inv6 - 1._RKIND
-         Efs  = Inv8
-
-         g1   = stM%a * EXP(stM%b*(Inv1-3._RKIND))
-         g2   = 2._RKIND * stM%afs * Efs * EXP(stM%bfs*Efs*Efs)
-         Hfs  = MAT_SYMMPROD(fl(:,1), fl(:,2), nsd)
-         Sb   = g1*IDm + g2*Hfs
-
-         Efs  = Efs * Efs
-         g1   = 2._RKIND*J4d*stM%b*g1
-         g2   = 4._RKIND*J4d*stM%afs*(1._RKIND + 2._RKIND*stM%bfs*Efs)*
-     2      EXP(stM%bfs*Efs)
-         CCb  = g1 * TEN_DYADPROD(IDm, IDm, nsd) +
-     2          g2 * TEN_DYADPROD(Hfs, Hfs, nsd)
-
-         IF (Eff .GT. 0._RKIND) THEN
-!            Fiber reinforcement/active stress
-             g1  = Tfa
-
-             g1  = g1 + 2._RKIND * stM%aff * Eff * EXP(stM%bff*Eff*Eff)
-             Hff = MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
-             Sb  = Sb + g1*Hff
-
-             Eff = Eff * Eff
-             g1  = 4._RKIND*J4d*stM%aff*(1._RKIND +
-     2          2._RKIND*stM%bff*Eff)*EXP(stM%bff*Eff)
-             CCb = CCb + g1*TEN_DYADPROD(Hff, Hff, nsd)
-         END IF
-
-         IF (Ess .GT. 0._RKIND) THEN
-             g2  = 2._RKIND * stM%ass * Ess * EXP(stM%bss*Ess*Ess)
-             Hss = MAT_DYADPROD(fl(:,2), fl(:,2), nsd)
-             Sb  = Sb + g2*Hss
-
-             Ess = Ess * Ess
-             g2  = 4._RKIND*J4d*stM%ass*(1._RKIND +
-     2          2._RKIND*stM%bss*Ess)*EXP(stM%bss*Ess)
-             CCb = CCb + g2*TEN_DYADPROD(Hss, Hss, nsd)
-         END IF
-
-         r1  = J2d*MAT_DDOT(C, Sb, nsd) / nd
-         S   = J2d*Sb - r1*Ci
-
-         PP  = TEN_IDs(nsd) - (1._RKIND/nd) * TEN_DYADPROD(Ci, C, nsd)
-         CC  = TEN_DDOT(CCb, PP, nsd)
-         CC  = TEN_TRANSPOSE(CC, nsd)
-         CC  = TEN_DDOT(PP, CC, nsd)
-         CC  = CC - (2._RKIND/nd) * ( TEN_DYADPROD(Ci, S, nsd) +
-     2                           TEN_DYADPROD(S, Ci, nsd) )
-
-         S   = S + p*J*Ci
-         CC  = CC + 2._RKIND*(r1 - p*J) * TEN_SYMMPROD(Ci, Ci, nsd) +
-     2          (pl*J - 2._RKIND*r1/nd) * TEN_DYADPROD(Ci, Ci, nsd)
-
-         IF (cem%aStrain) THEN
-            S = MATMUL(Fai, S)
-            S = MATMUL(S, TRANSPOSE(Fai))
-            CCb = 0._RKIND
-            CCb = TEN_DYADPROD(Fai, Fai, nsd)
-            CC  = TEN_DDOT_3424(CC, CCb, nsd)
-            CC  = TEN_DDOT_2412(CCb, CC, nsd)
-         END IF
+         DO g=1, nP
+            J4d  = J2d(g)*J2d(g)
+            Inv4 = J2d(g)*NORM(fl(:,1,g), MATMUL(C(:,:,g), fl(:,1,g)))
+            Inv6 = J2d(g)*NORM(fl(:,2,g), MATMUL(C(:,:,g), fl(:,2,g)))
+            Inv8 = J2d(g)*NORM(fl(:,1,g), MATMUL(C(:,:,g), fl(:,2,g)))
+
+            Eff  = Inv4 - 1._RKIND
+            Ess  = Inv6 - 1._RKIND
+            Efs  = Inv8
+
+            g1   = stM%a * EXP(stM%b*(Inv1(g)-3._RKIND))
+            g2   = 2._RKIND * stM%afs * Efs * EXP(stM%bfs*Efs*Efs)
+            Hfs  = MAT_SYMMPROD(fl(:,1,g), fl(:,2,g), nsd)
+            Sb   = g1*IDm + g2*Hfs
+
+            Efs  = Efs * Efs
+            g1   = 2._RKIND*J4d*stM%b*g1
+            g2   = 4._RKIND*J4d*stM%afs*(1._RKIND +
+     2         2._RKIND*stM%bfs*Efs)*EXP(stM%bfs*Efs)
+            vH   = VGT_VEC(Hfs, nsd)
+            Db(:,:,g) = g1 * MAT_DYADPROD(vI, vI, nsymd) +
+     2                  g2 * MAT_DYADPROD(vH, vH, nsymd)
+
+            IF (Eff .GT. 0._RKIND) THEN
+!              Fiber reinforcement/active stress
+               g1  = Tfa(g)
+
+               g1  = g1 + 2._RKIND*stM%aff*Eff*EXP(stM%bff*Eff*Eff)
+               Hff = MAT_DYADPROD(fl(:,1,g), fl(:,1,g), nsd)
+               Sb  = Sb + g1*Hff
+
+               Eff = Eff * Eff
+               g1  = 4._RKIND*J4d*stM%aff*(1._RKIND +
+     2            2._RKIND*stM%bff*Eff)*EXP(stM%bff*Eff)
+               vH  = VGT_VEC(Hff, nsd)
+               Db(:,:,g) = Db(:,:,g) + g1*MAT_DYADPROD(vH, vH, nsymd)
+            END IF
+
+            IF (Ess .GT. 0._RKIND) THEN
+               g2  = 2._RKIND * stM%ass * Ess * EXP(stM%bss*Ess*Ess)
+               Hss = MAT_DYADPROD(fl(:,2,g), fl(:,2,g), nsd)
+               Sb  = Sb + g2*Hss
+
+               Ess = Ess * Ess
+               g2  = 4._RKIND*J4d*stM%ass*(1._RKIND +
+     2            2._RKIND*stM%bss*Ess)*EXP(stM%bss*Ess)
+               vH  = VGT_VEC(Hss, nsd)
+               Db(:,:,g) = Db(:,:,g) + g2*MAT_DYADPROD(vH, vH, nsymd)
+            END IF
+
+            r1(g) = J2d(g)*MAT_DDOT(C(:,:,g), Sb, nsd) / nd
+            S(:,:,g) = J2d(g)*Sb - r1(g)*Ci(:,:,g)
+         END DO
 
       CASE DEFAULT
          err = "Undefined material constitutive model"
       END SELECT
 
-!     Convert to Voigt Notation
-      CALL CCTOVOIGT(CC, Dm)
+!     Isochoric projection of the fictitious elasticity tensor, followed
+!     by the remaining isochoric and dilational contributions
+      DO g=1, nP
+         IF (stM%isoType .NE. stIso_nHook)
+     2      CALL VGT_PROJ(Db(:,:,g), C(:,:,g), Ci(:,:,g), nsd)
+         vCi = VGT_VEC(Ci(:,:,g), nsd)
+         vS  = VGT_VEC(S(:,:,g), nsd)
+         Dm(:,:,g) = Db(:,:,g) - (2._RKIND/nd) *
+     2      ( MAT_DYADPROD(vCi, vS, nsymd) +
+     3        MAT_DYADPROD(vS, vCi, nsymd) )
+
+         S(:,:,g)  = S(:,:,g) + p(g)*J(g)*Ci(:,:,g)
+         Dm(:,:,g) = Dm(:,:,g) + 2._RKIND*(r1(g) - p(g)*J(g)) *
+     2      VGT_SYMMPROD(Ci(:,:,g), Ci(:,:,g), nsd) +
+     3      (pl(g)*J(g) - 2._RKIND*r1(g)/nd) *
+     4      MAT_DYADPROD(vCi, vCi, nsymd)
+      END DO
+
+      IF (cem%aStrain .AND. stM%isoType.EQ.stIso_HO) THEN
+         DO g=1, nP
+            S(:,:,g) = MATMUL(Fai(:,:,g), S(:,:,g))
+            S(:,:,g) = MATMUL(S(:,:,g), TRANSPOSE(Fai(:,:,g)))
+            CALL VGT_PUSH(Dm(:,:,g), Fai(:,:,g), nsd)
+         END DO
+      END IF
 
       RETURN
-      END SUBROUTINE GETPK2CC
+      END SUBROUTINE GETPK2CCv
+!--------------------------------------------------------------------
+!     Compute the deformation gradient (F) and the material response at
+!     all the nG integration points of an element. The points are then
+!     evaluated as a single batch by GETPK2CCv. N and Nx are the shape
+!     functions and their spatial derivatives at the integration points.
+      SUBROUTINE GETPK2CCe(lDmn, lDev, eNoN, nG, nfd, N, Nx, dl, fl,
+     2   ya_l, F, S, Dm, Ja)
+      USE COMMOD
+      IMPLICIT NONE
+      TYPE(dmnType), INTENT(IN) :: lDmn
+      LOGICAL, INTENT(IN) :: lDev
+      INTEGER(KIND=IKIND), INTENT(IN) :: eNoN, nG, nfd
+      REAL(KIND=RKIND), INTENT(IN) :: N(eNoN,nG), Nx(nsd,eNoN,nG),
+     2   dl(tDof,eNoN), fl(nsd,nfd), ya_l(eNoN)
+      REAL(KIND=RKIND), INTENT(OUT) :: F(nsd,nsd,nG), S(nsd,nsd,nG),
+     2   Dm(nsymd,nsymd,nG), Ja(nG)
+
+      INTEGER(KIND=IKIND) :: a, g, i, s0
+      REAL(KIND=RKIND) :: ya_g(nG), flg(nsd,nfd,nG)
+
+      s0 = eq(cEq)%s - 1
+      DO g=1, nG
+         F(:,:,g) = 0._RKIND
+         DO i=1, nsd
+            F(i,i,g) = 1._RKIND
+         END DO
+         ya_g(g) = 0._RKIND
+         DO a=1, eNoN
+            DO i=1, nsd
+               F(i,:,g) = F(i,:,g) + Nx(:,a,g)*dl(s0+i,a)
+            END DO
+            ya_g(g) = ya_g(g) + N(a,g)*ya_l(a)
+         END DO
+         flg(:,:,g) = fl
+      END DO
+
+      CALL GETPK2CCv(lDmn, lDev, nG, F, nfd, flg, ya_g, S, Dm, Ja)
+
+      RETURN
+      END SUBROUTINE GETPK2CCe
 !--------------------------------------------------------------------
       SUBROUTINE GETSVOLP(stM, J, p, pl)
       USE COMMOD
@@ -399,9 +542,9 @@
       END SUBROUTINE GETSVOLP
 !####################################################################
 !     Compute isochoric (deviatoric) component of 2nd Piola-Kirchhoff
-!     stress and material stiffness tensors
+!     stress and material stiffness tensors, the latter in Voigt
+!     notation
       SUBROUTINE GETPK2CCdev(lDmn, F, nfd, fl, ya, S, Dm, Ja)
-      USE MATFUN
       USE COMMOD
       IMPLICIT NONE
       TYPE(dmnType), INTENT(IN) :: lDmn
@@ -409,288 +552,11 @@
       REAL(KIND=RKIND), INTENT(IN) :: F(nsd,nsd), fl(nsd,nfd), ya
       REAL(KIND=RKIND), INTENT(OUT) :: S(nsd,nsd), Dm(nsymd,nsymd), Ja
 
-      TYPE(stModelType) :: stM
-      REAL(KIND=RKIND) :: nd, J, J2d, J4d, trE, Inv1, Inv2, Inv4, Inv6,
-     2   Inv8, Tfa, IDm(nsd,nsd), C(nsd,nsd), E(nsd,nsd), Ci(nsd,nsd),
-     3   Sb(nsd,nsd), CCb(nsd,nsd,nsd,nsd), PP(nsd,nsd,nsd,nsd),
-     4   CC(nsd,nsd,nsd,nsd)
-      REAL(KIND=RKIND) :: r1, r2, g1, g2, g3
-      ! Guccione !
-      REAL(KIND=RKIND) :: QQ, Rm(nsd,nsd), Es(nsd,nsd), RmRm(nsd,nsd,6)
-      ! HGO, HO !
-      REAL(KIND=RKIND) :: kap, Eff, Ess, Efs, Hff(nsd,nsd),
-     2   Hss(nsd,nsd), Hfs(nsd,nsd)
-!     Active strain for electromechanics
-      REAL(KIND=RKIND) :: Fe(nsd,nsd), Fa(nsd,nsd), Fai(nsd,nsd)
-
-      S    = 0._RKIND
-      Dm   = 0._RKIND
-
-!     Some preliminaries
-      stM  = lDmn%stM
-      nd   = REAL(nsd, KIND=RKIND)
-
-!     Fiber-reinforced stress
-      CALL GETFIBSTRESS(stM%Tf, Tfa)
-
-!     Electromechanics coupling - active stress
-      IF (cem%aStress) Tfa = Tfa + ya
-
-!     Electromechanics coupling - active strain
-      Fe   = F
-      Fa   = MAT_ID(nsd)
-      Fai  = Fa
-      IF (cem%aStrain) THEN
-         CALL ACTVSTRAIN(ya, nfd, fl, Fa)
-         Fai  = MAT_INV(Fa, nsd)
-         Fe   = MATMUL(F, Fai)
-      END IF
-
-      Ja   = MAT_DET(Fa, nsd)
-      J    = MAT_DET(Fe, nsd)
-      J2d  = J**(-2._RKIND/nd)
-      J4d  = J2d*J2d
-
-      IDm  = MAT_ID(nsd)
-      C    = MATMUL(TRANSPOSE(Fe), Fe)
-      E    = 0.5_RKIND * (C - IDm)
-      Ci   = MAT_INV(C, nsd)
-
-      trE  = MAT_TRACE(E, nsd)
-      Inv1 = J2d*MAT_TRACE(C,nsd)
-      Inv2 = 0.5_RKIND*( Inv1*Inv1 - J4d*MAT_TRACE(MATMUL(C,C), nsd) )
-
-!     Isochoric part of 2nd Piola-Kirchhoff and elasticity tensors
-      SELECT CASE (stM%isoType)
-!     NeoHookean model
-      CASE (stIso_nHook)
-         g1 = 2._RKIND * stM%C10
-         Sb = g1*IDm
-
-!        Fiber reinforcement/active stress
-         Sb = Sb + Tfa*MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
-
-         r1 = g1*Inv1/nd
-         S  = J2d*Sb - r1*Ci
-         CC = 2._RKIND*r1 * ( TEN_SYMMPROD(Ci, Ci, nsd) -
-     2        1._RKIND/nd *   TEN_DYADPROD(Ci, Ci, nsd) )
-     3      - 2._RKIND/nd * ( TEN_DYADPROD(Ci, S, nsd) +
-     4                   TEN_DYADPROD(S, Ci, nsd) )
-
-!     Mooney-Rivlin model
-      CASE (stIso_MR)
-         g1  = 2._RKIND * (stM%C10 + Inv1*stM%C01)
-         g2  = -2._RKIND * stM%C01
-         Sb  = g1*IDm + g2*J2d*C
-
-!        Fiber reinforcement/active stress
-         Sb  = Sb + Tfa*MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
-
-         g1  = 4._RKIND*J4d* stM%C01
-         CCb = g1 * (TEN_DYADPROD(IDm, IDm, nsd) - TEN_IDs(nsd))
-
-         r1  = J2d*MAT_DDOT(C, Sb, nsd) / nd
-         S   = J2d*Sb - r1*Ci
-
-         PP  = TEN_IDs(nsd) - (1._RKIND/nd) * TEN_DYADPROD(Ci, C, nsd)
-         CC  = TEN_DDOT(CCb, PP, nsd)
-         CC  = TEN_TRANSPOSE(CC, nsd)
-         CC  = TEN_DDOT(PP, CC, nsd)
-         CC  = CC + 2._RKIND*r1 * ( TEN_SYMMPROD(Ci, Ci, nsd) -
-     2              1._RKIND/nd *   TEN_DYADPROD(Ci, Ci, nsd) )
-     3            - 2._RKIND/nd * ( TEN_DYADPROD(Ci, S, nsd) +
-     4                         TEN_DYADPROD(S, Ci, nsd) )
-
-!     HGO (Holzapfel-Gasser-Ogden) model with additive splitting of
-!     the anisotropic fiber-based strain-energy terms
-      CASE (stIso_HGO)
-         IF (nfd .NE. 2) err = "Min fiber directions not defined for "//
-     2      "HGO material model (2)"
-         kap  = stM%kap
-         Inv4 = J2d*NORM(fl(:,1), MATMUL(C, fl(:,1)))
-         Inv6 = J2d*NORM(fl(:,2), MATMUL(C, fl(:,2)))
-
-         Eff  = kap*Inv1 + (1._RKIND-3._RKIND*kap)*Inv4 - 1._RKIND
-         Ess  = kap*Inv1 + (1._RKIND-3._RKIND*kap)*Inv6 - 1._RKIND
-
-         Hff  = MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
-         Hff  = kap*IDm + (1._RKIND-3._RKIND*kap)*Hff
-         Hss  = MAT_DYADPROD(fl(:,2), fl(:,2), nsd)
-         Hss  = kap*IDm + (1._RKIND-3._RKIND*kap)*Hss
-
-         g1   = stM%C10
-         g2   = stM%aff * Eff * EXP(stM%bff*Eff*Eff)
-         g3   = stM%ass * Ess * EXP(stM%bss*Ess*Ess)
-         Sb   = 2._RKIND*(g1*IDm + g2*Hff + g3*Hss)
-
-!        Fiber reinforcement/active stress
-         Sb   = Sb + Tfa*MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
-
-         g1   = stM%aff*(1._RKIND + 2._RKIND*stM%bff*Eff*Eff)*
-     2      EXP(stM%bff*Eff*Eff)
-         g2   = stM%ass*(1._RKIND + 2._RKIND*stM%bss*Ess*Ess)*
-     2      EXP(stM%bss*Ess*Ess)
-         g1   = 4._RKIND*J4d * g1
-         g2   = 4._RKIND*J4d * g2
-
-         CCb  = g1 * TEN_DYADPROD(Hff, Hff, nsd) +
-     2          g2 * TEN_DYADPROD(Hss, Hss, nsd)
-
-         r1  = J2d*MAT_DDOT(C, Sb, nsd) / nd
-         S   = J2d*Sb - r1*Ci
-
-         PP  = TEN_IDs(nsd) - (1._RKIND/nd) * TEN_DYADPROD(Ci, C, nsd)
-         CC  = TEN_DDOT(CCb, PP, nsd)
-         CC  = TEN_TRANSPOSE(CC, nsd)
-         CC  = TEN_DDOT(PP, CC, nsd)
-         CC  = CC + 2._RKIND*r1 * ( TEN_SYMMPROD(Ci, Ci, nsd) -
-     2              1._RKIND/nd *   TEN_DYADPROD(Ci, Ci, nsd) )
-     3            - 2._RKIND/nd * ( TEN_DYADPROD(Ci, S, nsd) +
-     4                         TEN_DYADPROD(S, Ci, nsd) )
-
-!     Guccione (1995) transversely isotropic model
-      CASE (stIso_Gucci)
-         IF (nfd .NE. 2) err = "Min fiber directions not defined for "//
-     2      "Guccione material model (2)"
-!        Compute isochoric component of E
-         E = 0.5_RKIND * (J2d*C - Idm)
-
-!        Transform into local orthogonal coordinate system
-         Rm(:,1) = fl(:,1)
-         Rm(:,2) = fl(:,2)
-         Rm(:,3) = CROSS(fl)
-
-!        Project E to local orthogocal coordinate system
-         Es = MATMUL(E, Rm)
-         Es = MATMUL(TRANSPOSE(Rm), Es)
-
-         g1 = stM%bff
-         g2 = stM%bss
-         g3 = stM%bfs
-
-         QQ = g1 * Es(1,1)*Es(1,1) +
-     2        g2 *(Es(2,2)*Es(2,2) + Es(3,3)*Es(3,3)  +
-     3             Es(2,3)*Es(2,3) + Es(3,2)*Es(3,2)) +
-     4        g3 *(Es(1,2)*Es(1,2) + Es(2,1)*Es(2,1)  +
-     5             Es(1,3)*Es(1,3) + Es(3,1)*Es(3,1))
-
-         r2 = stM%C10 * EXP(QQ)
-
-!        Fiber stiffness contribution := (dE*_ab / dE_IJ)
-         RmRm(:,:,1) = MAT_DYADPROD(Rm(:,1), Rm(:,1), nsd)
-         RmRm(:,:,2) = MAT_DYADPROD(Rm(:,2), Rm(:,2), nsd)
-         RmRm(:,:,3) = MAT_DYADPROD(Rm(:,3), Rm(:,3), nsd)
-
-         RmRm(:,:,4) = MAT_SYMMPROD(Rm(:,1), Rm(:,2), nsd)
-         RmRm(:,:,5) = MAT_SYMMPROD(Rm(:,2), Rm(:,3), nsd)
-         RmRm(:,:,6) = MAT_SYMMPROD(Rm(:,3), Rm(:,1), nsd)
-
-         Sb = g1*Es(1,1)*RmRm(:,:,1) + g2*(Es(2,2)*RmRm(:,:,2) +
-     2      Es(3,3)*RmRm(:,:,3) + 2._RKIND*Es(2,3)*RmRm(:,:,5)) +
-     4      2._RKIND*g3*(Es(1,2)*RmRm(:,:,4) + Es(1,3)*RmRm(:,:,6))
-
-         CCb = 2._RKIND*TEN_DYADPROD(Sb, Sb, nsd)
-         Sb  = Sb * r2
-
-!        Fiber reinforcement/active stress
-         Sb  = Sb + Tfa*MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
-
-         r1  = J2d*MAT_DDOT(C, Sb, nsd) / nd
-         S   = J2d*Sb - r1*Ci
-
-         r2  = r2*J4d
-         CCb = r2*(CCb + g1*TEN_DYADPROD(RmRm(:,:,1), RmRm(:,:,1), nsd)
-     2       + g2*(TEN_DYADPROD(RmRm(:,:,2), RmRm(:,:,2), nsd)
-     3       + TEN_DYADPROD(RmRm(:,:,3), RmRm(:,:,3), nsd)
-     4       + TEN_DYADPROD(RmRm(:,:,5), RmRm(:,:,5), nsd)*2._RKIND)
-     5       + 2._RKIND*g3*(TEN_DYADPROD(RmRm(:,:,4), RmRm(:,:,4), nsd)
-     6       + TEN_DYADPROD(RmRm(:,:,6), RmRm(:,:,6), nsd)))
-
-         PP  = TEN_IDs(nsd) - (1._RKIND/nd) * TEN_DYADPROD(Ci, C, nsd)
-         CC  = TEN_DDOT(CCb, PP, nsd)
-         CC  = TEN_TRANSPOSE(CC, nsd)
-         CC  = TEN_DDOT(PP, CC, nsd)
-         CC  = CC + 2._RKIND*r1 * ( TEN_SYMMPROD(Ci, Ci, nsd) -
-     2              1._RKIND/nd *   TEN_DYADPROD(Ci, Ci, nsd) )
-     3            - 2._RKIND/nd * ( TEN_DYADPROD(Ci, S, nsd) +
-     4                         TEN_DYADPROD(S, Ci, nsd) )
-
-!     HO (Holzapfel-Ogden) model for myocardium (2009)
-      CASE (stIso_HO)
-         IF (nfd .NE. 2) err = "Min fiber directions not defined for "//
-     2      "Holzapfel material model (2)"
-         Inv4 = J2d*NORM(fl(:,1), MATMUL(C, fl(:,1)))
-         Inv6 = J2d*NORM(fl(:,2), MATMUL(C, fl(:,2)))
-         Inv8 = J2d*NORM(fl(:,1), MATMUL(C, fl(:,2)))
-
-         Eff  = Inv4 - 1._RKIND
-         Ess  = Inv6 - 1._RKIND
-         Efs  = Inv8
-
-         g1   = stM%a * EXP(stM%b*(Inv1-3._RKIND))
-         g2   = 2._RKIND * stM%afs * Efs * EXP(stM%bfs*Efs*Efs)
-         Hfs  = MAT_SYMMPROD(fl(:,1), fl(:,2), nsd)
-         Sb   = g1*IDm + g2*Hfs
-
-         Efs  = Efs * Efs
-         g1   = 2._RKIND*J4d*stM%b*g1
-         g2   = 4._RKIND*J4d*stM%afs*(1._RKIND + 2._RKIND*stM%bfs*Efs)*
-     2      EXP(stM%bfs*Efs)
-         CCb  = g1 * TEN_DYADPROD(IDm, IDm, nsd) +
-     2          g2 * TEN_DYADPROD(Hfs, Hfs, nsd)
-
-         IF (Eff .GT. 0._RKIND) THEN
-!            Fiber reinforcement/active stress
-             g1  = Tfa
-
-             g1  = g1 + 2._RKIND * stM%aff * Eff * EXP(stM%bff*Eff*Eff)
-             Hff = MAT_DYADPROD(fl(:,1), fl(:,1), nsd)
-             Sb  = Sb + g1*Hff
-
-             Eff = Eff * Eff
-             g1  = 4._RKIND*J4d*stM%aff*(1._RKIND +
-     2          2._RKIND*stM%bff*Eff)*EXP(stM%bff*Eff)
-             CCb = CCb + g1*TEN_DYADPROD(Hff, Hff, nsd)
-         END IF
-
-         IF (Ess .GT. 0._RKIND) THEN
-             g2  = 2._RKIND * stM%ass * Ess * EXP(stM%bss*Ess*Ess)
-             Hss = MAT_DYADPROD(fl(:,2), fl(:,2), nsd)
-             Sb  = Sb + g2*Hss
-
-             Ess = Ess * Ess
-             g2  = 4._RKIND*J4d*stM%ass*(1._RKIND +
-     2          2._RKIND*stM%bss*Ess)*EXP(stM%bss*Ess)
-             CCb = CCb + g2*TEN_DYADPROD(Hss, Hss, nsd)
-         END IF
-
-         r1  = J2d*MAT_DDOT(C, Sb, nsd) / nd
-         S   = J2d*Sb - r1*Ci
-
-         PP  = TEN_IDs(nsd) - (1._RKIND/nd) * TEN_DYADPROD(Ci, C, nsd)
-         CC  = TEN_DDOT(CCb, PP, nsd)
-         CC  = TEN_TRANSPOSE(CC, nsd)
-         CC  = TEN_DDOT(PP, CC, nsd)
-         CC  = CC + 2._RKIND*r1 * ( TEN_SYMMPROD(Ci, Ci, nsd) -
-     2              1._RKIND/nd *   TEN_DYADPROD(Ci, Ci, nsd) )
-     3            - 2._RKIND/nd * ( TEN_DYADPROD(Ci, S, nsd) +
-     4                         TEN_DYADPROD(S, Ci, nsd) )
-
-         IF (cem%aStrain) THEN
-            S = MATMUL(Fai, S)
-            S = MATMUL(S, TRANSPOSE(Fai))
-            CCb = 0._RKIND
-            CCb = TEN_DYADPROD(Fai, Fai, nsd)
-            CC  = TEN_DDOT_3424(CC, CCb, nsd)
-            CC  = TEN_DDOT_2412(CCb, CC, nsd)
-         END IF
-
-      CASE DEFAULT
-         err = "Undefined isochoric material constitutive model"
-      END SELECT
+      REAL(KIND=RKIND) :: yv(1), Jv(1)
 
-!     Convert to Voigt Notation
-      CALL CCTOVOIGT(CC, Dm)
+      yv(1) = ya
+      CALL GETPK2CCv(lDmn, .TRUE., 1, F, nfd, fl, yv, S, Dm, Jv)
+      Ja = Jv(1)
 
       RETURN
       END SUBROUTINE GETPK2CCdev
@@ -781,68 +647,6 @@
       RETURN
       END SUBROUTINE GETTAU
 !####################################################################
-!     Convert elasticity tensor to Voigt notation
-      SUBROUTINE CCTOVOIGT(CC, Dm)
-      USE COMMOD, ONLY : RKIND, nsd, nsymd
-      IMPLICIT NONE
-      REAL(KIND=RKIND), INTENT(IN) :: CC(nsd,nsd,nsd,nsd)
-      REAL(KIND=RKIND), INTENT(INOUT) :: Dm(nsymd,nsymd)
-
-      INTEGER i, j
-
-      IF (nsd .EQ. 3) THEN
-         Dm(1,1) = CC(1,1,1,1)
-         Dm(1,2) = CC(1,1,2,2)
-         Dm(1,3) = CC(1,1,3,3)
-         Dm(1,4) = CC(1,1,1,2)
-         Dm(1,5) = CC(1,1,2,3)
-         Dm(1,6) = CC(1,1,3,1)
-
-         Dm(2,2) = CC(2,2,2,2)
-         Dm(2,3) = CC(2,2,3,3)
-         Dm(2,4) = CC(2,2,1,2)
-         Dm(2,5) = CC(2,2,2,3)
-         Dm(2,6) = CC(2,2,3,1)
-
-         Dm(3,3) = CC(3,3,3,3)
-         Dm(3,4) = CC(3,3,1,2)
-         Dm(3,5) = CC(3,3,2,3)
-         Dm(3,6) = CC(3,3,3,1)
-
-         Dm(4,4) = CC(1,2,1,2)
-         Dm(4,5) = CC(1,2,2,3)
-         Dm(4,6) = CC(1,2,3,1)
-
-         Dm(5,5) = CC(2,3,2,3)
-         Dm(5,6) = CC(2,3,3,1)
-
-         Dm(6,6) = CC(3,1,3,1)
-
-         DO i=2, 6
-            DO j=1, i-1
-               Dm(i,j) = Dm(j,i)
-            END DO
-         END DO
-
-      ELSE IF (nsd .EQ. 2) THEN
-         Dm(1,1) = CC(1,1,1,1)
-         Dm(1,2) = CC(1,1,2,2)
-         Dm(1,3) = CC(1,1,1,2)
-
-         Dm(2,2) = CC(2,2,2,2)
-         Dm(2,3) = CC(2,2,1,2)
-
-         Dm(3,3) = CC(1,2,1,2)
-
-         Dm(2,1) = Dm(1,2)
-         Dm(3,1) = Dm(1,3)
-         Dm(3,2) = Dm(2,3)
-
-      END IF
-
-      RETURN
-      END SUBROUTINE CCTOVOIGT
-!####################################################################
 !     Compute additional fiber-reinforcement stress
       SUBROUTINE GETFIBSTRESS(Tfl, g)
       USE COMMOD
@@ -417,6 +417,8 @@
          REAL(KIND=RKIND) dB
 !        Calling duration              (OUT)
          REAL(KIND=RKIND) callD
+!        Apply the LHS matrix-free     (IN)
+         LOGICAL :: mFree = .FALSE.
       END TYPE lsType
 
 !     Contact model type
@@ -433,6 +435,33 @@
          REAL(KIND=RKIND) al
 !        Tolerance
          REAL(KIND=RKIND) :: tol = 1.E-6_RKIND
+!        Skin distance added to c for building the neighbor lists
+         REAL(KIND=RKIND) :: skin = 0._RKIND
+!        Time step at which the neighbor lists were built
+         INTEGER(KIND=IKIND) :: nbTS = -1
+!        Neighbor list row pointer (CSR format)
+         INTEGER(KIND=IKIND), ALLOCATABLE :: nbPtr(:)
+!        Neighbor list of nodes from other shell meshes
+         INTEGER(KIND=IKIND), ALLOCATABLE :: nbList(:)
+!        Position of shell nodes when the neighbor lists were built
+         REAL(KIND=RKIND), ALLOCATABLE :: xb(:,:)
+!        Number of halo shell nodes received from other processes
+         INTEGER(KIND=IKIND) :: nHl = 0
+!        Number of halo entries sent to each process
+         INTEGER(KIND=IKIND), ALLOCATABLE :: sCnt(:)
+!        Number of halo entries received from each process
+         INTEGER(KIND=IKIND), ALLOCATABLE :: rCnt(:)
+!        Local shell nodes sent to other processes
+         INTEGER(KIND=IKIND), ALLOCATABLE :: sNd(:)
+!        Local or halo node of each received entry
+         INTEGER(KIND=IKIND), ALLOCATABLE :: rMap(:)
+!        Global to local/halo node map used while building rMap. It is
+!        kept allocated and zero between rebuilds
+         INTEGER(KIND=IKIND), ALLOCATABLE :: gtl(:)
+!        Current position of halo nodes
+         REAL(KIND=RKIND), ALLOCATABLE :: xh(:,:)
+!        Current normal vector of halo nodes
+         REAL(KIND=RKIND), ALLOCATABLE :: nh(:,:)
       END TYPE cntctModelType
 
 !--------------------------------------------------------------------
@@ -503,6 +532,8 @@
          LOGICAL :: lShl = .FALSE.
 !        Whether the mesh is fibers (Purkinje)
          LOGICAL :: lFib = .FALSE.
+!        Whether shape function gradients and Jacobians are cached
+         LOGICAL :: lCNx = .FALSE.
 !        Element type
          INTEGER(KIND=IKIND) :: eType = eType_NA
 !        Number of nodes (control points) in a single element
@@ -581,6 +612,13 @@
          REAL(KIND=RKIND), ALLOCATABLE :: Nx(:,:,:)
 !        Second derivatives of shape functions - used for shells & IGA
          REAL(KIND=RKIND), ALLOCATABLE :: Nxx(:,:,:)
+!        Cached shape function gradients in the reference configuration
+!        at each Gauss point of each element (nsd,eNoN,nG,nEl)
+         REAL(KIND=RKIND), ALLOCATABLE :: cNx(:,:,:,:)
+!        Cached element Jacobian at each Gauss point (nG,nEl)
+         REAL(KIND=RKIND), ALLOCATABLE :: cJac(:,:)
+!        Cached ksix at each Gauss point (nsd,nsd,nG,nEl)
+         REAL(KIND=RKIND), ALLOCATABLE :: cKs(:,:,:,:)
 !        Mesh Name
          CHARACTER(LEN=stdL) :: name
 !        Mesh nodal adjacency
@@ -693,9 +731,111 @@
          REAL(KIND=RKIND), ALLOCATABLE :: x(:,:)
       END TYPE dataType
 
+!     A post-processed field of one output group on one mesh
+      TYPE pstFldType
+!        Whether the field is computed
+         LOGICAL :: set = .FALSE.
+!        Number of components
+         INTEGER(KIND=IKIND) :: m = 0
+!        Nodal values
+         REAL(KIND=RKIND), ALLOCATABLE :: x(:,:)
+!        Element values
+         REAL(KIND=RKIND), ALLOCATABLE :: xe(:)
+      END TYPE pstFldType
+
+!     Post-processed fields shared between the outputs (TXT and VTK)
+!     of one time step
+      TYPE pstCacheType
+!        Whether the cache is in use
+         LOGICAL :: on = .FALSE.
+!        Time step the cached fields belong to
+         INTEGER(KIND=IKIND) :: cTS = -1
+!        Fields (output group, equation, mesh)
+         TYPE(pstFldType), ALLOCATABLE :: fld(:,:,:)
+      END TYPE pstCacheType
+
+!     Output probe: a subset of the domain written at its own frequency
+      TYPE prbType
+!        Probe type
+         INTEGER(KIND=IKIND) :: pType = prbType_NA
+!        Output increment (time steps)
+         INTEGER(KIND=IKIND) :: incr = 1
+!        Mesh and face of a face probe
+         INTEGER(KIND=IKIND) :: iM = 0
+         INTEGER(KIND=IKIND) :: iFa = 0
+!        Number of local nodes (face/box) or of points (points)
+         INTEGER(KIND=IKIND) :: n = 0
+!        Total number of nodes or points
+         INTEGER(KIND=IKIND) :: gn = 0
+!        Number of fields
+         INTEGER(KIND=IKIND) :: nFld = 0
+!        Equation and output of each field
+         INTEGER(KIND=IKIND), ALLOCATABLE :: fld(:,:)
+!        Local nodes of a face/box probe
+         INTEGER(KIND=IKIND), ALLOCATABLE :: nd(:)
+!        Number of nodes on each process (master)
+         INTEGER(KIND=IKIND), ALLOCATABLE :: nP(:)
+!        Gathered position of the nodes sorted by global ID (master)
+         INTEGER(KIND=IKIND), ALLOCATABLE :: ord(:)
+!        Global ID of the nodes (master)
+         INTEGER(KIND=IKIND), ALLOCATABLE :: id(:)
+!        Mesh and element containing each point, if owned
+         INTEGER(KIND=IKIND), ALLOCATABLE :: pE(:,:)
+!        Box lower and upper corners
+         REAL(KIND=RKIND) :: xb(maxnsd,2) = 0._RKIND
+!        Shape functions of each point within its element
+         REAL(KIND=RKIND), ALLOCATABLE :: pN(:,:)
+!        Coordinates of the nodes (master) or points
+         REAL(KIND=RKIND), ALLOCATABLE :: x(:,:)
+!        Name of the probe
+         CHARACTER(LEN=stdL) :: name = ""
+      END TYPE prbType
+
+!     Time and phase averaged statistics accumulated during the run
+      TYPE aveType
+!        Whether statistics are accumulated during the time loop
+         LOGICAL :: strm = .FALSE.
+!        Number of samples
+         INTEGER(KIND=IKIND) :: n = 0
+!        First and last sampled time steps
+         INTEGER(KIND=IKIND) :: fTS = 0
+         INTEGER(KIND=IKIND) :: lTS = 0
+!        Equation whose WSS is used for TAWSS, OSI and RRT (0 if none)
+         INTEGER(KIND=IKIND) :: iEqW = 0
+!        Number of phase bins
+         INTEGER(KIND=IKIND) :: nPh = 0
+!        Number of time steps in one cycle
+         INTEGER(KIND=IKIND) :: nCyc = 0
+!        Number of extra nodal fields written with the averages
+         INTEGER(KIND=IKIND) :: nX = 0
+!        Number of samples in each phase bin
+         INTEGER(KIND=IKIND), ALLOCATABLE :: nP(:)
+!        Offsets of the extra nodal fields
+         INTEGER(KIND=IKIND), ALLOCATABLE :: xS(:)
+!        Sums of A, Y and D
+         REAL(KIND=RKIND), ALLOCATABLE :: A(:,:)
+         REAL(KIND=RKIND), ALLOCATABLE :: Y(:,:)
+         REAL(KIND=RKIND), ALLOCATABLE :: D(:,:)
+!        Running mean of Y and sum of squared deviations from it
+         REAL(KIND=RKIND), ALLOCATABLE :: Ym(:,:)
+         REAL(KIND=RKIND), ALLOCATABLE :: Ys(:,:)
+!        Sums of WSS vector and WSS magnitude
+         REAL(KIND=RKIND), ALLOCATABLE :: wV(:,:)
+         REAL(KIND=RKIND), ALLOCATABLE :: wM(:)
+!        Phase binned sums of A, Y and D
+         REAL(KIND=RKIND), ALLOCATABLE :: pA(:,:,:)
+         REAL(KIND=RKIND), ALLOCATABLE :: pY(:,:,:)
+         REAL(KIND=RKIND), ALLOCATABLE :: pD(:,:,:)
+!        Extra nodal fields
+         REAL(KIND=RKIND), ALLOCATABLE :: x(:,:)
+!        Names of the extra nodal fields
+         CHARACTER(LEN=stdL), ALLOCATABLE :: xName(:)
+      END TYPE aveType
       TYPE rmshType
 !     Whether remesh is required for problem or not
          LOGICAL :: isReqd
+!     Whether TetGen is run ahead, overlapped with time stepping
+         LOGICAL :: ovlp = .FALSE.
 !     Method for remeshing: 1-TetGen, 2-MeshSim
          INTEGER(KIND=IKIND) :: method
 !     Counter to track number of remesh done
@@ -710,6 +850,8 @@
          INTEGER(KIND=IKIND) :: freq
 !     Time where remeshing starts
          REAL(KIND=RKIND) :: time
+!     Min normalized Jacobian below which remeshing is run ahead
+         REAL(KIND=RKIND) :: ovlpJ = 0._RKIND
 !     Mesh quality parameters
          REAL(KIND=RKIND) :: minDihedAng
          REAL(KIND=RKIND) :: maxRadRatio
@@ -723,6 +865,8 @@
          REAL(KIND=RKIND), ALLOCATABLE :: D0(:,:)
 !     Flag is set if remeshing is required for each mesh
          LOGICAL, ALLOCATABLE :: flag(:)
+!     Min normalized Jacobian of each mesh at the last check
+         REAL(KIND=RKIND), ALLOCATABLE :: minJ(:)
       END TYPE rmshType
 
       TYPE ibCommType
@@ -849,6 +993,9 @@
       LOGICAL ibFlag
 !     Postprocess step - convert bin to vtk
       LOGICAL bin2VTK
+!     Whether the matrix-free operator is being evaluated, in which
+!     case DOASSEM applies the element tangents to mfU
+      LOGICAL :: mfApply = .FALSE.
 
 !     INTEGER(KIND=IKIND) VARIABLES
 !     Current domain
@@ -869,6 +1016,8 @@
       INTEGER(KIND=IKIND) nFacesLS
 !     Number of meshes
       INTEGER(KIND=IKIND) nMsh
+!     Number of output probes
+      INTEGER(KIND=IKIND) :: nPrb = 0
 !     Number of spatial dimensions
       INTEGER(KIND=IKIND) nsd
 !     Number of time steps
@@ -941,6 +1090,14 @@
       REAL(KIND=RKIND), ALLOCATABLE :: R(:,:)
 !     LHS matrix
       REAL(KIND=RKIND), ALLOCATABLE :: Val(:,:)
+!     Diagonal of the LHS matrix, assembled instead of Val when the
+!     LHS is applied matrix-free
+      REAL(KIND=RKIND), ALLOCATABLE :: mfD(:,:)
+!     Vector the element tangents are applied to, and the product,
+!     while the matrix-free operator is evaluated
+      REAL(KIND=RKIND), ALLOCATABLE :: mfU(:,:), mfKU(:,:)
+!     State about which the matrix-free operator is linearized
+      REAL(KIND=RKIND), ALLOCATABLE :: mfAg(:,:), mfYg(:,:), mfDg(:,:)
 !     Position vector
       REAL(KIND=RKIND), ALLOCATABLE :: x(:,:)
 !     Old variables (velocity)
@@ -989,6 +1146,12 @@
       TYPE(cmType) cm
 !     Remesher type
       TYPE(rmshType) rmsh
+!     Post-processed fields cache
+      TYPE(pstCacheType) pstC
+!     Time and phase averages
+      TYPE(aveType) ave
+!     Output probes
+      TYPE(prbType), ALLOCATABLE :: prb(:)
 !     Contact model type
       TYPE(cntctModelType) cntctM
 !     IB: Immersed boundary data structure
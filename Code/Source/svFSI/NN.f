@@ -1429,6 +1429,49 @@ c        N(8) = lx*my*0.5_RKIND
       RETURN
       END SUBROUTINE GNN
 !--------------------------------------------------------------------
+!     Precompute the shape function gradients, Jacobian and ksix at all
+!     the Gauss points of a mesh in the reference configuration. These
+!     are reused by the element assembly routines that integrate over
+!     the reference configuration, trading memory for the cost of GNN.
+      SUBROUTINE GNNCACHE(lM)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      TYPE(mshType), INTENT(INOUT) :: lM
+
+      INTEGER(KIND=IKIND) a, e, g, Ac, eNoN
+      REAL(KIND=RKIND), ALLOCATABLE :: xl(:,:)
+
+      IF (lM%eType.EQ.eType_NRB .OR. lM%lShl .OR. lM%lFib) THEN
+         wrn = "Shape function gradients are not cached for NURBS,"//
+     2      " shell or fiber mesh <"//TRIM(lM%name)//">"
+         lM%lCNx = .FALSE.
+         RETURN
+      END IF
+
+      eNoN = lM%eNoN
+      IF (ALLOCATED(lM%cNx))  DEALLOCATE(lM%cNx)
+      IF (ALLOCATED(lM%cJac)) DEALLOCATE(lM%cJac)
+      IF (ALLOCATED(lM%cKs))  DEALLOCATE(lM%cKs)
+      ALLOCATE(lM%cNx(nsd,eNoN,lM%nG,lM%nEl), lM%cJac(lM%nG,lM%nEl),
+     2   lM%cKs(nsd,nsd,lM%nG,lM%nEl), xl(nsd,eNoN))
+
+      DO e=1, lM%nEl
+         DO a=1, eNoN
+            Ac = lM%IEN(a,e)
+            xl(:,a) = x(:,Ac)
+         END DO
+         DO g=1, lM%nG
+            CALL GNN(eNoN, nsd, lM%Nx(:,:,g), xl, lM%cNx(:,:,g,e),
+     2         lM%cJac(g,e), lM%cKs(:,:,g,e))
+            IF (ISZERO(lM%cJac(g,e))) err = "Jac < 0 @ element "//e
+         END DO
+      END DO
+      DEALLOCATE(xl)
+
+      RETURN
+      END SUBROUTINE GNNCACHE
+!--------------------------------------------------------------------
 !     Compute shell kinematics: normal vector, covariant & contravariant
 !     basis vectors
       SUBROUTINE GNNS(eNoN, Nxi, xl, nV, gCov, gCnv)
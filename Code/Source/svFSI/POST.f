@@ -50,68 +50,98 @@
       REAL(KIND=RKIND), ALLOCATABLE :: tmpV(:,:), tmpVe(:)
 
       DO iM=1, nMsh
-         IF (ALLOCATED(tmpV)) DEALLOCATE(tmpV)
-         ALLOCATE(tmpV(maxnsd,msh(iM)%nNo))
-         IF (outGrp.EQ.outGrp_WSS .OR. outGrp.EQ.outGrp_trac) THEN
-            CALL BPOST(msh(iM), tmpV, lY, lD, outGrp)
-            DO a=1, msh(iM)%nNo
-               Ac = msh(iM)%gN(a)
-               res(:,Ac) = tmpV(:,a)
-            END DO
-
-         ELSE IF (outGrp .EQ. outGrp_J) THEN
-            IF (ALLOCATED(tmpV)) DEALLOCATE(tmpV)
-            ALLOCATE(tmpV(1,msh(iM)%nNo), tmpVe(msh(iM)%nEl))
-            tmpV  = 0._RKIND
-            tmpVe = 0._RKIND
-            CALL TPOST(msh(iM), 1, tmpV, tmpVe, lD, lY, iEq, outGrp)
-            res  = 0._RKIND
-            DO a=1, msh(iM)%nNo
-               Ac = msh(iM)%gN(a)
-               res(1,Ac) = tmpV(1,a)
-            END DO
-            DEALLOCATE(tmpV, tmpVe)
-            ALLOCATE(tmpV(maxnsd,msh(iM)%nNo))
-
-         ELSE IF (outGrp .EQ. outGrp_mises) THEN
-            IF (ALLOCATED(tmpV)) DEALLOCATE(tmpV)
-            ALLOCATE(tmpV(1,msh(iM)%nNo), tmpVe(msh(iM)%nEl))
-            tmpV  = 0._RKIND
-            tmpVe = 0._RKIND
-            CALL TPOST(msh(iM), 1, tmpV, tmpVe, lD, lY, iEq, outGrp)
-            res  = 0._RKIND
-            DO a=1, msh(iM)%nNo
-               Ac = msh(iM)%gN(a)
-               res(1,Ac) = tmpV(1,a)
-            END DO
-            DEALLOCATE(tmpV, tmpVe)
-            ALLOCATE(tmpV(maxnsd,msh(iM)%nNo))
-
-         ELSE IF (outGrp .EQ. outGrp_divV) THEN
-            IF (ALLOCATED(tmpV)) DEALLOCATE(tmpV)
+         ALLOCATE(tmpVe(msh(iM)%nEl))
+         IF (outGrp.EQ.outGrp_J .OR. outGrp.EQ.outGrp_mises .OR.
+     2       outGrp.EQ.outGrp_divV) THEN
             ALLOCATE(tmpV(1,msh(iM)%nNo))
-            tmpV = 0._RKIND
-            CALL DIVPOST(msh(iM), tmpV, lY, lD, iEq)
+            CALL PSTFLD(iM, 1, tmpV, tmpVe, lY, lD, outGrp, iEq)
             res  = 0._RKIND
             DO a=1, msh(iM)%nNo
                Ac = msh(iM)%gN(a)
                res(1,Ac) = tmpV(1,a)
             END DO
-            DEALLOCATE(tmpV)
-            ALLOCATE(tmpV(maxnsd,msh(iM)%nNo))
-
          ELSE
-            CALL POST(msh(iM), tmpV, lY, lD, outGrp, iEq)
+            ALLOCATE(tmpV(maxnsd,msh(iM)%nNo))
+            CALL PSTFLD(iM, maxnsd, tmpV, tmpVe, lY, lD, outGrp, iEq)
             DO a=1, msh(iM)%nNo
                Ac = msh(iM)%gN(a)
                res(:,Ac) = tmpV(:,a)
             END DO
          END IF
+         DEALLOCATE(tmpV, tmpVe)
       END DO
 
       RETURN
       END SUBROUTINE ALLPOST
 !--------------------------------------------------------------------
+!     Computes the post-processed field of output group outGrp on mesh
+!     iM, with m components per node (maxnsd for POST/BPOST groups).
+!     While the cache is open (see PSTCACHE), every field is computed
+!     only once per time step and shared by all the outputs.
+      SUBROUTINE PSTFLD(iM, m, res, resE, lY, lD, outGrp, iEq)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: iM, m, outGrp, iEq
+      REAL(KIND=RKIND), INTENT(OUT) :: res(m,msh(iM)%nNo),
+     2   resE(msh(iM)%nEl)
+      REAL(KIND=RKIND), INTENT(IN) :: lY(tDof,tnNo), lD(tDof,tnNo)
+
+      LOGICAL lC
+
+      lC = pstC%on .AND. pstC%cTS.EQ.cTS
+      IF (lC) THEN
+         IF (.NOT.ALLOCATED(pstC%fld))
+     2      ALLOCATE(pstC%fld(outGrp_NA:outGrp_Visc,nEq,nMsh))
+         IF (pstC%fld(outGrp,iEq,iM)%set .AND.
+     2       pstC%fld(outGrp,iEq,iM)%m.EQ.m) THEN
+            res  = pstC%fld(outGrp,iEq,iM)%x
+            resE = pstC%fld(outGrp,iEq,iM)%xe
+            RETURN
+         END IF
+      END IF
+
+      res  = 0._RKIND
+      resE = 0._RKIND
+      SELECT CASE (outGrp)
+      CASE (outGrp_WSS, outGrp_trac)
+         CALL BPOST(msh(iM), res, lY, lD, outGrp)
+      CASE (outGrp_vort, outGrp_eFlx, outGrp_hFlx, outGrp_stInv,
+     2   outGrp_vortex, outGrp_Visc)
+         CALL POST(msh(iM), res, lY, lD, outGrp, iEq)
+      CASE (outGrp_stress, outGrp_cauchy, outGrp_mises, outGrp_J,
+     2   outGrp_F, outGrp_strain)
+         CALL TPOST(msh(iM), m, res, resE, lD, lY, iEq, outGrp)
+      CASE (outGrp_divV)
+         CALL DIVPOST(msh(iM), res, lY, lD, iEq)
+      CASE DEFAULT
+         err = "Undefined output group in PSTFLD"
+      END SELECT
+
+      IF (lC) THEN
+         pstC%fld(outGrp,iEq,iM)%set = .TRUE.
+         pstC%fld(outGrp,iEq,iM)%m   = m
+         pstC%fld(outGrp,iEq,iM)%x   = res
+         pstC%fld(outGrp,iEq,iM)%xe  = resE
+      END IF
+
+      RETURN
+      END SUBROUTINE PSTFLD
+!--------------------------------------------------------------------
+!     Opens (lOn = .TRUE.) or closes the post-processed fields cache
+!     for the current time step. Any previously cached field is freed.
+      SUBROUTINE PSTCACHE(lOn)
+      USE COMMOD
+      IMPLICIT NONE
+      LOGICAL, INTENT(IN) :: lOn
+
+      IF (ALLOCATED(pstC%fld)) DEALLOCATE(pstC%fld)
+      pstC%on  = lOn
+      pstC%cTS = cTS
+
+      RETURN
+      END SUBROUTINE PSTCACHE
+!--------------------------------------------------------------------
 !     General purpose routine for post processing outputs.
       SUBROUTINE POST(lM, res, lY, lD, outGrp, iEq)
       USE COMMOD
@@ -0,0 +1,520 @@
+!
+! Copyright (c) Stanford University, The Regents of the University of
+!               California, and others.
+!
+! All Rights Reserved.
+!
+! See Copyright-SimVascular.txt for additional details.
+!
+! Permission is hereby granted, free of charge, to any person obtaining
+! a copy of this software and associated documentation files (the
+! "Software"), to deal in the Software without restriction, including
+! without limitation the rights to use, copy, modify, merge, publish,
+! distribute, sublicense, and/or sell copies of the Software, and to
+! permit persons to whom the Software is furnished to do so, subject
+! to the following conditions:
+!
+! The above copyright notice and this permission notice shall be included
+! in all copies or substantial portions of the Software.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+! IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+! TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+! PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+! OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+! EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+! PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+! LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+! NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+! SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+!     Output probes: a face, the nodes inside a box, or a set of points
+!     located with FINDE. Every field of a probe is written to its own
+!     "P_" text file at the probe's output frequency.
+!
+!--------------------------------------------------------------------
+
+!     Reads a probe (master only)
+      SUBROUTINE READPRB(lPrb, list)
+      USE COMMOD
+      USE ALLFUN
+      USE LISTMOD
+      IMPLICIT NONE
+      TYPE(prbType), INTENT(INOUT) :: lPrb
+      TYPE(listType), INTENT(INOUT) :: list
+
+      INTEGER(KIND=IKIND) i, iEq, iOut, fid, ios
+      REAL(KIND=RKIND) xp(maxnsd)
+      CHARACTER(LEN=stdL) ctmp
+      TYPE(listType), POINTER :: lPtr
+      TYPE(fileType) fTmp
+
+      lPtr => list%get(ctmp, "Type", 1)
+      SELECT CASE (TRIM(ctmp))
+      CASE ("Face")
+         lPrb%pType = prbType_face
+         lPtr => list%get(ctmp, "Face", 1)
+         CALL FINDFACE(ctmp, lPrb%iM, lPrb%iFa)
+      CASE ("Box")
+         lPrb%pType = prbType_box
+         lPtr => list%get(lPrb%xb(1:nsd,1), "Lower corner", 1)
+         lPtr => list%get(lPrb%xb(1:nsd,2), "Upper corner", 1)
+      CASE ("Points")
+         lPrb%pType = prbType_pnts
+         lPrb%gn = list%srch("Point")
+         IF (lPrb%gn .GT. 0) THEN
+            ALLOCATE(lPrb%x(nsd,lPrb%gn))
+            DO i=1, lPrb%gn
+               lPtr => list%get(lPrb%x(:,i), "Point", i)
+            END DO
+         ELSE
+            lPtr => list%get(fTmp, "Points file path", 1)
+            fid = fTmp%open()
+            DO
+               READ(fid,*,IOSTAT=ios) xp(1:nsd)
+               IF (ios .NE. 0) EXIT
+               lPrb%gn = lPrb%gn + 1
+            END DO
+            REWIND(fid)
+            ALLOCATE(lPrb%x(nsd,lPrb%gn))
+            DO i=1, lPrb%gn
+               READ(fid,*) lPrb%x(:,i)
+            END DO
+            CLOSE(fid)
+         END IF
+         IF (lPrb%gn .EQ. 0) err = "No point is given for probe <"//
+     2      TRIM(lPrb%name)//">"
+      CASE DEFAULT
+         err = "Undefined probe type <"//TRIM(ctmp)//">"
+      END SELECT
+      IF (rmsh%isReqd .AND. lPrb%pType.NE.prbType_pnts) err =
+     2   "Only point probes are allowed with remeshing"
+
+      lPtr => list%get(lPrb%incr, "Increment", ll=1)
+
+!     Fields are the outputs of the equations, picked by name
+      lPrb%nFld = list%srch("Field", ll=1)
+      ALLOCATE(lPrb%fld(2,lPrb%nFld))
+      lPrb%fld = 0
+      DO i=1, lPrb%nFld
+         lPtr => list%get(ctmp, "Field", i)
+         DO iEq=1, nEq
+            DO iOut=1, eq(iEq)%nOutput
+               IF (eq(iEq)%output(iOut)%name .EQ. ctmp) THEN
+                  lPrb%fld(1,i) = iEq
+                  lPrb%fld(2,i) = iOut
+                  EXIT
+               END IF
+            END DO
+            IF (lPrb%fld(1,i) .NE. 0) EXIT
+         END DO
+         IF (lPrb%fld(1,i) .EQ. 0) err = "Probe field <"//TRIM(ctmp)//
+     2      "> is not an output of any equation"
+         SELECT CASE (eq(iEq)%output(iOut)%grp)
+         CASE (outGrp_NA, outGrp_I, outGrp_fN, outGrp_fA)
+            err = "Output <"//TRIM(ctmp)//"> cannot be probed"
+         END SELECT
+      END DO
+
+      RETURN
+      END SUBROUTINE READPRB
+!####################################################################
+!     Finds the local nodes/points of all probes and writes the headers
+!     of their files
+      SUBROUTINE PRBINIT()
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+
+      INTEGER(KIND=IKIND) iPrb
+
+      DO iPrb=1, nPrb
+         IF (prb(iPrb)%pType .EQ. prbType_pnts) THEN
+            CALL PRBINITP(prb(iPrb))
+         ELSE
+            CALL PRBINITN(prb(iPrb))
+         END IF
+         CALL PRBHDR(prb(iPrb))
+      END DO
+
+      RETURN
+      END SUBROUTINE PRBINIT
+!--------------------------------------------------------------------
+!     Face and box probes: nodes are taken from the process that owns
+!     them and gathered on master, sorted by their global ID
+      SUBROUTINE PRBINITN(lPrb)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      TYPE(prbType), INTENT(INOUT) :: lPrb
+
+      INTEGER(KIND=IKIND) a, i, k, iM, ierr
+      INTEGER(KIND=IKIND), ALLOCATABLE :: sCount(:), disp(:), sI(:),
+     2   gI(:), ptr(:)
+      LOGICAL, ALLOCATABLE :: flag(:)
+      REAL(KIND=RKIND), ALLOCATABLE :: sX(:,:), gX(:,:), scF(:)
+
+!     Box corners and written coordinates are in the units of the mesh
+!     files, as in the VTK outputs
+      ALLOCATE(flag(tnNo), scF(tnNo))
+      scF = 1._RKIND
+      DO iM=1, nMsh
+         DO a=1, msh(iM)%nNo
+            scF(msh(iM)%gN(a)) = msh(iM)%scF
+         END DO
+      END DO
+
+      flag = .FALSE.
+      IF (lPrb%pType .EQ. prbType_face) THEN
+         DO a=1, msh(lPrb%iM)%fa(lPrb%iFa)%nNo
+            flag(msh(lPrb%iM)%fa(lPrb%iFa)%gN(a)) = .TRUE.
+         END DO
+      ELSE
+         DO a=1, tnNo
+            flag(a) = ALL(x(:,a).GE.lPrb%xb(1:nsd,1)*scF(a) .AND.
+     2                    x(:,a).LE.lPrb%xb(1:nsd,2)*scF(a))
+         END DO
+      END IF
+      DO a=1, tnNo
+         IF (lhs%map(a) .GT. lhs%mynNo) flag(a) = .FALSE.
+      END DO
+
+      lPrb%n = COUNT(flag)
+      ALLOCATE(lPrb%nd(lPrb%n), sI(lPrb%n), sX(nsd,lPrb%n))
+      i = 0
+      DO a=1, tnNo
+         IF (.NOT.flag(a)) CYCLE
+         i = i + 1
+         lPrb%nd(i) = a
+         sI(i)      = ltg(a)
+         sX(:,i)    = x(:,a)/scF(a)
+      END DO
+      lPrb%gn = cm%reduce(lPrb%n)
+      IF (lPrb%gn .EQ. 0) err = "No node is found for probe <"//
+     2   TRIM(lPrb%name)//">"
+
+      ALLOCATE(lPrb%nP(cm%np()), sCount(cm%np()), disp(cm%np()))
+      CALL MPI_GATHER(lPrb%n, 1, mpint, lPrb%nP, 1, mpint, master,
+     2   cm%com(), ierr)
+      disp(1) = 0
+      DO i=2, cm%np()
+         disp(i) = disp(i-1) + lPrb%nP(i-1)
+      END DO
+      IF (cm%mas()) THEN
+         ALLOCATE(gI(lPrb%gn), gX(nsd,lPrb%gn))
+      ELSE
+         ALLOCATE(gI(0), gX(0,0))
+      END IF
+      CALL MPI_GATHERV(sI, lPrb%n, mpint, gI, lPrb%nP, disp, mpint,
+     2   master, cm%com(), ierr)
+      sCount = nsd*lPrb%nP
+      disp   = nsd*disp
+      CALL MPI_GATHERV(sX, nsd*lPrb%n, mpreal, gX, sCount, disp,
+     2   mpreal, master, cm%com(), ierr)
+
+      IF (cm%mas()) THEN
+         ALLOCATE(ptr(gtnNo), lPrb%ord(lPrb%gn), lPrb%id(lPrb%gn),
+     2      lPrb%x(nsd,lPrb%gn))
+         ptr = 0
+         DO i=1, lPrb%gn
+            ptr(gI(i)) = i
+         END DO
+         k = 0
+         DO a=1, gtnNo
+            IF (ptr(a) .EQ. 0) CYCLE
+            k = k + 1
+            lPrb%ord(k)  = ptr(a)
+            lPrb%id(k)   = a
+            lPrb%x(:,k)  = gX(:,ptr(a))
+         END DO
+         DEALLOCATE(ptr)
+      END IF
+
+      DEALLOCATE(flag, scF, sI, sX, gI, gX, sCount, disp)
+
+      RETURN
+      END SUBROUTINE PRBINITN
+!--------------------------------------------------------------------
+!     Point probes: every point is located with FINDE and kept by the
+!     lowest ranked process that contains it
+      SUBROUTINE PRBINITP(lPrb)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      TYPE(prbType), INTENT(INOUT) :: lPrb
+
+      INTEGER(KIND=IKIND) a, e, i, p, iM, Ac, Ec, ne, eNoN, maxeNoN
+      REAL(KIND=RKIND) xi(nsd), xp(nsd), xMin(nsd), xMax(nsd)
+
+      INTEGER(KIND=IKIND), ALLOCATABLE :: eList(:), own(:)
+      REAL(KIND=RKIND), ALLOCATABLE :: Dz(:,:), Nxi(:,:)
+
+      lPrb%n  = lPrb%gn
+      maxeNoN = 0
+      DO iM=1, nMsh
+         maxeNoN = MAX(maxeNoN, msh(iM)%eNoN)
+      END DO
+      ALLOCATE(lPrb%pE(2,lPrb%n), lPrb%pN(maxeNoN,lPrb%n),
+     2   own(lPrb%n), Dz(nsd,tnNo), Nxi(nsd,maxeNoN))
+      lPrb%pE = 0
+      lPrb%pN = 0._RKIND
+      Dz      = 0._RKIND
+
+      DO iM=1, nMsh
+         IF (msh(iM)%lShl .OR. msh(iM)%eType.EQ.eType_NRB) CYCLE
+         eNoN = msh(iM)%eNoN
+         ALLOCATE(eList(msh(iM)%nEl))
+         DO p=1, lPrb%n
+            IF (lPrb%pE(1,p) .NE. 0) CYCLE
+!           Points are given in the units of the mesh files
+            xp = lPrb%x(:,p)*msh(iM)%scF
+!           Only elements whose bounding box holds the point are tried
+            ne = 0
+            DO e=1, msh(iM)%nEl
+               Ac   = msh(iM)%IEN(1,e)
+               xMin = x(:,Ac)
+               xMax = x(:,Ac)
+               DO a=2, eNoN
+                  Ac   = msh(iM)%IEN(a,e)
+                  xMin = MIN(xMin, x(:,Ac))
+                  xMax = MAX(xMax, x(:,Ac))
+               END DO
+               IF (ALL(xp.GE.xMin .AND. xp.LE.xMax)) THEN
+                  ne = ne + 1
+                  eList(ne) = e
+               END IF
+            END DO
+            IF (ne .EQ. 0) CYCLE
+
+            CALL FINDE(xp, msh(iM), x, Dz, tnNo, ne,
+     2         eList(1:ne), Ec, xi)
+            IF (Ec .EQ. 0) CYCLE
+            lPrb%pE(1,p) = iM
+            lPrb%pE(2,p) = Ec
+            CALL GETGNN(nsd, msh(iM)%eType, eNoN, xi,
+     2         lPrb%pN(1:eNoN,p), Nxi(:,1:eNoN))
+         END DO
+         DEALLOCATE(eList)
+      END DO
+
+      own = cm%np()
+      DO p=1, lPrb%n
+         IF (lPrb%pE(1,p) .NE. 0) own(p) = cm%id()
+      END DO
+      own = cm%reduce(own, MPI_MIN)
+      DO p=1, lPrb%n
+         IF (own(p) .NE. cm%id()) lPrb%pE(:,p) = 0
+         IF (own(p) .EQ. cm%np()) THEN
+            i = p
+            wrn = " Point "//STR(i)//" of probe <"//TRIM(lPrb%name)//
+     2         "> is outside the mesh"
+         END IF
+      END DO
+
+      DEALLOCATE(own, Dz, Nxi)
+
+      RETURN
+      END SUBROUTINE PRBINITP
+!--------------------------------------------------------------------
+!     Creates the files of a probe, or trims them to the current time
+!     step of a continued simulation
+      SUBROUTINE PRBHDR(lPrb)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      TYPE(prbType), INTENT(IN) :: lPrb
+
+      LOGICAL flag
+      INTEGER(KIND=IKIND) a, i, j, l, iFld, iEq, iOut, fid
+      CHARACTER(LEN=stdL) fName
+
+      IF (cm%slv()) RETURN
+
+      fid = 1
+      DO iFld=1, lPrb%nFld
+         iEq  = lPrb%fld(1,iFld)
+         iOut = lPrb%fld(2,iFld)
+         l    = eq(iEq)%output(iOut)%l
+         fName = TRIM(appPath)//"P_"//TRIM(lPrb%name)//"_"//
+     2      TRIM(eq(iEq)%output(iOut)%name)//".txt"
+
+         INQUIRE(FILE=TRIM(fName), EXIST=flag)
+         IF (cTS.NE.0 .AND. flag) THEN
+            CALL TRIMFILE(1+nsd+cTS/lPrb%incr, fName)
+            CYCLE
+         END IF
+
+!        First row is the node ID (point number), next rows are the
+!        coordinates; each is repeated for all the field components
+         OPEN(fid, FILE=TRIM(fName))
+         WRITE(fid,'(A)',ADVANCE='NO') "ID"
+         DO a=1, lPrb%gn
+            j = a
+            IF (lPrb%pType .NE. prbType_pnts) j = lPrb%id(a)
+            DO i=1, l
+               WRITE(fid,'(A)',ADVANCE='NO') " "//STR(j)
+            END DO
+         END DO
+         WRITE(fid,*)
+         DO j=1, nsd
+            WRITE(fid,'(A)',ADVANCE='NO') "X"//STR(j)
+            DO a=1, lPrb%gn
+               DO i=1, l
+                  WRITE(fid,'(A)',ADVANCE='NO') " "//
+     2               STR(lPrb%x(j,a))
+               END DO
+            END DO
+            WRITE(fid,*)
+         END DO
+         CLOSE(fid)
+      END DO
+
+      RETURN
+      END SUBROUTINE PRBHDR
+!####################################################################
+!     Writes the probes that are due at this time step
+      SUBROUTINE PRBOUT(lA, lY, lD)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      REAL(KIND=RKIND), INTENT(IN) :: lA(tDof,tnNo), lY(tDof,tnNo),
+     2   lD(tDof,tnNo)
+
+      INTEGER(KIND=IKIND) a, i, k, l, p, iPrb, iFld, iEq, iOut, iM, Ec,
+     2   Ac, fid, ierr
+      CHARACTER(LEN=stdL) fName
+
+      INTEGER(KIND=IKIND), ALLOCATABLE :: sCount(:), disp(:)
+      REAL(KIND=RKIND), ALLOCATABLE :: tmpV(:,:), sV(:,:), gV(:,:)
+
+      fid = 1
+      DO iPrb=1, nPrb
+         IF (MOD(cTS,prb(iPrb)%incr) .NE. 0) CYCLE
+         DO iFld=1, prb(iPrb)%nFld
+            iEq  = prb(iPrb)%fld(1,iFld)
+            iOut = prb(iPrb)%fld(2,iFld)
+            l    = eq(iEq)%output(iOut)%l
+            ALLOCATE(tmpV(l,tnNo), sV(l,prb(iPrb)%n))
+            CALL PRBFLD(iEq, iOut, l, lA, lY, lD, tmpV)
+
+            IF (cm%mas()) THEN
+               ALLOCATE(gV(l,prb(iPrb)%gn))
+            ELSE
+               ALLOCATE(gV(0,0))
+            END IF
+            IF (prb(iPrb)%pType .EQ. prbType_pnts) THEN
+               sV = 0._RKIND
+               DO p=1, prb(iPrb)%n
+                  iM = prb(iPrb)%pE(1,p)
+                  IF (iM .EQ. 0) CYCLE
+                  Ec = prb(iPrb)%pE(2,p)
+                  DO a=1, msh(iM)%eNoN
+                     Ac = msh(iM)%IEN(a,Ec)
+                     sV(:,p) = sV(:,p) + prb(iPrb)%pN(a,p)*tmpV(:,Ac)
+                  END DO
+               END DO
+               CALL MPI_REDUCE(sV, gV, l*prb(iPrb)%n, mpreal, MPI_SUM,
+     2            master, cm%com(), ierr)
+            ELSE
+               DO i=1, prb(iPrb)%n
+                  sV(:,i) = tmpV(:,prb(iPrb)%nd(i))
+               END DO
+               ALLOCATE(sCount(cm%np()), disp(cm%np()))
+               IF (cm%mas()) THEN
+                  sCount  = l*prb(iPrb)%nP
+                  disp(1) = 0
+                  DO i=2, cm%np()
+                     disp(i) = disp(i-1) + sCount(i-1)
+                  END DO
+               END IF
+               CALL MPI_GATHERV(sV, l*prb(iPrb)%n, mpreal, gV, sCount,
+     2            disp, mpreal, master, cm%com(), ierr)
+               DEALLOCATE(sCount, disp)
+            END IF
+
+            IF (cm%mas()) THEN
+               fName = TRIM(appPath)//"P_"//TRIM(prb(iPrb)%name)//"_"//
+     2            TRIM(eq(iEq)%output(iOut)%name)//".txt"
+               OPEN(fid, FILE=TRIM(fName), STATUS='OLD',
+     2            POSITION='APPEND')
+               WRITE(fid,'(A)',ADVANCE='NO') STR(cTS)
+               DO k=1, prb(iPrb)%gn
+                  p = k
+                  IF (prb(iPrb)%pType .NE. prbType_pnts)
+     2               p = prb(iPrb)%ord(k)
+                  DO i=1, l
+                     WRITE(fid,'(A)',ADVANCE='NO') " "//STR(gV(i,p))
+                  END DO
+               END DO
+               WRITE(fid,*)
+               CLOSE(fid)
+            END IF
+            DEALLOCATE(tmpV, sV, gV)
+         END DO
+      END DO
+
+      RETURN
+      END SUBROUTINE PRBOUT
+!--------------------------------------------------------------------
+!     Nodal values of output iOut of equation iEq. Post-processed fields
+!     come from PSTFLD, and hence are shared with the other outputs.
+      SUBROUTINE PRBFLD(iEq, iOut, l, lA, lY, lD, res)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: iEq, iOut, l
+      REAL(KIND=RKIND), INTENT(IN) :: lA(tDof,tnNo), lY(tDof,tnNo),
+     2   lD(tDof,tnNo)
+      REAL(KIND=RKIND), INTENT(OUT) :: res(l,tnNo)
+
+      INTEGER(KIND=IKIND) a, s, e, m, iM, Ac, oGrp
+
+      REAL(KIND=RKIND), ALLOCATABLE :: tmpV(:,:), tmpVe(:)
+
+      s    = eq(iEq)%s + eq(iEq)%output(iOut)%o
+      e    = s + l - 1
+      oGrp = eq(iEq)%output(iOut)%grp
+      res  = 0._RKIND
+
+      SELECT CASE (oGrp)
+      CASE (outGrp_A)
+         res = lA(s:e,:)
+      CASE (outGrp_Y)
+         res = lY(s:e,:)
+      CASE (outGrp_D)
+         DO iM=1, nMsh
+            DO a=1, msh(iM)%nNo
+               Ac = msh(iM)%gN(a)
+               res(:,Ac) = lD(s:e,Ac)/msh(iM)%scF
+            END DO
+         END DO
+      CASE (outGrp_absV)
+         DO a=1, tnNo
+            res(:,a) = lY(1:nsd,a) - lY(nsd+2:2*nsd+1,a)
+         END DO
+      CASE DEFAULT
+         IF (cmmInit .AND. (oGrp.EQ.outGrp_stress .OR.
+     2      oGrp.EQ.outGrp_cauchy .OR. oGrp.EQ.outGrp_mises)) RETURN
+         m = l
+         SELECT CASE (oGrp)
+         CASE (outGrp_WSS, outGrp_trac, outGrp_vort, outGrp_eFlx,
+     2      outGrp_hFlx, outGrp_stInv, outGrp_vortex, outGrp_Visc)
+            m = maxnsd
+         END SELECT
+         DO iM=1, nMsh
+            ALLOCATE(tmpV(m,msh(iM)%nNo), tmpVe(msh(iM)%nEl))
+            CALL PSTFLD(iM, m, tmpV, tmpVe, lY, lD, oGrp, iEq)
+            DO a=1, msh(iM)%nNo
+               Ac = msh(iM)%gN(a)
+               res(:,Ac) = tmpV(1:l,a)
+            END DO
+            DEALLOCATE(tmpV, tmpVe)
+         END DO
+         IF (pstEq .AND. (oGrp.EQ.outGrp_stress .OR.
+     2      oGrp.EQ.outGrp_cauchy)) res = res + pS0
+      END SELECT
+
+      RETURN
+      END SUBROUTINE PRBFLD
+!####################################################################
@@ -188,6 +188,9 @@
 
          lPtr => list%get(saveAve,"Save averaged results")
          lPtr => list%get(zeroAve,"Start averaging from zero")
+         lPtr => list%get(ave%nPh,"Number of phase bins",ll=0)
+         IF (ave%nPh .GT. 0) lPtr => list%get(ave%nCyc,
+     2      "Time steps per cycle",1,ll=1)
 
          lPtr => list%get(stFileRepl,"Overwrite restart file")
          IF (.NOT.saveVTK .AND. stFileRepl) wrn = " Overwriting "//
@@ -305,6 +308,15 @@
          END IF
       END IF
 
+!--------------------------------------------------------------------
+!     Reading output probes
+      nPrb = list%srch("Add probe")
+      ALLOCATE(prb(nPrb))
+      DO i=1, nPrb
+         lPtr => list%get(prb(i)%name,"Add probe",i)
+         CALL READPRB(prb(i), lPtr)
+      END DO
+
       IF (.NOT.ALLOCATED(cplBC%xo)) THEN
          cplBC%nX = 0
          ALLOCATE(cplBC%xo(cplBC%nX))
@@ -884,6 +896,13 @@
          CALL READBC(lEq%bc(iBc), lPBC, lEq%phys)
       END DO
 
+!     Undefined Neumann BCs modify the LHS directly
+      IF (lEq%ls%mFree) THEN
+         IF (ANY(BTEST(lEq%bc(:)%bType,bType_undefNeu))) err =
+     2      "Undefined Neumann BC is not allowed with matrix-free "//
+     3      "operator"
+      END IF
+
 !     Initialize cplBC for RCR-type BC
       IF (ANY(BTEST(lEq%bc(:)%bType,bType_RCR))) THEN
          IF ((lEq%phys .NE. phys_fluid) .AND.
@@ -1174,6 +1193,14 @@
                lEq%ls%PREC_Type = PREC_RCS
                lEq%useTLS = .FALSE.
                stmp = CLR("RCS",3)
+            CASE('fsils-blockjacobi')
+               lEq%ls%PREC_Type = PREC_FSILS_BJ
+               lEq%useTLS = .FALSE.
+               stmp = CLR("FSILS-BlockJacobi",3)
+            CASE('fsils-ilu', 'fsils-blockilu')
+               lEq%ls%PREC_Type = PREC_FSILS_BILU
+               lEq%useTLS = .FALSE.
+               stmp = CLR("FSILS-BlockILU",3)
 #ifdef WITH_TRILINOS
             CASE('trilinos-diagonal')
                lEq%ls%PREC_Type = PREC_TRILINOS_DIAGONAL
@@ -1220,12 +1247,49 @@
          END IF
          std = " Using preconditioner: "//TRIM(stmp)
 
+         IF (lEq%ls%PREC_Type.EQ.PREC_FSILS_BJ .OR.
+     2       lEq%ls%PREC_Type.EQ.PREC_FSILS_BILU) THEN
+            IF (lSolverType .EQ. lSolver_NS) err = "FSILS block "//
+     2         "preconditioners are not available for NS solver"
+            IF (lEq%ls%PREC_Type.EQ.PREC_FSILS_BILU .AND.
+     2          lSolverType.NE.lSolver_GMRES) err = "FSILS block "//
+     3         "ILU preconditioner requires GMRES linear solver"
+         END IF
+
          IF (lEq%useTLS) THEN
             lPtr => lPL%get(lEq%assmTLS, "Use Trilinos for assembly")
             IF (lEq%assmTLS .AND. ibFlag) err = "Cannnot assemble "//
      2         "immersed bodies using Trilinos"
          END IF
 
+         lPtr => lPL%get(lEq%ls%mFree,"Matrix free")
+         IF (lEq%ls%mFree) THEN
+            IF (lEq%phys .NE. phys_fluid) err = "Matrix-free "//
+     2         "operator is only implemented for fluid equation"
+            IF (lSolverType .NE. lSolver_GMRES) err = "Matrix-free "//
+     2         "operator requires GMRES linear solver"
+            IF (lEq%ls%PREC_Type .NE. PREC_FSILS) err = "Matrix-"//
+     2         "free operator requires FSILS preconditioner"
+            IF (ibFlag) err = "Matrix-free operator is not "//
+     2         "implemented for immersed boundaries"
+            std = " Using matrix-free operator"
+         END IF
+
+         lPtr => lPL%get(lEq%FSILS%mixP,"Mixed precision")
+         IF (lEq%FSILS%mixP) THEN
+            IF (lSolverType.NE.lSolver_GMRES .AND.
+     2          lSolverType.NE.lSolver_CG) err = "Mixed precision "//
+     3         "is only implemented for GMRES and CG linear solvers"
+            IF (lEq%useTLS .OR. lEq%ls%mFree) err = "Mixed "//
+     2         "precision requires FSILS with an assembled LHS"
+            IF (lEq%ls%PREC_Type.EQ.PREC_FSILS_BJ .OR.
+     2          lEq%ls%PREC_Type.EQ.PREC_FSILS_BILU) err = "Mixed "//
+     3         "precision is not available with block preconditioners"
+            lPtr => lPL%get(lEq%FSILS%mRef,"Max refinement iterations",
+     2         ll=1)
+            std = " Using mixed-precision LHS with iterative refinement"
+         END IF
+
          lPtr => lPL%get(lEq%ls%mItr,"Max iterations",ll=1)
          lEq%FSILS%RI%mItr = lEq%ls%mItr
 
@@ -1240,6 +1304,26 @@
          lPtr => lPL%get(lEq%ls%sD,"Krylov space dimension",ll=1)
          IF (ASSOCIATED(lPtr)) lEq%FSILS%RI%sD = lEq%ls%sD
 
+         lPtr => lPL%get(lEq%FSILS%ewFlag,"Inexact Newton")
+         IF (lEq%FSILS%ewFlag) THEN
+            IF (lEq%useTLS) err = "Inexact Newton tolerances "//
+     2         "require FSILS"
+            lPtr => lPL%get(lEq%FSILS%ewMax,
+     2         "Inexact Newton max tolerance",lb=0._RKIND,ub=1._RKIND)
+            std = " Using inexact Newton linear tolerances"
+         END IF
+
+         lPtr => lPL%get(lEq%FSILS%nPrj,"Initial guess projection",
+     2      ll=0)
+         IF (lEq%FSILS%nPrj .GT. 0) THEN
+            IF (lSolverType .EQ. lSolver_NS) err = "Initial guess "//
+     2         "projection is not available for NS solver"
+            IF (lEq%useTLS .OR. lEq%ls%mFree) err = "Initial guess "//
+     2         "projection requires FSILS with an assembled LHS"
+            std = " Projecting initial guess on "//
+     2         STR(lEq%FSILS%nPrj)//" previous solutions"
+         END IF
+
          IF (lSolverType .EQ. LS_TYPE_NS) THEN
             lPtr => lPL%get(lEq%FSILS%GM%mItr,"NS-GM max iterations",
      2         ll=1)
@@ -1252,6 +1336,8 @@
      2         lb=0._RKIND,ub=1._RKIND)
             lPtr => lPL%get(lEq%FSILS%CG%relTol,"NS-CG tolerance",
      2         lb=0._RKIND,ub=1._RKIND)
+            lPtr => lPL%get(lEq%FSILS%sFrz,
+     2         "NS-CG preconditioner reuse",ll=0)
 
             lPtr =>lPL%get(lEq%FSILS%RI%absTol,"Absolute tolerance",
      2         lb=0._RKIND,ub=1._RKIND)
@@ -2213,6 +2299,11 @@ c     2         "can be applied for Neumann boundaries only"
      2      ll=1._RKIND)
          lPtr => lPR%get(rmsh%cpVar,"Frequency for copying data")
          lPtr => lPR%get(rmsh%freq,"Remesh frequency")
+         lPtr => lPR%get(rmsh%ovlp,"Overlap remeshing")
+         IF (rmsh%ovlp) THEN
+            lPtr => lPR%get(rmsh%ovlpJ,"Overlap Jacobian threshold",
+     2         lb=0._RKIND,ub=1._RKIND)
+         END IF
       END IF
 
       RETURN
@@ -2343,6 +2434,9 @@ c     2         "can be applied for Neumann boundaries only"
      3            "Use FE or RK4 instead"
             END IF
 
+         CASE ("rl", "rush-larsen", "exponential")
+            lDmn%cep%odes%tIntType = tIntType_RL
+
          CASE DEFAULT
             err = " Unknown ODE time integrator"
          END SELECT
@@ -2358,6 +2452,16 @@ c     2         "can be applied for Neumann boundaries only"
          lPtr => list%get(lDmn%cep%odes%relTol, "Relative tolerance")
       END IF
 
+      IF (lDmn%cep%odes%tIntType .EQ. tIntType_RL) THEN
+         list => lPtr
+         lPtr => list%get(lDmn%cep%odes%adapt, "Adaptive time stepping")
+         lDmn%cep%odes%dtMax = MIN(dt, 10._RKIND*lDmn%cep%dt)
+         lPtr => list%get(lDmn%cep%odes%dtMax, "Maximum time step",
+     2      ll=lDmn%cep%dt)
+         lPtr => list%get(lDmn%cep%odes%tolV, "Voltage tolerance",
+     2      lb=0._RKIND)
+      END IF
+
       lDmn%cep%Ksac = 0._RKIND
       lPtr => lPD%get(rtmp, "Feedback parameter for "//
      2   "stretch-activated-currents")
@@ -46,7 +46,7 @@
 
       CHARACTER, PARAMETER :: dSym(3) = (/"X","Y","Z"/)
 
-      LOGICAL :: flag
+      LOGICAL :: flag, lDmn
       INTEGER(KIND=IKIND) :: i, j, iM, iFa, a, b, Ac, e, lDof, lnNo
       REAL(KIND=RKIND) :: maxX(nsd), minX(nsd), fibN(nsd), rtmp
       CHARACTER(LEN=stdL) :: ctmp, fExt
@@ -70,6 +70,8 @@
             lPM => list%get(msh(iM)%name,"Add mesh",iM)
             lPtr => lPM%get(msh(iM)%lShl,"Set mesh as shell")
             lPtr => lPM%get(msh(iM)%lFib,"Set mesh as fibers")
+            lPtr => lPM%get(msh(iM)%lCNx,
+     2         "Cache shape function gradients")
 
             std  = " Reading mesh <"//CLR(TRIM(msh(iM)%name))//">"
             CALL READSV(lPM, msh(iM))
@@ -298,11 +300,14 @@ c               END IF
       DO iM=1, nMsh
          lPM => list%get(msh(iM)%name,"Add mesh",iM)
 
+!        Domains loaded from a binary mesh file replace the domain file
+         lDmn = ALLOCATED(msh(iM)%eId)
+
          lPtr => lPM%get(i,"Domain",ll=0,ul=BIT_SIZE(dmnId)-1)
          IF (ASSOCIATED(lPtr)) CALL SETDMNID(msh(iM),i)
 
          lPtr => lPM%get(fTmp,"Domain file path")
-         IF (ASSOCIATED(lPtr)) THEN
+         IF (ASSOCIATED(lPtr) .AND. .NOT.lDmn) THEN
             IF (rmsh%isReqd) err = "Variable domain properties is not"//
      2         " allowed with remeshing"
             i = LEN(TRIM(fTmp%fname))
@@ -337,7 +342,7 @@ c               END IF
          lPM => list%get(msh(iM)%name,"Add mesh",iM)
          j = lPM%srch("Fiber direction file path")
          IF (j .EQ. 0) j = lPM%srch("Fiber direction")
-         IF (j .NE. 0) THEN
+         IF (j.NE.0 .OR. ALLOCATED(msh(iM)%fN)) THEN
             flag = .TRUE.
             EXIT
          END IF
@@ -345,6 +350,8 @@ c               END IF
 
       IF (flag) THEN
          DO iM=1, nMsh
+!           Fibers already loaded from a binary mesh file
+            IF (ALLOCATED(msh(iM)%fN)) CYCLE
             lPM => list%get(msh(iM)%name,"Add mesh",iM)
 
             msh(iM)%nFn = lPM%srch("Fiber direction file path")
@@ -453,6 +460,9 @@ c               END IF
                lPtr => lPM%get(cntctM%al,
      2            "Min norm of face normals (alpha)",1,lb=0._RKIND,
      3            ub=1._RKIND)
+               cntctM%skin = 0.5_RKIND*cntctM%c
+               lPtr => lPM%get(cntctM%skin,
+     2            "Neighbor search skin distance", lb=0._RKIND)
             CASE DEFAULT
                err = "Undefined contact model"
             END SELECT
@@ -558,7 +568,9 @@ c               END IF
       END SUBROUTINE SETPROJECTOR
 !--------------------------------------------------------------------
 !     This is match isoparameteric faces to each other. Project nodes
-!     from two adjacent meshes to each other based on a L2 norm.
+!     from two adjacent meshes to each other based on a L2 norm. The
+!     nodes of pFa are stored in a k-d tree so that the closest node to
+!     each node of lFa is found exactly in O(log(n)) operations.
       SUBROUTINE MATCHFACES(lFa, pFa, lPrj, ptol)
       USE COMMOD
       USE ALLFUN
@@ -567,18 +579,14 @@ c               END IF
       TYPE(stackType), INTENT(OUT) :: lPrj
       REAL(KIND=RKIND), INTENT(IN) :: ptol
 
-      TYPE blkType
-         INTEGER(KIND=IKIND) :: n = 0
-         INTEGER(KIND=IKIND), ALLOCATABLE :: gN(:)
-      END TYPE
+!     Max number of nodes in a leaf of the k-d tree
+      INTEGER(KIND=IKIND), PARAMETER :: nLeaf = 8
 
-      LOGICAL nFlt(nsd)
-      INTEGER(KIND=IKIND) nBkd, i, a, b, Ac, Bc, iBk, nBk, iM, jM, iSh,
-     2   jSh, cnt
-      REAL(KIND=RKIND) tol, ds, minS, xMin(nsd), xMax(nsd), dx(nsd)
+      INTEGER(KIND=IKIND) i, a, Ac, Bc, iM, jM, iSh, jSh, cnt, nNo
+      REAL(KIND=RKIND) tol, minS
 
-      INTEGER(KIND=IKIND), ALLOCATABLE :: nodeBlk(:)
-      TYPE(blkType), ALLOCATABLE :: blk(:)
+      INTEGER(KIND=IKIND), ALLOCATABLE :: kdP(:), kdD(:), nbr(:)
+      REAL(KIND=RKIND), ALLOCATABLE :: xp(:,:), dS(:)
 
       iM  = lFa%iM
       jM  = pFa%iM
@@ -597,81 +605,45 @@ c               END IF
          tol = ptol
       END IF
 
-!     We want to have approximately 1000 nodes in each block. So we
-!     calculate nBkd, which is the number of separate blockes in each
-!     direction, based on that.
-      a    = pFa%nNo
-      nBkd = NINT( (REAL(a, KIND=RKIND)/
-     2   1000._RKIND)**(0.333_RKIND),  KIND=IKIND)
-      IF (nBkd .EQ. 0) nBkd = 1
-      nBk  = nBkd**nsd
-      ALLOCATE(nodeBlk(a), blk(nBk))
-
-!     Finding the extends of the domain and size of each block
-      DO i=1, nsd
-         xMin(i) = MIN(MINVAL(x(i,iSh+lFa%gN)), MINVAL(x(i,jSh+pFa%gN)))
-         xMax(i) = MAX(MAXVAL(x(i,iSh+lFa%gN)), MAXVAL(x(i,jSh+pFa%gN)))
-         IF (xMin(i) .LT. 0._RKIND) THEN
-            xMin(i) = xMin(i)*(1._RKIND+eps)
-         ELSE
-            xMin(i) = xMin(i)*(1._RKIND-eps)
-         END IF
-         IF (xMax(i) .LT. 0._RKIND) THEN
-            xMax(i) = xMax(i)*(1._RKIND-eps)
-         ELSE
-            xMax(i) = xMax(i)*(1._RKIND+eps)
-         END IF
-      END DO
-      dx = (xMax - xMin)/REAL(nBkd, KIND=RKIND)
-      nFlt = .TRUE.
-      DO i=1, nsd
-         IF (ISZERO(dx(i))) nFlt(i) = .FALSE.
+!     Building the k-d tree of the nodes on pFa. The tree is implicit:
+!     kdP is a permutation of the nodes such that the node in the middle
+!     of every range splits that range along the direction kdD
+      nNo = pFa%nNo
+      ALLOCATE(xp(nsd,nNo), kdP(nNo), kdD(nNo))
+      DO a=1, nNo
+         xp(:,a) = x(:,pFa%gN(a)+jSh)
+         kdP(a)  = a
       END DO
+      kdD = 0
+      CALL KDBUILD(1, nNo)
 
-!     First finding an estimation for size of each block
-      blk%n = 0
-      DO a=1, pFa%nNo
-         Ac  = pFa%gN(a) + jSh
-         iBk = FINDBLK(x(:,Ac))
-         nodeBlk(a) = iBk
-         blk(iBk)%n = blk(iBk)%n + 1
-      END DO
-      DO iBk=1, nBk
-         ALLOCATE(blk(iBk)%gN(blk(iBk)%n))
-      END DO
-      blk%n = 0
-      DO a=1, pFa%nNo
-         Ac  = pFa%gN(a)
-         iBk = nodeBlk(a)
-         blk(iBk)%n = blk(iBk)%n + 1
-         blk(iBk)%gN(blk(iBk)%n) = Ac
+!     Finding the closest node on pFa to every single node on this face
+      ALLOCATE(nbr(lFa%nNo), dS(lFa%nNo))
+!$OMP PARALLEL DO PRIVATE(a, Ac, Bc, minS)
+      DO a=1, lFa%nNo
+         Ac   = lFa%gN(a)
+         Bc   = 0
+         minS = HUGE(minS)
+         CALL KDNEAR(1, nNo, x(:,Ac+iSh), Ac, Bc, minS)
+         nbr(a) = Bc
+         dS(a)  = SQRT(minS)
       END DO
+!$OMP END PARALLEL DO
 
-!     Doing the calculation for every single node on this face
-      cnt  = 0
+      cnt = 0
       DO a=1, lFa%nNo
-         Ac  = lFa%gN(a)
-         iBk = FINDBLK(x(:,Ac+iSh))
-!     Checking every single node on the other face
-         minS = HUGE(minS)
-         DO b=1, blk(iBk)%n
-            Bc = blk(iBk)%gN(b)
-            IF (iM.EQ.jM .AND. Ac.EQ.Bc) CYCLE
-            ds = SQRT(SUM( (x(:,Bc+jSh) - x(:,Ac+iSh))**2._RKIND ))
-            IF (ds .LT. minS) THEN
-               minS = ds
-               i = Bc
-            END IF
-         END DO
-         Bc = i
+         IF (nbr(a) .EQ. 0) CYCLE
+         Ac = lFa%gN(a)
+         Bc = pFa%gN(nbr(a))
          IF (tol < 0._RKIND) THEN
             CALL PUSHSTACK(lPrj, (/Ac,Bc/))
             cnt = cnt + 1
-         ELSE IF (minS .LT. tol) THEN
+         ELSE IF (dS(a) .LT. tol) THEN
             CALL PUSHSTACK(lPrj, (/Ac,Bc/))
             cnt = cnt + 1
          END IF
       END DO
+      DEALLOCATE(xp, kdP, kdD, nbr, dS)
 
       IF (cnt .NE. lFa%nNo) err = " Failed to project faces between <"//
      2   TRIM(lFa%name)//"> and <"//TRIM(pFa%name)//">"
@@ -686,29 +658,115 @@ c               END IF
       RETURN
       CONTAINS
 !--------------------------------------------------------------------
-      INTEGER(KIND=IKIND) FUNCTION FINDBLK(x)
+!     Splits the range kdP(lo:hi) at its median along the direction of
+!     its largest extent and recursively builds both halves
+      RECURSIVE SUBROUTINE KDBUILD(lo, hi)
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: lo, hi
+
+      INTEGER(KIND=IKIND) i, j, l, r, m, d, t
+      REAL(KIND=RKIND) xMin(nsd), xMax(nsd), pv
+
+      IF (hi-lo+1 .LE. nLeaf) RETURN
+
+      xMin = HUGE(pv)
+      xMax = -HUGE(pv)
+      DO i=lo, hi
+         xMin(:) = MIN(xMin(:), xp(:,kdP(i)))
+         xMax(:) = MAX(xMax(:), xp(:,kdP(i)))
+      END DO
+      d = MAXLOC(xMax(:) - xMin(:), 1)
+      m = (lo + hi)/2
+
+!     Quickselect so that kdP(m) is the median along d
+      l = lo
+      r = hi
+      DO WHILE (l .LT. r)
+         pv = xp(d,kdP((l+r)/2))
+         i  = l
+         j  = r
+         DO WHILE (i .LE. j)
+            DO WHILE (xp(d,kdP(i)) .LT. pv)
+               i = i + 1
+            END DO
+            DO WHILE (xp(d,kdP(j)) .GT. pv)
+               j = j - 1
+            END DO
+            IF (i .LE. j) THEN
+               t      = kdP(i)
+               kdP(i) = kdP(j)
+               kdP(j) = t
+               i = i + 1
+               j = j - 1
+            END IF
+         END DO
+         IF (m .LE. j) THEN
+            r = j
+         ELSE IF (m .GE. i) THEN
+            l = i
+         ELSE
+            EXIT
+         END IF
+      END DO
+      kdD(m) = d
+
+      CALL KDBUILD(lo, m-1)
+      CALL KDBUILD(m+1, hi)
+
+      RETURN
+      END SUBROUTINE KDBUILD
+!--------------------------------------------------------------------
+!     Searches kdP(lo:hi) for the closest node to xq, excluding Ac when
+!     both faces belong to the same mesh. minS is the squared distance
+      RECURSIVE SUBROUTINE KDNEAR(lo, hi, xq, Ac, Bc, minS)
       IMPLICIT NONE
-      REAL(KIND=RKIND), INTENT(IN) :: x(nsd)
-
-      INTEGER(KIND=IKIND) i, j, k
-
-      i = 1
-      j = 1
-      k = 1
-      IF (nFlt(1)) i = INT((x(1) - xMin(1))/dx(1), KIND=IKIND)
-      IF (nFlt(2)) j = INT((x(2) - xMin(2))/dx(2), KIND=IKIND)
-      IF (i .EQ. nBkd) i = nBkd - 1
-      IF (j .EQ. nBkd) j = nBkd - 1
-      IF (nsd .EQ. 3) THEN
-         IF (nFlt(3)) k = INT((x(3) - xMin(3))/dx(3), KIND=IKIND)
-         IF (k .EQ. nBkd) k = nBkd - 1
-         FINDBLK = k + (j + i*nBkd)*nBkd + 1
-      ELSE ! nsd .EQ. 2
-         FINDBLK = j + i*nBkd + 1
+      INTEGER(KIND=IKIND), INTENT(IN) :: lo, hi, Ac
+      REAL(KIND=RKIND), INTENT(IN) :: xq(nsd)
+      INTEGER(KIND=IKIND), INTENT(INOUT) :: Bc
+      REAL(KIND=RKIND), INTENT(INOUT) :: minS
+
+      INTEGER(KIND=IKIND) i, b, m, d
+      REAL(KIND=RKIND) ds
+
+      IF (hi .LT. lo) RETURN
+
+      IF (hi-lo+1 .LE. nLeaf) THEN
+         DO i=lo, hi
+            b = kdP(i)
+            IF (iM.EQ.jM .AND. Ac.EQ.pFa%gN(b)) CYCLE
+            ds = SUM((xp(:,b) - xq(:))**2)
+            IF (ds .LT. minS) THEN
+               minS = ds
+               Bc   = b
+            END IF
+         END DO
+         RETURN
+      END IF
+
+      m = (lo + hi)/2
+      b = kdP(m)
+      d = kdD(m)
+      IF (.NOT.(iM.EQ.jM .AND. Ac.EQ.pFa%gN(b))) THEN
+         ds = SUM((xp(:,b) - xq(:))**2)
+         IF (ds .LT. minS) THEN
+            minS = ds
+            Bc   = b
+         END IF
+      END IF
+
+!     Visiting the side containing xq first, and the other side only
+!     if it could contain a closer node
+      ds = xq(d) - xp(d,b)
+      IF (ds .LT. 0._RKIND) THEN
+         CALL KDNEAR(lo, m-1, xq, Ac, Bc, minS)
+         IF (ds*ds .LT. minS) CALL KDNEAR(m+1, hi, xq, Ac, Bc, minS)
+      ELSE
+         CALL KDNEAR(m+1, hi, xq, Ac, Bc, minS)
+         IF (ds*ds .LT. minS) CALL KDNEAR(lo, m-1, xq, Ac, Bc, minS)
       END IF
 
       RETURN
-      END FUNCTION FINDBLK
+      END SUBROUTINE KDNEAR
 !--------------------------------------------------------------------
       END SUBROUTINE MATCHFACES
 !####################################################################
@@ -1180,7 +1238,7 @@ c               END IF
       std = "----------------------------------------------------------"
       DO iM=1, nMesh
          std = " Mesh properties: <"//CLR(TRIM(mesh(iM)%name))//">"
-         CALL CALCELEMJAC(mesh(iM), rmsh%flag(iM))
+         CALL CALCELEMJAC(mesh(iM), rmsh%flag(iM), rmsh%minJ(iM))
          CALL CALCELEMSKEW(mesh(iM), rmsh%flag(iM))
          CALL CALCELEMAR(mesh(iM), rmsh%flag(iM))
       END DO
@@ -1221,15 +1279,16 @@ c               END IF
       END SUBROUTINE CALCMESHPROPS
 !####################################################################
 !     Calculate element Jacobian of a given mesh
-      SUBROUTINE CALCELEMJAC(lM, rflag)
+      SUBROUTINE CALCELEMJAC(lM, rflag, minJ)
       USE COMMOD
       USE ALLFUN
       IMPLICIT NONE
       TYPE(mshType), INTENT(INOUT) :: lM
       LOGICAL, INTENT(INOUT) :: rflag
+      REAL(KIND=RKIND), INTENT(OUT) :: minJ
 
       INTEGER(KIND=IKIND) :: e, a, Ac, cnt, iDmn, cPhys
-      REAL(KIND=RKIND) :: minJ, maxJ, tmp
+      REAL(KIND=RKIND) :: maxJ, tmp
 
       REAL(KIND=RKIND), ALLOCATABLE :: Jac(:), xl(:,:), dol(:,:)
 
@@ -105,11 +105,9 @@
                err = "Unexpected behavior in Remesher"
             END IF
 
-            ALLOCATE(tempX(nsd,msh(iM)%nNo))
             ALLOCATE(gD(lDof,msh(iM)%nNo))
             DO a=1, msh(iM)%nNo
                Ac = msh(iM)%gN(a)
-               tempX(:,a) = x(:,Ac) + rmsh%D0(nsd+2:2*nsd+1,Ac)
                gD(1:tDof,a) = rmsh%A0(:,Ac)
                gD(tDof+1:2*tDof,a) = rmsh%Y0(:,Ac)
                gD(2*tDof+1:3*tDof,a) = rmsh%D0(:,Ac)
@@ -126,30 +124,10 @@
                tMsh%gnEl = 0
                tMsh%eNoN = 0
             END IF
-            ALLOCATE(gX(nsd,tMsh%gnNo))
-            gX = GLOBAL(msh(iM), tempX)
-            DEALLOCATE(tempX)
-
-            IF (cm%mas()) THEN
-               ALLOCATE(tMsh%gIEN(tMsh%eNoN,tMsh%gnEl))
-               tMsh%gIEN = msh(iM)%gIEN
-               DO e=1, tMsh%gnEl
-                  Ec = msh(iM)%otnIEN(e)
-                  DO a=1, tMsh%eNoN
-                     msh(iM)%gIEN(a,e) = tMsh%gIEN(a,Ec)
-                  END DO
-               END DO
-            END IF
 
-            CALL INTMSHSRF(msh(iM), tMsh%fa(1))
+            CALL DEFMSHSRF(iM, tMsh%fa(1))
 
             IF (cm%mas()) THEN
-               ALLOCATE(tMsh%fa(1)%x(nsd,tMsh%fa(1)%nNo))
-               DO a=1, tMsh%fa(1)%nNo
-                  Ac = tMsh%fa(1)%gN(a)
-                  tMsh%fa(1)%x(:,a) = gX(:,Ac)
-               END DO
-
                IF (nsd .EQ. 2) THEN
                   err = "Remesher not yet developed for 2D objects"
                ELSE
@@ -158,7 +136,7 @@
 
                ALLOCATE(gnD(lDof,tMsh%gnNo))
             ELSE
-               ALLOCATE(tMsh%fa(1)%x(0,0), gnD(0,0))
+               ALLOCATE(gnD(0,0))
             END IF
 
             CALL cm%bcast(tMsh%gnNo)
@@ -230,7 +208,7 @@
             CALL MPI_BARRIER(cm%com(), ierr)
 
             CALL DESTROY(tMsh)
-            DEALLOCATE(gX, gD, gnD)
+            DEALLOCATE(gD, gnD)
          ELSE
             ALLOCATE(tempX(nsd,msh(iM)%nNo))
             ALLOCATE(tempD(lDof,msh(iM)%nNo))
@@ -306,6 +284,7 @@
             CALL DESTROY(tMsh)
          END IF ! reMesh flag
       END DO
+      IF (rmsh%ovlp) CALL REMESHDROP()
       CALL cm%bcast(gtnNo)
       DEALLOCATE(x, rmsh%A0, rmsh%Y0, rmsh%D0)
 
@@ -367,6 +346,7 @@
          END DO
          DEALLOCATE(eq)
       END IF
+      IF (ALLOCATED(prb)) DEALLOCATE(prb)
 
       IF (ALLOCATED(colPtr))   DEALLOCATE(colPtr)
       IF (ALLOCATED(dmnID))    DEALLOCATE(dmnID)
@@ -381,6 +361,8 @@
       IF (ALLOCATED(Dn))       DEALLOCATE(Dn)
       IF (ALLOCATED(R))        DEALLOCATE(R)
       IF (ALLOCATED(Val))      DEALLOCATE(Val)
+      IF (ALLOCATED(mfD))      DEALLOCATE(mfD, mfU, mfKU)
+      IF (ALLOCATED(mfAg))     DEALLOCATE(mfAg, mfYg, mfDg)
       IF (ALLOCATED(Yo))       DEALLOCATE(Yo)
       IF (ALLOCATED(Yn))       DEALLOCATE(Yn)
       IF (ALLOCATED(Bf))       DEALLOCATE(Bf)
@@ -462,6 +444,65 @@
       IF (cm%slv()) ALLOCATE(lFa%gN(lFa%nNo))
 
       END SUBROUTINE INTMSHSRF
+!--------------------------------------------------------------------
+!     Extracts the surface of mesh iM, displaced by the solution copied
+!     to rmsh%D0, into lFa with its coordinates on the master. This is
+!     the surface TetGen remeshes from.
+      SUBROUTINE DEFMSHSRF(iM, lFa)
+      USE COMMOD
+      USE UTILMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), INTENT(IN) :: iM
+      TYPE(faceType), INTENT(INOUT) :: lFa
+
+      INTEGER(KIND=IKIND) :: a, e, Ac, Ec
+
+      INTEGER(KIND=IKIND), ALLOCATABLE :: tIEN(:,:)
+      REAL(KIND=RKIND), ALLOCATABLE :: tempX(:,:), gX(:,:)
+
+      ALLOCATE(tempX(nsd,msh(iM)%nNo))
+      DO a=1, msh(iM)%nNo
+         Ac = msh(iM)%gN(a)
+         tempX(:,a) = x(:,Ac) + rmsh%D0(nsd+2:2*nsd+1,Ac)
+      END DO
+      IF (cm%mas()) THEN
+         a = msh(iM)%gnNo
+      ELSE
+         a = 0
+      END IF
+      ALLOCATE(gX(nsd,a))
+      gX = GLOBAL(msh(iM), tempX)
+      DEALLOCATE(tempX)
+
+!     INTMSHSRF checks the faces against gIEN in the original ordering
+      IF (cm%mas()) THEN
+         ALLOCATE(tIEN(msh(iM)%eNoN,msh(iM)%gnEl))
+         tIEN = msh(iM)%gIEN
+         DO e=1, msh(iM)%gnEl
+            Ec = msh(iM)%otnIEN(e)
+            msh(iM)%gIEN(:,e) = tIEN(:,Ec)
+         END DO
+      END IF
+
+      CALL INTMSHSRF(msh(iM), lFa)
+
+      IF (cm%mas()) THEN
+         msh(iM)%gIEN = tIEN
+         DEALLOCATE(tIEN)
+
+         ALLOCATE(lFa%x(nsd,lFa%nNo))
+         DO a=1, lFa%nNo
+            Ac = lFa%gN(a)
+            lFa%x(:,a) = gX(:,Ac)
+         END DO
+      ELSE
+         ALLOCATE(lFa%x(0,0))
+      END IF
+      DEALLOCATE(gX)
+
+      RETURN
+      END SUBROUTINE DEFMSHSRF
 !--------------------------------------------------------------------
       SUBROUTINE REMESHER_3D(iM, lFa, lM)
       USE COMMOD
@@ -481,8 +522,16 @@
       rparams(3) = rmsh%maxEdgeSize(iM)
       iOK = 0
       IF (rmsh%method .EQ. RMSH_TETGEN) THEN
-         CALL remesh3d_tetgen(lFa%nNo, lFa%nEl, lFa%x, lFa%IEN,
-     2      rparams, iOK)
+!     Use the mesh from REMESHAHEAD if it was started from this state
+         IF (rmsh%ovlp) CALL remesh3d_tetgen_wait(iM, rmsh%rTS, iOK)
+         IF (iOK .EQ. 1) THEN
+            std = "    Using mesh generated ahead at time "//
+     2         STR(rmsh%rTS)
+            iOK = 0
+         ELSE
+            CALL remesh3d_tetgen(lFa%nNo, lFa%nEl, lFa%x, lFa%IEN,
+     2         rparams, iOK)
+         END IF
          IF (iOK .LT. 0)
      2      err = "Fatal! TetGen returned with error. Check log"
       ELSE
@@ -532,6 +581,75 @@
 
       RETURN
       END SUBROUTINE REMESHER_3D
+!--------------------------------------------------------------------
+!     Starts TetGen on a separate thread of the master for the meshes
+!     that are likely to be remeshed from the data just copied to
+!     rmsh%D0, so that the solver keeps marching while the new mesh is
+!     being generated. Both take the surface from DEFMSHSRF, so the new
+!     mesh is the one REMESHRESTART would generate.
+      SUBROUTINE REMESHAHEAD()
+      USE COMMOD
+      USE UTILMOD
+      USE ALLFUN
+      IMPLICIT NONE
+
+      LOGICAL :: flag
+      INTEGER(KIND=IKIND) :: iM, a, e, cPhys
+      REAL(KIND=RKIND) :: rparams(3)
+      TYPE(faceType) :: lFa
+
+      IF (rmsh%method.NE.RMSH_TETGEN .OR. nsd.NE.3) RETURN
+
+      DO iM=1, nMsh
+!     Remeshing is forced before the next copy, or the mesh is about to
+!     get distorted
+         flag = .FALSE.
+         IF (rmsh%fTS .LE. cTS+rmsh%cpVar) THEN
+            DO e=1, msh(iM)%nEl
+               cDmn = DOMAIN(msh(iM), 1, e)
+               cPhys = eq(1)%dmn(cDmn)%phys
+               IF (cPhys .EQ. phys_fluid) THEN
+                  flag = .TRUE.
+                  EXIT
+               END IF
+            END DO
+            a = 0
+            IF (flag) a = 1
+            a = cm%reduce(a, MPI_MAX)
+            flag = a .EQ. 1
+         END IF
+         IF (rmsh%minJ(iM) .LT. rmsh%ovlpJ) flag = .TRUE.
+         IF (.NOT.flag) CYCLE
+
+         CALL DEFMSHSRF(iM, lFa)
+
+         IF (cm%mas() .AND. lFa%nNo.GT.0) THEN
+            std = " Remeshing <"//CLR(TRIM(msh(iM)%name))//
+     2         "> ahead from time "//STR(rmsh%rTS)
+            rparams(1) = rmsh%maxRadRatio
+            rparams(2) = rmsh%minDihedAng
+            rparams(3) = rmsh%maxEdgeSize(iM)
+            CALL remesh3d_tetgen_start(iM, rmsh%rTS, lFa%nNo, lFa%nEl,
+     2         lFa%x, lFa%IEN, rparams)
+         END IF
+         CALL DESTROY(lFa)
+      END DO
+
+      RETURN
+      END SUBROUTINE REMESHAHEAD
+!--------------------------------------------------------------------
+!     Discards the meshes started by REMESHAHEAD. Jobs TetGen has not
+!     started on are skipped, while a running one is waited for, so no
+!     remeshing thread outlives this call; their output is deleted
+      SUBROUTINE REMESHDROP()
+      USE COMMOD
+      IMPLICIT NONE
+
+      IF (cm%slv()) RETURN
+      CALL remesh3d_tetgen_drain()
+
+      RETURN
+      END SUBROUTINE REMESHDROP
 !--------------------------------------------------------------------
       SUBROUTINE SETFACEEBC(lFa, lM)
       USE COMMOD
@@ -727,134 +845,122 @@ c     Check mesh quality and reset IEN if necessary
       RETURN
       END SUBROUTINE DISTMSHSRF
 !--------------------------------------------------------------------
-!     Interpolation of data variables from source mesh to target mesh
+!     Interpolation of data variables from source mesh to target mesh.
+!     The elements of the source mesh are stored in a bounding volume
+!     hierarchy, so that the host element of every target node is found
+!     in O(log(n)) operations, independently of the other nodes.
       SUBROUTINE INTERP(lDof, iM, tMsh, sD, tgD)
       USE COMMOD
       USE UTILMOD
       USE ALLFUN
+      USE MATFUN
       IMPLICIT NONE
       TYPE(mshType), INTENT(INOUT) :: tMsh
       INTEGER(KIND=IKIND), INTENT(IN) :: lDof, iM
       REAL(KIND=RKIND), DIMENSION(:,:), INTENT(IN)  :: sD
       REAL(KIND=RKIND), DIMENSION(:,:), INTENT(OUT) :: tgD(:,:)
 
-      LOGICAL :: flag
-      INTEGER(KIND=IKIND) :: a, e, b, i, iFa, ierr, Ac, Bc, Ec, nn, ne,
-     2   try, nbnd, nNo, nEl, eNon, gnNo, gnEl, maxKNE, maxKNN, probe,
-     3   bTag
-      REAL(KIND=RKIND) :: dS
-      TYPE(queueType) :: rootNdQ
-
-      LOGICAL, ALLOCATABLE :: chckNp(:)
-      INTEGER(KIND=IKIND), ALLOCATABLE :: gN(:), gE(:), tagNd(:),
-     2   masEList(:), srcAdjEl(:,:), tgtAdjNd(:,:), eList(:), rootEl(:),
-     3   srfNds(:), sCount(:), disp(:), tmpL(:)
-      REAL(KIND=RKIND), ALLOCATABLE :: Xp(:), Nsf(:), gNsf(:,:),
-     2   Dg(:,:), tmpX(:,:), vec(:), gvec(:)
-
-      INTERFACE
-         SUBROUTINE DISTRN(iM, lM, Dg, nNo, gN)
-         USE COMMOD
-         USE UTILMOD
-         USE ALLFUN
-         IMPLICIT NONE
-         TYPE(mshType), INTENT(INOUT) :: lM
-         INTEGER(KIND=IKIND), INTENT(IN) :: iM
-         INTEGER(KIND=IKIND), INTENT(OUT) :: nNo
-         INTEGER(KIND=IKIND), ALLOCATABLE :: gN(:)
-         REAL(KIND=RKIND), INTENT(IN) :: Dg(nsd,tnNo)
-         END SUBROUTINE DISTRN
-      END INTERFACE
+!     Max number of elements in a leaf of the hierarchy
+      INTEGER(KIND=IKIND), PARAMETER :: nLeaf = 8
 
-      INTERFACE
-         SUBROUTINE DISTRE(lM, nEl, gE)
-         USE COMMOD
-         USE UTILMOD
-         USE ALLFUN
-         IMPLICIT NONE
-         TYPE(mshType), INTENT(INOUT) :: lM
-         INTEGER(KIND=IKIND), INTENT(OUT) :: nEl
-         INTEGER(KIND=IKIND), ALLOCATABLE :: gE(:)
-         END SUBROUTINE DISTRE
-      END INTERFACE
+      INTEGER(KIND=IKIND) :: a, e, b, i, ierr, Ac, Bc, Ec, nn, nNo,
+     2   eNoN, gnNo, nE, pass, bTag
+      REAL(KIND=RKIND) :: tol, f, h
 
-      INTERFACE
-         SUBROUTINE GETADJESRC(lM, kneList)
-         USE COMMOD
-         USE UTILMOD
-         USE ALLFUN
-         IMPLICIT NONE
-         TYPE(mshType), INTENT(IN) :: lM
-         INTEGER(KIND=IKIND), ALLOCATABLE :: kneList(:,:)
-         END SUBROUTINE GETADJESRC
-      END INTERFACE
-
-      INTERFACE
-         SUBROUTINE GETADJNTGT(lM, nNo, nEl, gN, gE, knnList)
-         USE COMMOD
-         USE UTILMOD
-         USE ALLFUN
-         IMPLICIT NONE
-         TYPE(mshType), INTENT(IN) :: lM
-         INTEGER(KIND=IKIND), INTENT(IN) :: nNo, nEl, gN(nNo), gE(nEl)
-         INTEGER(KIND=IKIND), ALLOCATABLE :: knnList(:,:)
-         END SUBROUTINE GETADJNTGT
-      END INTERFACE
-
-      INTERFACE
-         SUBROUTINE FINDN(xp, iM, Dg, eList, Ec, Nsf)
-         USE COMMOD
-         USE UTILMOD
-         USE ALLFUN
-         IMPLICIT NONE
-         INTEGER(KIND=IKIND), INTENT(IN) :: iM, eList(:)
-         INTEGER(KIND=IKIND), INTENT(OUT) :: Ec
-         REAL(KIND=RKIND), INTENT(IN) :: xp(nsd+1), Dg(nsd,tnNo)
-         REAL(KIND=RKIND), INTENT(OUT) :: Nsf(msh(iM)%eNoN)
-         END SUBROUTINE FINDN
-      END INTERFACE
+      INTEGER(KIND=IKIND), ALLOCATABLE :: gN(:), gE(:), tagNd(:),
+     2   srfNds(:), sCount(:), disp(:), tmpL(:), part(:), bvP(:)
+      REAL(KIND=RKIND), ALLOCATABLE :: Xp(:), gNsf(:,:), xs(:,:),
+     2   tmpX(:,:), vec(:), gvec(:), eMin(:,:), eMax(:,:), bMin(:,:),
+     3   bMax(:,:), xc(:,:), eInv(:,:,:), Amat(:,:)
 
       std = " Interpolating.."
-      IF (cm%seq()) wrn = "Interpolation not optimized for serial job"
 
       IF (nsd+1 .NE. msh(iM)%eNoN) err = "Inconsistent element type "//
      2   "for interpolation. Can support 2D Tri or 3D Tet elements only"
 
       gnNo = tMsh%gnNo
       eNoN = tMsh%eNoN
-      gnEl = tMsh%gnEl
+      nE   = msh(iM)%nEl
 
-!     Distribute the new mesh nodes among all the processors
-!     Need to transfer mesh displacement
-      ALLOCATE(Dg(nsd,tnNo))
+!     Source mesh in the configuration where remeshing starts
+      ALLOCATE(xs(nsd,tnNo))
       i = nsd+1
-      Dg(:,:) = rmsh%D0(i+1:i+nsd,:)
-      CALL DISTRN(iM, tMsh, Dg, nNo, gN)
-
-!     Distribute elements of the new mesh to all processors
-      CALL DISTRE(tMsh, nEl, gE)
+      xs(:,:) = x(:,:) + rmsh%D0(i+1:i+nsd,:)
+
+!     Setup the bounding volume hierarchy of the source mesh elements.
+!     Element boxes are padded to capture the points that are found
+!     within the tolerance of the barycentric coordinates below. The
+!     inverse Jacobian of every element is stored for the location
+!     test.
+      ALLOCATE(eMin(nsd,nE), eMax(nsd,nE), bMin(nsd,nE), bMax(nsd,nE),
+     2   xc(nsd,nE), bvP(nE), eInv(nsd,nsd,nE), Amat(nsd,eNoN))
+      DO e=1, nE
+         DO a=1, eNoN
+            Ac = msh(iM)%IEN(a,e)
+            Amat(:,a) = xs(:,Ac)
+         END DO
+         DO i=1, nsd
+            eMin(i,e) = MINVAL(Amat(i,:))
+            eMax(i,e) = MAXVAL(Amat(i,:))
+            Amat(i,2:eNoN) = Amat(i,2:eNoN) - Amat(i,1)
+         END DO
+         h = 1.E-12_RKIND*MAXVAL(eMax(:,e) - eMin(:,e))
+         eMin(:,e) = eMin(:,e) - h
+         eMax(:,e) = eMax(:,e) + h
+         xc(:,e)   = 0.5_RKIND*(eMin(:,e) + eMax(:,e))
+         eInv(:,:,e) = MAT_INV(Amat(:,2:eNoN), nsd)
+         bvP(e) = e
+      END DO
+      DEALLOCATE(Amat)
+      IF (nE .GT. 0) CALL BVBUILD(1, nE)
+      DEALLOCATE(xc)
+
+!     Distribute the new mesh nodes among all the processors. A node
+!     is assigned to every processor having an old node within the
+!     tolerance, which is relaxed until all the nodes are assigned.
+      ALLOCATE(part(gnNo), tmpL(gnNo))
+      f    = 2.5E-2_RKIND
+      pass = 0
+      part = 0
+      DO
+         f    = 2._RKIND*f
+         tol  = (1._RKIND+f) * rmsh%maxEdgeSize(iM)
+         pass = pass + 1
+!$OMP PARALLEL DO PRIVATE(a, Bc) SCHEDULE(DYNAMIC, 64)
+         DO a=1, gnNo
+            IF (part(a) .NE. 0) CYCLE
+            Bc = 0
+            IF (nE .GT. 0) CALL BVNEAR(1, nE, tMsh%x(:,a), tol, Bc)
+            IF (Bc .GT. 0) part(a) = cm%tF()
+         END DO
+!$OMP END PARALLEL DO
 
-!     Setup data structures for octree search
-!     Get adjacent cells for source (old) mesh
-      CALL GETADJESRC(msh(iM), srcAdjEl)
-      maxKNE = SIZE(srcAdjEl,1)
+         CALL MPI_ALLREDUCE(part, tmpL, gnNo, mpint, MPI_MAX, cm%com(),
+     2      ierr)
 
-!     Get adjacent nodes for each node on the new mesh
-      CALL GETADJNTGT(tMsh, nNo, nEl, gN, gE, tgtAdjNd)
-      maxKNN = SIZE(tgtAdjNd,1)
-      DEALLOCATE(gE)
+         b = COUNT(tmpL .GT. 0)
+         IF (b .EQ. gnNo) EXIT
+         wrn = "Found only "//STR(b)//" nodes in pass "//STR(pass)//
+     2      " out of "//STR(gnNo)//" nodes"
+         IF (pass .GT. 5) err = "Could not distribute all nodes in "//
+     2      STR(pass)//" passes. Try changing tolerance."
+      END DO
 
-      ALLOCATE(Xp(nsd+1), Nsf(eNoN), gNsf(eNoN,nNo), tagNd(gnNo),
-     2 gE(nNo), rootEl(nNo), chckNp(nNo), masEList(msh(iM)%nEl))
+      nNo = COUNT(part .EQ. cm%tF())
+      ALLOCATE(gN(nNo))
+      nNo = 0
+      DO a=1, gnNo
+         IF (part(a) .EQ. cm%tF()) THEN
+            nNo = nNo + 1
+            gN(nNo) = a
+         END IF
+      END DO
+      DEALLOCATE(part, tmpL)
 
+      ALLOCATE(Xp(eNoN), gNsf(eNoN,nNo), tagNd(gnNo), gE(nNo))
       gNsf   = 0._RKIND
       gE     = 0
       tagNd  = 0
-      rootEl = 0
-      chckNp = .FALSE.
-      DO e=1, msh(iM)%nEl
-         masEList(e) = e
-      END DO
 
 !     Determine boundary nodes on the new mesh, where interpolation is
 !     not needed, or boundary search is performed
@@ -878,153 +984,39 @@ c     Check mesh quality and reset IEN if necessary
       bTag = 2*cm%np()
       DO a=1, nNo
          Ac = gN(a)
-         IF (srfNds(a) .GT. 0) THEN
-            chckNp(a) = .TRUE.
-            tagNd(Ac) = bTag
-            gE(a)     = 0
-            gNsf(:,a) = 0._RKIND
-         END IF
+         IF (srfNds(a) .GT. 0) tagNd(Ac) = bTag
       END DO
 
-!     Find a starting element through brute search and the starting node
-!     is used to initialize the queue (local numbering)
+!     Node-Cell search: the host element of every interior node of the
+!     target mesh is located in the hierarchy
+!$OMP PARALLEL DO PRIVATE(a, Ac, Ec, Xp) SCHEDULE(DYNAMIC, 64)
       DO a=1, nNo
-         IF (chckNp(a)) CYCLE
+         IF (srfNds(a) .GT. 0) CYCLE
          Ac = gN(a)
          Xp = 1._RKIND
          Xp(1:nsd) = tMsh%x(:,Ac)
-         CALL FINDN(Xp, iM, Dg, masEList, Ec, Nsf)
-         chckNp(a) = .TRUE.
-!     Once an element in the source mesh is found, set 'this' element as
-!     'root' element for all the neighbor nodes of the target mesh. Then
-!     add these neighbor nodes to the queue to form the 'front'
+         Ec = 0
+         IF (nE .GT. 0) CALL BVFIND(1, nE, Xp, Ec, gNsf(:,a))
          IF (Ec .GT. 0) THEN
             gE(a) = Ec
             tagNd(Ac) = cm%tF()
-            gNsf(:,a) = Nsf(:)
-            DO nn=1, maxKNN
-               b = tgtAdjNd(nn,a)
-               IF (b .GT. 0) THEN
-                  CALL ENQUEUE(rootNdQ, b)
-                  rootEl(b) = Ec
-               END IF
-            END DO
-            IF (rootNdQ%n .GT. 1) EXIT
+         ELSE
+            gNsf(:,a) = 0._RKIND
          END IF
       END DO
-
-!     Node-Cell search begins here. Uses fastest grid-to-grid algorithm
-!     based on advancing front in the nearest vicinity
-      ALLOCATE(eList(maxKNE)); eList = 0
-      DO WHILE (DEQUEUE(rootNdQ, probe))
-         IF (ALL(chckNp(:))) EXIT
-         IF (chckNp(probe)) CYCLE
-         Ac = gN(probe)
-         Xp = 1._RKIND
-         Xp(1:nsd) = tMsh%x(:,Ac)
-         eList = 0
-         DO e=1, maxKNE
-            Ec = srcAdjEl(e,rootEl(probe))
-            IF (Ec .GT. 0) eList(e) = Ec
-         END DO
-
-         DO try=1, 2
-            CALL FINDN(Xp, iM, Dg, eList, Ec, Nsf)
-!      IF an element is found, the neighbors of the node are initialized
-!      with this element as root element and are added to the queue
-!      (front propagation)
-            IF (Ec .GT. 0) THEN
-              gE(probe) = Ec
-               tagNd(Ac) = cm%tF()
-               gNsf(:,probe) = Nsf(:)
-               DO nn=1, maxKNN
-                  a = tgtAdjNd(nn,probe)
-                  IF (a .GT. 0) THEN
-                     CALL ENQUEUE(rootNdQ, a)
-                     rootEl(a) = Ec
-                  END IF
-               END DO
-               DEALLOCATE(eList)
-               ALLOCATE(eList(maxKNE)); eList = 0
-               EXIT
-            END IF
-!      If failed in first attempt, try again with increased search area
-!      but add neighbors uniquely without repetition
-            IF (try .EQ. 1) THEN
-               ALLOCATE(tmpL(nEl))
-               tmpL = 0
-               ne = 0
-               DO e=1, maxKNE
-                  Ec = eList(e)
-                  IF (Ec .GT. 0) THEN
-                     DO a=1, maxKNE
-                        Bc = srcAdjEl(a,Ec)
-                        IF (Bc.NE.0 .AND. Bc.NE.Ec) THEN
-                           flag = .TRUE.
-                           DO i=1, ne
-                              IF (Bc .EQ. tmpL(i)) THEN
-                                 flag = .FALSE.
-                                 EXIT
-                              END IF
-                           END DO
-                           IF (flag) THEN
-                              ne = ne + 1
-                              tmpL(ne) = Bc
-                           END IF
-                        END IF
-                     END DO
-                  END IF
-               END DO
-               DEALLOCATE(eList)
-               ALLOCATE(eList(ne))
-               eList = tmpL(1:ne)
-               DEALLOCATE(tmpL)
-            ELSE IF (try .EQ. 2) THEN
-               DEALLOCATE(eList)
-               ALLOCATE(eList(maxKNE)); eList = 0
-            END IF
-         END DO ! try
-         chckNp(probe) = .TRUE.
-      END DO
-      CALL DESTROY(rootNdQ)
+!$OMP END PARALLEL DO
+      DEALLOCATE(eInv)
 
       ALLOCATE(tmpL(gnNo))
       tmpL = 0
       CALL MPI_ALLREDUCE(tagNd, tmpL, gnNo, mpint, MPI_MAX, cm%com(),
      2   ierr)
 
-      nn   = 0
-      nbnd = 0
-      DO a=1, gnNo
-         IF (tmpL(a) .GT. 0) nn = nn + 1
-         IF (tmpL(a) .EQ. 2*cm%np()) nbnd = nbnd + 1
-      END DO
-
-!     Assign tag for nodes that were interpolated in other processors
+!     Nodes interpolated in other processors are reassigned 0
       tagNd = 0
       DO a=1, nNo
          Ac = gN(a)
          tagNd(Ac) = tmpL(Ac)
-      END DO
-
-!     Now use brute force to find left over non-interpolated nodes
-      DO a=1, nNo
-         Ac = gN(a)
-         IF (tagNd(Ac) .EQ. 0) THEN
-            Xp = 1._RKIND
-            Xp(1:nsd) = tMsh%x(:,Ac)
-            CALL FINDN(Xp, iM, Dg, masElist, Ec, Nsf)
-            IF (Ec .GT. 0) THEN
-               gE(a) = Ec
-               tagNd(Ac) = cm%tF()
-               gNsf(:,a) = Nsf
-            END IF
-         END IF
-      END DO
-
-!     Nodes belonging to other procs are reassigned 0
-      DO a=1, nNo
-         Ac = gN(a)
          IF (tagNd(Ac).NE.cm%tF() .AND. tagNd(Ac).NE.bTag) THEN
             gE(a) = 0
             tagNd(Ac) = 0
@@ -1037,50 +1029,40 @@ c     Check mesh quality and reset IEN if necessary
 !     from the source to the target mesh
       ALLOCATE(tmpX(lDof,nNo))
       tmpX = 0._RKIND
+!$OMP PARALLEL DO PRIVATE(a, i, Ac, Bc, Ec)
       DO a=1, nNo
          Ac = gN(a)
          IF (tagNd(Ac) .EQ. cm%tF()) THEN
             Ec = gE(a)
-            Nsf = gNsf(:,a)
             DO i=1, eNoN
                Bc = msh(iM)%IEN(i,Ec)
                Bc = msh(iM)%lN(Bc)
-               tmpX(:,a) = tmpX(:,a) + Nsf(i)*sD(:,Bc)
+               tmpX(:,a) = tmpX(:,a) + gNsf(i,a)*sD(:,Bc)
             END DO
          END IF
       END DO
+!$OMP END PARALLEL DO
 
-!     Since there is no direct mapping for face data, we use L2 norm
-!     to find the nearest face node and copy its solution. This requires
-!     face node/IEN structure to NOT be changed during remeshing.
-      ALLOCATE(tmpL(nNo))
-      tmpL = 0
+!     Since there is no direct mapping for face data, the coincident
+!     node of the source mesh is found in the hierarchy and its solution
+!     is copied. This requires face node/IEN structure to NOT be changed
+!     during remeshing.
+!$OMP PARALLEL DO PRIVATE(a, Ac, Bc)
       DO a=1, nNo
+         IF (srfNds(a) .EQ. 0) CYCLE
          Ac = gN(a)
-         IF (srfNds(a) .GT. 0) THEN
-            flag = .FALSE.
-            DO iFa=1, msh(iM)%nFa
-               DO b=1, msh(iM)%fa(iFa)%nNo
-                  Bc = msh(iM)%fa(iFa)%gN(b)
-                  dS = SQRT(SUM( (x(:,Bc)+Dg(:,Bc) -
-     2               tMsh%x(:,Ac))**2._RKIND ))
-                  IF (dS .LT. 1.E-12_RKIND) THEN
-                     tmpL(a) = Bc
-                     flag = .TRUE.
-                     EXIT
-                  END IF
-               END DO
-               IF (flag) EXIT
-            END DO
-            IF (flag) THEN
-               Bc = msh(iM)%lN(tmpL(a))
-               tmpX(:,a) = sD(:,Bc)
-            ELSE
-               tagNd(Ac) = 0
-            END IF
+         Bc = 0
+         IF (nE .GT. 0) CALL BVNEAR(1, nE, tMsh%x(:,Ac), 1.E-12_RKIND,
+     2      Bc)
+         IF (Bc .GT. 0) THEN
+            Bc = msh(iM)%lN(Bc)
+            tmpX(:,a) = sD(:,Bc)
+         ELSE
+            tagNd(Ac) = 0
          END IF
       END DO
-      DEALLOCATE(tmpL)
+!$OMP END PARALLEL DO
+      DEALLOCATE(xs, eMin, eMax, bMin, bMax, bvP)
 
 !     Map the tagged nodes and solution to local vector within a proc,
 !     including boundary nodes. Since the boundary nodes can be overlapping
@@ -1168,335 +1150,144 @@ c     Check mesh quality and reset IEN if necessary
       DEALLOCATE(vec, gvec, sCount, disp)
 
       RETURN
-      END SUBROUTINE INTERP
+      CONTAINS
 !--------------------------------------------------------------------
-!     Distribute the new mesh nodes among all the processors
-      SUBROUTINE DISTRN(iM, lM, Dg, nNo, gN)
-      USE COMMOD
-      USE UTILMOD
-      USE ALLFUN
+!     Splits the range bvP(lo:hi) at the median of the element centers
+!     along the direction of its largest extent, and stores the box of
+!     the range at its middle, which is unique to every inner range
+      RECURSIVE SUBROUTINE BVBUILD(lo, hi)
       IMPLICIT NONE
-      TYPE(mshType), INTENT(INOUT) :: lM
-      INTEGER(KIND=IKIND), INTENT(IN) :: iM
-      INTEGER(KIND=IKIND), INTENT(OUT) :: nNo
-      INTEGER(KIND=IKIND), ALLOCATABLE :: gN(:)
-      REAL(KIND=RKIND), INTENT(IN) :: Dg(nsd,tnNo)
-
-      INTEGER(KIND=IKIND) :: i, a, b, Ac, gnNo, ierr
-      REAL(KIND=RKIND) :: f, tol, dS, minS
-
-      INTEGER(KIND=IKIND), ALLOCATABLE :: part(:), tmpI(:)
-
-      gnNo = lM%gnNo
-      i = 0
-      f = 2.5E-2_RKIND
-      ALLOCATE(part(gnNo), tmpI(gnNo))
- 003  part  = 0
-      tmpI  = 0
-      nNo   = 0
-      f     = 2._RKIND*f
-      tol   = (1._RKIND+f) * rmsh%maxEdgeSize(iM)
-      i = i+1
-      DO a=1, gnNo
-         IF (part(a) .NE. 0) CYCLE
-         minS  = HUGE(minS)
-         DO b=1, msh(iM)%nNo
-            Ac = msh(iM)%gN(b)
-            dS = SQRT(SUM((x(:,Ac)+Dg(:,Ac)-lM%x(:,a))**2._RKIND))
-            IF (minS .GT. dS) minS = dS
+      INTEGER(KIND=IKIND), INTENT(IN) :: lo, hi
+
+      INTEGER(KIND=IKIND) i, j, l, r, m, d, t
+      REAL(KIND=RKIND) cMin(nsd), cMax(nsd), pv
+
+      IF (hi-lo+1 .LE. nLeaf) RETURN
+
+      m = (lo + hi)/2
+      bMin(:,m) = HUGE(pv)
+      bMax(:,m) = -HUGE(pv)
+      cMin = HUGE(pv)
+      cMax = -HUGE(pv)
+      DO i=lo, hi
+         bMin(:,m) = MIN(bMin(:,m), eMin(:,bvP(i)))
+         bMax(:,m) = MAX(bMax(:,m), eMax(:,bvP(i)))
+         cMin(:) = MIN(cMin(:), xc(:,bvP(i)))
+         cMax(:) = MAX(cMax(:), xc(:,bvP(i)))
+      END DO
+      d = MAXLOC(cMax(:) - cMin(:), 1)
+
+!     Quickselect so that bvP(m) is the median along d
+      l = lo
+      r = hi
+      DO WHILE (l .LT. r)
+         pv = xc(d,bvP((l+r)/2))
+         i  = l
+         j  = r
+         DO WHILE (i .LE. j)
+            DO WHILE (xc(d,bvP(i)) .LT. pv)
+               i = i + 1
+            END DO
+            DO WHILE (xc(d,bvP(j)) .GT. pv)
+               j = j - 1
+            END DO
+            IF (i .LE. j) THEN
+               t      = bvP(i)
+               bvP(i) = bvP(j)
+               bvP(j) = t
+               i = i + 1
+               j = j - 1
+            END IF
          END DO
-         IF (minS .LT. tol) THEN
-            nNo = nNo + 1
-            part(a) = cm%tF()
+         IF (m .LE. j) THEN
+            r = j
+         ELSE IF (m .GE. i) THEN
+            l = i
+         ELSE
+            EXIT
          END IF
       END DO
 
-      CALL MPI_ALLREDUCE(part, tmpI, gnNo, mpint, MPI_MAX, cm%com(),
-     2   ierr)
-
-      b = 0
-      DO a=1, gnNo
-         IF (tmpI(a) .GT. 0) b = b + 1
-      END DO
-
-      IF (b .NE. gnNo) THEN
-         wrn = "Found only "//STR(b)//" nodes in pass "//STR(i)//
-     2      " out of "//STR(gnNo)//" nodes"
-         IF (i .GT. 5) err = "Could not distribute all nodes in "//
-     2      STR(i)//" passes. Try changing tolerance."
-         GOTO 003
-      END IF
-
-      ALLOCATE(gN(nNo), lM%gpN(gnNo))
-      nNo = 0
-      DO a=1, gnNo
-         IF (part(a) .EQ. cm%tF()) THEN
-            nNo = nNo + 1
-            gN(nNo) = a
-         END IF
-      END DO
-!      WRITE(*,'(A)') "CPU "//STR(cm%tF())//" nNo = "//STR(nNo)
-      lM%gpN = part
-      DEALLOCATE(part, tmpI)
+      CALL BVBUILD(lo, m)
+      CALL BVBUILD(m+1, hi)
 
       RETURN
-      END SUBROUTINE DISTRN
+      END SUBROUTINE BVBUILD
 !--------------------------------------------------------------------
-!     Distribute the new mesh elements to all processors
-      SUBROUTINE DISTRE(lM, nEl, gE)
-      USE COMMOD
-      USE ALLFUN
-      USE UTILMOD
+!     Searches bvP(lo:hi) for an element containing xp = (x,1) and
+!     returns its barycentric coordinates at xp
+      RECURSIVE SUBROUTINE BVFIND(lo, hi, xp, Ec, Nsf)
       IMPLICIT NONE
-      TYPE(mshType), INTENT(INOUT) :: lM
-      INTEGER(KIND=IKIND), INTENT(OUT) :: nEl
-      INTEGER(KIND=IKIND), ALLOCATABLE :: gE(:)
-
-      INTEGER(KIND=IKIND) :: e, a, i, Ac, gnEl, eNoN
-
-      INTEGER(KIND=IKIND), ALLOCATABLE :: part(:)
-
-      gnEL = lM%gnEl
-      eNoN = lM%eNoN
-
-      ALLOCATE(part(gnEl))
-      part = 0
-      nEl  = 0
-      DO e=1, gnEl
-         i = 0
-         DO a=1, eNoN
-            Ac = lM%gIEN(a,e)
-            IF (lM%gpN(Ac) .EQ. cm%tF()) i = i + 1
+      INTEGER(KIND=IKIND), INTENT(IN) :: lo, hi
+      REAL(KIND=RKIND), INTENT(IN) :: xp(eNoN)
+      INTEGER(KIND=IKIND), INTENT(INOUT) :: Ec
+      REAL(KIND=RKIND), INTENT(INOUT) :: Nsf(eNoN)
+
+      INTEGER(KIND=IKIND) i, e, m
+
+      IF (hi-lo+1 .LE. nLeaf) THEN
+         DO i=lo, hi
+            e = bvP(i)
+            IF (ANY(xp(1:nsd).LT.eMin(:,e)) .OR.
+     2          ANY(xp(1:nsd).GT.eMax(:,e))) CYCLE
+            Nsf(2:eNoN) = MATMUL(eInv(:,:,e),
+     2         xp(1:nsd) - xs(:,msh(iM)%IEN(1,e)))
+            Nsf(1) = 1._RKIND - SUM(Nsf(2:eNoN))
+            IF (ALL(Nsf.GT.-1.E-14_RKIND .AND.
+     2              Nsf.LT.(1._RKIND+1.E-14_RKIND))) THEN
+               Ec = e
+               RETURN
+            END IF
          END DO
-         IF (i .EQ. eNoN) THEN
-            nEl = nEl + 1
-            part(e) = 1
-         END IF
-      END DO
-      DEALLOCATE(lM%gpN)
-!      WRITE(*,'(A)') "CPU "//STR(cm%tF())//" nEl = "//STR(nEl)
-
-      ALLOCATE(gE(nEl))
-      nEl = 0
-      DO e=1, gnEl
-         IF (part(e) .GT. 0) THEN
-            nEl = nEl + 1
-            gE(nEl) = e
-         END IF
-      END DO
-      DEALLOCATE(part)
-
-      RETURN
-      END SUBROUTINE DISTRE
-!--------------------------------------------------------------------
-!     Create list of connected/adjacent elements for old/source mesh
-      SUBROUTINE GETADJESRC(lM, kneList)
-      USE COMMOD
-      USE UTILMOD
-      USE ALLFUN
-      IMPLICIT NONE
-      TYPE(mshType), INTENT(IN) :: lM
-      INTEGER(KIND=IKIND), ALLOCATABLE :: kneList(:,:)
+         RETURN
+      END IF
 
-      LOGICAL :: flag
-      INTEGER(KIND=IKIND) :: a, b, e, Ac, i, j, maxKNE
+      m = (lo + hi)/2
+      IF (ANY(xp(1:nsd).LT.bMin(:,m)) .OR.
+     2    ANY(xp(1:nsd).GT.bMax(:,m))) RETURN
 
-      INTEGER(KIND=IKIND), ALLOCATABLE :: nL(:), tmpList(:,:)
-
-!     First get elements around all nodes
-      ALLOCATE(nL(lM%nNo))
-      nL = 0
-      DO e=1, lM%nEl
-         DO a=1, lM%eNoN
-            Ac = lM%IEN(a,e)
-            Ac = lM%lN(Ac)
-            nL(Ac) = nL(Ac) + 1
-         END DO
-      END DO
-
-      maxKNE = MAX(MAXVAL(nL), 0)
-      ALLOCATE(tmpList(maxKNE, lM%nNo))
-      nL(:)  = 0
-      tmpList(:,:) = 0
-      DO e=1, lM%nEl
-         DO a=1, lM%eNoN
-            Ac = lM%IEN(a,e)
-            Ac = lM%lN(Ac)
-            nL(Ac) = nL(Ac) + 1
-            tmpList(nL(Ac), Ac) = e
-         END DO
-      END DO
-      b = 2*maxKNE
-
-!     Now get elements around each element and avoid redundancy
- 001  b = b + maxKNE
-      DEALLOCATE(nL)
-      ALLOCATE(nL(lM%nEl))
-      IF (ALLOCATED(kneList)) DEALLOCATE(kneList)
-      ALLOCATE(kneList(b, lM%nEl))
-      kneList = 0
-      nL = 0
-      DO e=1, lM%nEl
-         DO a=1, lM%eNoN
-            Ac = lM%IEN(a,e)
-            Ac = lM%lN(Ac)
-            DO i=1, maxKNE
-               IF (tmpList(i,Ac) .NE. 0) THEN
-                  flag = .TRUE.
-                  DO j=1, nL(e)
-                     IF (kneList(j,e) .EQ. tmpList(i,Ac)) THEN
-                        flag = .FALSE.
-                        EXIT
-                     END IF
-                  END DO
-                  IF (flag) THEN
-                     nL(e) = nL(e) + 1
-                     IF (nL(e) .GE. b) GOTO 001
-                     kneList(nL(e), e) = tmpList(i,Ac)
-                  END IF
-               ELSE
-                  EXIT
-               END IF
-            END DO
-         END DO
-      END DO
-      DEALLOCATE(tmpList)
-      maxKNE = MAX(MAXVAL(nL), 0)
-!      WRITE(*,'(A)') "CPU "//STR(cm%tF())//", maxKNE = "//STR(maxKNE)
-
-      ALLOCATE(tmpList(b,lM%nEl))
-      tmpList = kneList
-      DEALLOCATE(kneList)
-      ALLOCATE(kneList(maxKNE, lM%nEl))
-      DO e=1, lM%nEl
-         kneList(:, e) = tmpList(1:maxKNE, e)
-      END DO
-      DEALLOCATE(nL, tmpList)
+      CALL BVFIND(lo, m, xp, Ec, Nsf)
+      IF (Ec .EQ. 0) CALL BVFIND(m+1, hi, xp, Ec, Nsf)
 
       RETURN
-      END SUBROUTINE GETADJESRC
+      END SUBROUTINE BVFIND
 !--------------------------------------------------------------------
-!     Create list of connected/adjacent nodes for new/target mesh
-      SUBROUTINE GETADJNTGT(lM, nNo, nEl, gN, gE, knnList)
-      USE COMMOD
-      USE UTILMOD
-      USE ALLFUN
+!     Searches bvP(lo:hi) for a node of the source mesh closer than tol
+!     to xq and returns it in Bc
+      RECURSIVE SUBROUTINE BVNEAR(lo, hi, xq, tol, Bc)
       IMPLICIT NONE
-      TYPE(mshType), INTENT(IN) :: lM
-      INTEGER(KIND=IKIND), INTENT(IN) :: nNo, nEl, gN(nNo), gE(nEl)
-      INTEGER(KIND=IKIND), ALLOCATABLE :: knnList(:,:)
-
-      LOGICAL :: flag
-      INTEGER(KIND=IKIND) :: a, b, e, Ac, Bc, Ec, i, j, n, maxKNN
-
-      INTEGER(KIND=IKIND), ALLOCATABLE :: lN(:), nL(:), tmpList(:,:)
-
-      ALLOCATE(lN(lM%gnNo))
-      lN = 0
-      DO a=1, nNo
-         Ac = gN(a)
-         lN(Ac) = a
-      END DO
-
-      ALLOCATE(nL(nNo))
-      nL = 0
-      DO e=1, nEl
-         Ec = gE(e)
-         DO a=1, lM%eNoN
-            Ac = lM%gIEN(a,Ec)
-            i = lN(Ac)
-            DO b=1, lM%eNoN
-               IF (b .EQ. a) CYCLE
-               Bc = lM%gIEN(b,Ec)
-               nL(i) = nL(i) + 1
-            END DO
-         END DO
-      END DO
-      maxKNN = MAX(MAXVAL(nL), 0)
-
-      ALLOCATE(tmpList(maxKNN, nNo))
-      tmpList = 0
-      nL = 0
-      DO e=1, nEl
-         Ec = gE(e)
-         DO a=1, lM%eNoN
-            Ac = lM%gIEN(a,Ec)
-            i = lN(Ac)
-            DO b=1, lM%eNoN
-               IF (a .EQ. b) CYCLE
-               Bc = lM%gIEN(b,Ec)
-               j = lN(Bc)
-               flag = .TRUE.
-               DO n=1, nL(i)
-                  IF (tmpList(n,i) .EQ. j) THEN
-                     flag = .FALSE.
-                     EXIT
-                  END IF
-               END DO
-               IF (flag) THEN
-                  nL(i) = nL(i) + 1
-                  tmpList(nL(i), i) = j
+      INTEGER(KIND=IKIND), INTENT(IN) :: lo, hi
+      REAL(KIND=RKIND), INTENT(IN) :: xq(nsd), tol
+      INTEGER(KIND=IKIND), INTENT(INOUT) :: Bc
+
+      INTEGER(KIND=IKIND) i, a, e, m, Ac
+
+      IF (hi-lo+1 .LE. nLeaf) THEN
+         DO i=lo, hi
+            e = bvP(i)
+            IF (ANY(xq.LT.eMin(:,e)-tol) .OR.
+     2          ANY(xq.GT.eMax(:,e)+tol)) CYCLE
+            DO a=1, eNoN
+               Ac = msh(iM)%IEN(a,e)
+               IF (SUM((xs(:,Ac) - xq(:))**2) .LT. tol*tol) THEN
+                  Bc = Ac
+                  RETURN
                END IF
             END DO
          END DO
-      END DO
-      maxKNN = MAX(MAXVAL(nL), 0)
-!      WRITE(*,'(A)') "CPU "//STR(cm%tF())//", maxKNN = "//STR(maxKNN)
+         RETURN
+      END IF
 
-      ALLOCATE(knnList(maxKNN, nNo))
-      DO a=1, nNo
-         knnList(:,a) = tmpList(1:maxKNN,a)
-      END DO
-      DEALLOCATE(tmpList, nL, lN)
+      m = (lo + hi)/2
+      IF (ANY(xq.LT.bMin(:,m)-tol) .OR.
+     2    ANY(xq.GT.bMax(:,m)+tol)) RETURN
 
-      RETURN
-      END SUBROUTINE GETADJNTGT
-!--------------------------------------------------------------------
-!     Find element in the old mesh for each node in the new mesh
-      SUBROUTINE FINDN(xp, iM, Dg, eList, Ec, Nsf)
-      USE COMMOD
-      USE MATFUN
-      IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: iM, eList(:)
-      INTEGER(KIND=IKIND), INTENT(OUT) :: Ec
-      REAL(KIND=RKIND), INTENT(IN) :: xp(nsd+1), Dg(nsd,tnNo)
-      REAL(KIND=RKIND), INTENT(OUT) :: Nsf(msh(iM)%eNoN)
-
-      INTEGER(KIND=IKIND) :: e, a, i, j, ne, Ac
-
-      REAL(KIND=RKIND), ALLOCATABLE :: Amat(:,:)
-
-      ne = size(eList)
-      ALLOCATE(Amat(nsd+1,msh(iM)%eNoN))
-      Nsf(:) = 0._RKIND
-      DO e=1, ne
-         Ec = eList(e)
-         IF (Ec .EQ. 0) EXIT
-         Amat = 1._RKIND
-         DO a=1, msh(iM)%eNoN
-            Ac = msh(iM)%IEN(a,Ec)
-            Amat(1:nsd,a) = x(:,Ac) + Dg(:,Ac)
-         END DO
-         Amat = MAT_INV(Amat, msh(iM)%eNoN)
-         a = 0
-         DO i=1, nsd+1
-            Nsf(i) = 0._RKIND
-            DO j=1, msh(iM)%eNoN
-               Nsf(i) = Nsf(i) + Amat(i,j)*Xp(j)
-            END DO
-            IF (Nsf(i).GT.-1.E-14_RKIND .AND.
-     2          Nsf(i).LT.(1._RKIND+1.E-14_RKIND)) THEN
-               a = a + 1
-            END IF
-         END DO
-         IF (a .EQ. nsd+1) THEN
-            RETURN
-         END IF
-      END DO
-      Ec = 0
-      Nsf(:) = 0._RKIND
+      CALL BVNEAR(lo, m, xq, tol, Bc)
+      IF (Bc .EQ. 0) CALL BVNEAR(m+1, hi, xq, tol, Bc)
 
       RETURN
-      END SUBROUTINE FINDN
+      END SUBROUTINE BVNEAR
+!--------------------------------------------------------------------
+      END SUBROUTINE INTERP
 !--------------------------------------------------------------------
 
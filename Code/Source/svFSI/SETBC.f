@@ -876,35 +876,13 @@
       INTEGER(KIND=IKIND), PARAMETER :: iEq = 1
 
       LOGICAL RCRflag
-      INTEGER(KIND=IKIND) iFa, ptr, iBc, iM
-      REAL(KIND=RKIND) tmp
+      INTEGER(KIND=IKIND) iFa, ptr, iBc
 
       IF (cplBC%schm .EQ. cplBC_I) THEN
          CALL CALCDERCPLBC
       ELSE
-         RCRflag = .FALSE.
-         DO iBc=1, eq(iEq)%nBc
-            iFa = eq(iEq)%bc(iBc)%iFa
-            iM  = eq(iEq)%bc(iBc)%iM
-            ptr = eq(iEq)%bc(iBc)%cplBCptr
-            IF (BTEST(eq(iEq)%bc(iBc)%bType,bType_RCR)) THEN
-               IF (.NOT.RCRflag) RCRflag = .TRUE.
-            END IF
-            IF (ptr .NE. 0) THEN
-               IF (BTEST(eq(iEq)%bc(iBc)%bType,bType_Neu)) THEN
-                  cplBC%fa(ptr)%Qo = Integ(msh(iM)%fa(iFa),Yo,1,nsd)
-                  cplBC%fa(ptr)%Qn = Integ(msh(iM)%fa(iFa),Yn,1,nsd)
-                  cplBC%fa(ptr)%Po = 0._RKIND
-                  cplBC%fa(ptr)%Pn = 0._RKIND
-               ELSE IF (BTEST(eq(iEq)%bc(iBc)%bType,bType_Dir)) THEN
-                  tmp = msh(iM)%fa(iFa)%area
-                  cplBC%fa(ptr)%Po = Integ(msh(iM)%fa(iFa),Yo,nsd+1)/tmp
-                  cplBC%fa(ptr)%Pn = Integ(msh(iM)%fa(iFa),Yn,nsd+1)/tmp
-                  cplBC%fa(ptr)%Qo = 0._RKIND
-                  cplBC%fa(ptr)%Qn = 0._RKIND
-               END IF
-            END IF
-         END DO
+         RCRflag = ANY(BTEST(eq(iEq)%bc(:)%bType,bType_RCR))
+         CALL CPLBCINTEG()
          IF (cplBC%useGenBC) THEN
             CALL genBC_Integ_X('T')
          ELSE
@@ -921,6 +899,71 @@
       RETURN
       END SUBROUTINE SETBCCPL
 !--------------------------------------------------------------------
+!     Flow rates (Neumann) and mean pressures (Dirichlet) at the old and
+!     new time levels of the coupled faces, computed in one pass over
+!     their elements with a single reduction
+      SUBROUTINE CPLBCINTEG()
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      INTEGER(KIND=IKIND), PARAMETER :: iEq = 1
+
+      LOGICAL qTH(4)
+      INTEGER(KIND=IKIND) i, m, iBc, iFa, iM, ptr, nF, nq, qs(4), ql(4)
+      REAL(KIND=RKIND) area
+
+      INTEGER(KIND=IKIND), ALLOCATABLE :: fList(:,:), bList(:)
+      REAL(KIND=RKIND), ALLOCATABLE :: sY(:,:), res(:,:)
+
+      ALLOCATE(fList(2,eq(iEq)%nBc), bList(eq(iEq)%nBc))
+      nF = 0
+      DO iBc=1, eq(iEq)%nBc
+         IF (eq(iEq)%bc(iBc)%cplBCptr .EQ. 0) CYCLE
+         IF (.NOT.BTEST(eq(iEq)%bc(iBc)%bType,bType_Neu) .AND.
+     2       .NOT.BTEST(eq(iEq)%bc(iBc)%bType,bType_Dir)) CYCLE
+         nF = nF + 1
+         fList(1,nF) = eq(iEq)%bc(iBc)%iM
+         fList(2,nF) = eq(iEq)%bc(iBc)%iFa
+         bList(nF)   = iBc
+      END DO
+
+!     Yo and Yn are stacked; Q uses rows 1:nsd and P uses row nsd+1,
+!     if the equation has a pressure
+      m  = MIN(tDof, nsd+1)
+      nq = 2
+      IF (m .GT. nsd) nq = 4
+      ALLOCATE(sY(2*m,tnNo), res(4,nF))
+      sY(1:m,:)     = Yo(1:m,:)
+      sY(m+1:2*m,:) = Yn(1:m,:)
+      qs  = (/1, m+1, m, 2*m/)
+      ql  = (/nsd, nsd, 1, 1/)
+      qTH = .FALSE.
+      CALL IntegFa(nF, fList(:,1:nF), nq, qs, ql, qTH, sY, res(1:nq,:))
+
+      DO i=1, nF
+         iBc = bList(i)
+         iM  = fList(1,i)
+         iFa = fList(2,i)
+         ptr = eq(iEq)%bc(iBc)%cplBCptr
+         IF (BTEST(eq(iEq)%bc(iBc)%bType,bType_Neu)) THEN
+            cplBC%fa(ptr)%Qo = res(1,i)
+            cplBC%fa(ptr)%Qn = res(2,i)
+            cplBC%fa(ptr)%Po = 0._RKIND
+            cplBC%fa(ptr)%Pn = 0._RKIND
+         ELSE
+            area = msh(iM)%fa(iFa)%area
+            cplBC%fa(ptr)%Po = res(3,i)/area
+            cplBC%fa(ptr)%Pn = res(4,i)/area
+            cplBC%fa(ptr)%Qo = 0._RKIND
+            cplBC%fa(ptr)%Qn = 0._RKIND
+         END IF
+      END DO
+
+      DEALLOCATE(fList, bList, sY, res)
+
+      RETURN
+      END SUBROUTINE CPLBCINTEG
+!--------------------------------------------------------------------
 !     cplBC derivative is calculated here
       SUBROUTINE CALCDERCPLBC
       USE COMMOD
@@ -931,34 +974,13 @@
      2   relTol = 1.E-5_RKIND
 
       LOGICAL RCRflag
-      INTEGER(KIND=IKIND) iFa, i, j, ptr, iBc, iM
-      REAL(KIND=RKIND) orgQ, orgY, diff, area
+      INTEGER(KIND=IKIND) i, j, iBc
+      REAL(KIND=RKIND) orgQ, orgY, diff
 
       IF (ALL(cplBC%fa%bGrp.EQ.cplBC_Dir)) RETURN
 
-      RCRflag = .FALSE.
-      DO iBc=1, eq(iEq)%nBc
-         iFa = eq(iEq)%bc(iBc)%iFa
-         iM  = eq(iEq)%bc(iBc)%iM
-         ptr = eq(iEq)%bc(iBc)%cplBCptr
-         IF (BTEST(eq(iEq)%bc(iBc)%bType,bType_RCR)) THEN
-            IF (.NOT.RCRflag) RCRflag = .TRUE.
-         END IF
-         IF (ptr .NE. 0) THEN
-            IF (BTEST(eq(iEq)%bc(iBc)%bType,bType_Neu)) THEN
-               cplBC%fa(ptr)%Qo = Integ(msh(iM)%fa(iFa),Yo,1,nsd)
-               cplBC%fa(ptr)%Qn = Integ(msh(iM)%fa(iFa),Yn,1,nsd)
-               cplBC%fa(ptr)%Po = 0._RKIND
-               cplBC%fa(ptr)%Pn = 0._RKIND
-            ELSE IF (BTEST(eq(iEq)%bc(iBc)%bType,bType_Dir)) THEN
-               area = msh(iM)%fa(iFa)%area
-               cplBC%fa(ptr)%Po = Integ(msh(iM)%fa(iFa),Yo,nsd+1)/area
-               cplBC%fa(ptr)%Pn = Integ(msh(iM)%fa(iFa),Yn,nsd+1)/area
-               cplBC%fa(ptr)%Qo = 0._RKIND
-               cplBC%fa(ptr)%Qn = 0._RKIND
-            END IF
-         END IF
-      END DO
+      RCRflag = ANY(BTEST(eq(iEq)%bc(:)%bType,bType_RCR))
+      CALL CPLBCINTEG()
 
       IF (cplBC%useGenBC) THEN
          CALL genBC_Integ_X('D')
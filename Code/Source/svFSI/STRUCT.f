@@ -44,15 +44,17 @@
       REAL(KIND=RKIND), INTENT(IN) :: Ag(tDof,tnNo), Yg(tDof,tnNo),
      2   Dg(tDof,tnNo)
 
-      INTEGER(KIND=IKIND) a, e, g, Ac, eNoN, cPhys, iFn, nFn
+      INTEGER(KIND=IKIND) a, e, g, Ac, eNoN, nG, cPhys, iFn, nFn
       REAL(KIND=RKIND) w, Jac, ksix(nsd,nsd)
 
       INTEGER(KIND=IKIND), ALLOCATABLE :: ptr(:)
       REAL(KIND=RKIND), ALLOCATABLE :: xl(:,:), al(:,:), yl(:,:),
      2   dl(:,:), bfl(:,:), fN(:,:), pS0l(:,:), pSl(:), ya_l(:), N(:),
-     3   Nx(:,:), lR(:,:), lK(:,:,:)
+     3   Nx(:,:), lR(:,:), lK(:,:,:), wg(:), Nxg(:,:,:), Fg(:,:,:),
+     4   Sg(:,:,:), Dmg(:,:,:), Jag(:)
 
       eNoN = lM%eNoN
+      nG   = lM%nG
       nFn  = lM%nFn
       IF (nFn .EQ. 0) nFn = 1
 
@@ -60,7 +62,8 @@
       ALLOCATE(ptr(eNoN), xl(nsd,eNoN), al(tDof,eNoN), yl(tDof,eNoN),
      2   dl(tDof,eNoN), bfl(nsd,eNoN), fN(nsd,nFn), pS0l(nsymd,eNoN),
      3   pSl(nsymd), ya_l(eNoN), N(eNoN), Nx(nsd,eNoN), lR(dof,eNoN),
-     4   lK(dof*dof,eNoN,eNoN))
+     4   lK(dof*dof,eNoN,eNoN), wg(nG), Nxg(nsd,eNoN,nG),
+     5   Fg(nsd,nsd,nG), Sg(nsd,nsd,nG), Dmg(nsymd,nsymd,nG), Jag(nG))
 
 !     Loop over all elements of mesh
       DO e=1, lM%nEl
@@ -93,25 +96,40 @@
             IF (cem%cpld) ya_l(a) = cem%Ya(Ac)
          END DO
 
-!        Gauss integration
-         lR = 0._RKIND
-         lK = 0._RKIND
-         DO g=1, lM%nG
-            IF (g.EQ.1 .OR. .NOT.lM%lShpF) THEN
+!        Shape function derivatives at all the Gauss points
+         DO g=1, nG
+            IF (lM%lCNx) THEN
+               Nx   = lM%cNx(:,:,g,e)
+               Jac  = lM%cJac(g,e)
+               ksix = lM%cKs(:,:,g,e)
+            ELSE IF (g.EQ.1 .OR. .NOT.lM%lShpF) THEN
                CALL GNN(eNoN, nsd, lM%Nx(:,:,g), xl, Nx, Jac, ksix)
                IF (ISZERO(Jac)) err = "Jac < 0 @ element "//e
             END IF
-            w = lM%w(g) * Jac
+            wg(g) = lM%w(g) * Jac
+            Nxg(:,:,g) = Nx
+         END DO
+
+!        Deformation gradient, 2nd Piola-Kirchhoff stress and material
+!        stiffness at all the Gauss points, evaluated as one batch
+         CALL GETPK2CCe(eq(cEq)%dmn(cDmn), .FALSE., eNoN, nG, nFn, lM%N,
+     2      Nxg, dl, fN, ya_l, Fg, Sg, Dmg, Jag)
+
+!        Gauss integration
+         lR = 0._RKIND
+         lK = 0._RKIND
+         DO g=1, nG
+            w = wg(g)
             N = lM%N(:,g)
 
             pSl = 0._RKIND
             IF (nsd .EQ. 3) THEN
-               CALL STRUCT3D(eNoN, nFn, w, N, Nx, al, yl, dl, bfl, fN,
-     2            pS0l, pSl, ya_l, lR, lK)
+               CALL STRUCT3D(eNoN, w, N, Nxg(:,:,g), al, yl, bfl, pS0l,
+     2            Fg(:,:,g), Sg(:,:,g), Dmg(:,:,g), pSl, lR, lK)
 
             ELSE IF (nsd .EQ. 2) THEN
-               CALL STRUCT2D(eNoN, nFn, w, N, Nx, al, yl, dl, bfl, fN,
-     2            pS0l, pSl, ya_l, lR, lK)
+               CALL STRUCT2D(eNoN, w, N, Nxg(:,:,g), al, yl, bfl, pS0l,
+     2            Fg(:,:,g), Sg(:,:,g), Dmg(:,:,g), pSl, lR, lK)
 
             END IF
 
@@ -138,28 +156,30 @@
       END DO ! e: loop
 
       DEALLOCATE(ptr, xl, al, yl, dl, bfl, fN, pS0l, pSl, ya_l, N, Nx,
-     2   lR, lK)
+     2   lR, lK, wg, Nxg, Fg, Sg, Dmg, Jag)
 
       RETURN
       END SUBROUTINE CONSTRUCT_dSOLID
 !####################################################################
-      SUBROUTINE STRUCT3D(eNoN, nFn, w, N, Nx, al, yl, dl, bfl, fN,
-     2   pS0l, pSl, ya_l, lR, lK)
+!     F, Sm and Dm are the deformation gradient, 2nd Piola-Kirchhoff
+!     stress and material stiffness (Voigt notation) at the integration
+!     point, computed in batch by GETPK2CCe
+      SUBROUTINE STRUCT3D(eNoN, w, N, Nx, al, yl, bfl, pS0l, F, Sm, Dm,
+     2   pSl, lR, lK)
       USE COMMOD
       USE ALLFUN
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: eNoN, nFn
+      INTEGER(KIND=IKIND), INTENT(IN) :: eNoN
       REAL(KIND=RKIND), INTENT(IN) :: w, N(eNoN), Nx(3,eNoN),
-     2   al(tDof,eNoN), yl(tDof,eNoN), dl(tDof,eNoN), bfl(3,eNoN),
-     3   fN(3,nFn), pS0l(6,eNoN), ya_l(eNoN)
+     2   al(tDof,eNoN), yl(tDof,eNoN), bfl(3,eNoN), pS0l(6,eNoN),
+     3   F(3,3), Sm(3,3), Dm(6,6)
       REAL(KIND=RKIND), INTENT(OUT) :: pSl(6)
       REAL(KIND=RKIND), INTENT(INOUT) :: lR(dof,eNoN),
      2   lK(dof*dof,eNoN,eNoN)
 
       INTEGER(KIND=IKIND) :: a, b, i, j, k
-      REAL(KIND=RKIND) :: rho, dmp, T1, amd, afl, ya_g, fb(3), ud(3),
-     2   NxSNx, BmDBm, F(3,3), S(3,3), P(3,3), Dm(6,6), DBm(6,3),
-     3   Bm(6,3,eNoN), S0(3,3)
+      REAL(KIND=RKIND) :: rho, dmp, T1, amd, afl, fb(3), ud(3), NxSNx,
+     2   BmDBm, S(3,3), P(3,3), DBm(6,3), Bm(6,3,eNoN), S0(3,3)
 
 !     Define parameters
       rho     = eq(cEq)%dmn(cDmn)%prop(solid_density)
@@ -173,54 +193,33 @@
       j       = i + 1
       k       = j + 1
 
-!     Inertia, body force and deformation tensor (F)
+!     Inertia, body force and prestress
       ud     = -rho*fb
-      F      = 0._RKIND
-      F(1,1) = 1._RKIND
-      F(2,2) = 1._RKIND
-      F(3,3) = 1._RKIND
       S0     = 0._RKIND
-      ya_g   = 0._RKIND
       DO a=1, eNoN
          ud(1) = ud(1) + N(a)*(rho*(al(i,a)-bfl(1,a)) + dmp*yl(i,a))
          ud(2) = ud(2) + N(a)*(rho*(al(j,a)-bfl(2,a)) + dmp*yl(j,a))
          ud(3) = ud(3) + N(a)*(rho*(al(k,a)-bfl(3,a)) + dmp*yl(k,a))
 
-         F(1,1) = F(1,1) + Nx(1,a)*dl(i,a)
-         F(1,2) = F(1,2) + Nx(2,a)*dl(i,a)
-         F(1,3) = F(1,3) + Nx(3,a)*dl(i,a)
-         F(2,1) = F(2,1) + Nx(1,a)*dl(j,a)
-         F(2,2) = F(2,2) + Nx(2,a)*dl(j,a)
-         F(2,3) = F(2,3) + Nx(3,a)*dl(j,a)
-         F(3,1) = F(3,1) + Nx(1,a)*dl(k,a)
-         F(3,2) = F(3,2) + Nx(2,a)*dl(k,a)
-         F(3,3) = F(3,3) + Nx(3,a)*dl(k,a)
-
          S0(1,1) = S0(1,1) + N(a)*pS0l(1,a)
          S0(2,2) = S0(2,2) + N(a)*pS0l(2,a)
          S0(3,3) = S0(3,3) + N(a)*pS0l(3,a)
          S0(1,2) = S0(1,2) + N(a)*pS0l(4,a)
          S0(2,3) = S0(2,3) + N(a)*pS0l(5,a)
          S0(3,1) = S0(3,1) + N(a)*pS0l(6,a)
-
-         ya_g    = ya_g + N(a)*ya_l(a)
       END DO
       S0(2,1) = S0(1,2)
       S0(3,2) = S0(2,3)
       S0(1,3) = S0(3,1)
 
-!     2nd Piola-Kirchhoff tensor (S) and material stiffness tensor in
-!     Voigt notationa (Dm)
-      CALL GETPK2CC(eq(cEq)%dmn(cDmn), F, nFn, fN, ya_g, S, Dm)
-
 !     Prestress
-      pSl(1) = S(1,1)
-      pSl(2) = S(2,2)
-      pSl(3) = S(3,3)
-      pSl(4) = S(1,2)
-      pSl(5) = S(2,3)
-      pSl(6) = S(3,1)
-      S = S + S0
+      pSl(1) = Sm(1,1)
+      pSl(2) = Sm(2,2)
+      pSl(3) = Sm(3,3)
+      pSl(4) = Sm(1,2)
+      pSl(5) = Sm(2,3)
+      pSl(6) = Sm(3,1)
+      S = Sm + S0
 
 !     1st Piola-Kirchhoff tensor (P)
       P = MATMUL(F, S)
@@ -322,23 +321,25 @@
       RETURN
       END SUBROUTINE STRUCT3D
 !####################################################################
-      SUBROUTINE STRUCT2D(eNoN, nFn, w, N, Nx, al, yl, dl, bfl, fN,
-     2   pS0l, pSl, ya_l, lR, lK)
+!     F, Sm and Dm are the deformation gradient, 2nd Piola-Kirchhoff
+!     stress and material stiffness (Voigt notation) at the integration
+!     point, computed in batch by GETPK2CCe
+      SUBROUTINE STRUCT2D(eNoN, w, N, Nx, al, yl, bfl, pS0l, F, Sm, Dm,
+     2   pSl, lR, lK)
       USE COMMOD
       USE ALLFUN
       IMPLICIT NONE
-      INTEGER(KIND=IKIND), INTENT(IN) :: eNoN, nFn
+      INTEGER(KIND=IKIND), INTENT(IN) :: eNoN
       REAL(KIND=RKIND), INTENT(IN) :: w, N(eNoN), Nx(2,eNoN),
-     2   al(tDof,eNoN), yl(tDof,eNoN), dl(tDof,eNoN), bfl(2,eNoN),
-     3   fN(2,nFn), pS0l(3,eNoN), ya_l(eNoN)
+     2   al(tDof,eNoN), yl(tDof,eNoN), bfl(2,eNoN), pS0l(3,eNoN),
+     3   F(2,2), Sm(2,2), Dm(3,3)
       REAL(KIND=RKIND), INTENT(OUT) :: pSl(3)
       REAL(KIND=RKIND), INTENT(INOUT) :: lR(dof,eNoN),
      2   lK(dof*dof,eNoN,eNoN)
 
       INTEGER(KIND=IKIND) :: a, b, i, j
-      REAL(KIND=RKIND) :: rho, dmp, T1, amd, afl, ya_g, fb(2), ud(2),
-     2   NxSNx, BmDBm, F(2,2), S(2,2), P(2,2), Dm(3,3), DBm(3,2),
-     3   Bm(3,2,eNoN), S0(2,2)
+      REAL(KIND=RKIND) :: rho, dmp, T1, amd, afl, fb(2), ud(2), NxSNx,
+     2   BmDBm, S(2,2), P(2,2), DBm(3,2), Bm(3,2,eNoN), S0(2,2)
 
 !     Define parameters
       rho     = eq(cEq)%dmn(cDmn)%prop(solid_density)
@@ -350,39 +351,24 @@
       i       = eq(cEq)%s
       j       = i + 1
 
-!     Inertia, body force and deformation tensor (F)
+!     Inertia, body force and prestress
       ud     = -rho*fb
-      F      = 0._RKIND
-      F(1,1) = 1._RKIND
-      F(2,2) = 1._RKIND
       S0     = 0._RKIND
-      ya_g   = 0._RKIND
       DO a=1, eNoN
          ud(1) = ud(1) + N(a)*(rho*(al(i,a)-bfl(1,a)) + dmp*yl(i,a))
          ud(2) = ud(2) + N(a)*(rho*(al(j,a)-bfl(2,a)) + dmp*yl(j,a))
 
-         F(1,1) = F(1,1) + Nx(1,a)*dl(i,a)
-         F(1,2) = F(1,2) + Nx(2,a)*dl(i,a)
-         F(2,1) = F(2,1) + Nx(1,a)*dl(j,a)
-         F(2,2) = F(2,2) + Nx(2,a)*dl(j,a)
-
          S0(1,1) = S0(1,1) + N(a)*pS0l(1,a)
          S0(2,2) = S0(2,2) + N(a)*pS0l(2,a)
          S0(1,2) = S0(1,2) + N(a)*pS0l(3,a)
-
-         ya_g    = ya_g + N(a)*ya_l(a)
       END DO
       S0(2,1) = S0(1,2)
 
-!     2nd Piola-Kirchhoff tensor (S) and material stiffness tensor in
-!     Voigt notation
-      CALL GETPK2CC(eq(cEq)%dmn(cDmn), F, nFn, fN, ya_g, S, Dm)
-
 !     Prestress
-      pSl(1) = S(1,1)
-      pSl(2) = S(2,2)
-      pSl(3) = S(1,2)
-      S = S + S0
+      pSl(1) = Sm(1,1)
+      pSl(2) = Sm(2,2)
+      pSl(3) = Sm(1,2)
+      S = Sm + S0
 
 !     1st Piola-Kirchhoff tensor (P)
       P = MATMUL(F, S)
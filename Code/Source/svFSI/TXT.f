@@ -43,10 +43,15 @@
       LOGICAL, INTENT(IN) :: flag
 
       LOGICAL ltmp, wtn(2), div, pflag
-      INTEGER(KIND=IKIND) fid, i, l, e, s, a, iOut, iEq, oGrp
+      INTEGER(KIND=IKIND) fid, i, j, l, e, s, a, c, iOut, iEq, oGrp, iM,
+     2   iFa, iDmn, nO, nF, nB, mDmn
       CHARACTER(LEN=stdL) fName(2)
 
-      REAL(KIND=RKIND), ALLOCATABLE :: tmpV(:,:)
+      LOGICAL, ALLOCATABLE :: qTH(:), qDiv(:)
+      INTEGER(KIND=IKIND), ALLOCATABLE :: qs(:), ql(:), bO(:),
+     2   fList(:,:)
+      REAL(KIND=RKIND), ALLOCATABLE :: tmpV(:,:), sF(:,:), bV(:,:),
+     2   vV(:,:), tmpR(:), tmpB(:)
 
       fid = 1
 
@@ -88,6 +93,23 @@
          END IF
       END IF ! resetSim
 
+!     The fields of all the outputs are stacked in sF, so that their
+!     boundary and volume integrals are computed together and reduced
+!     at once. qs/ql are the first row and the size of each output.
+      nO = 0
+      c  = 0
+      DO iEq=1, nEq
+         DO iOut=1, eq(iEq)%nOutput
+            IF (ALL(.NOT.eq(iEq)%output(iOut)%wtn(2:3))) CYCLE
+            nO = nO + 1
+            c  = c + eq(iEq)%output(iOut)%l
+         END DO
+      END DO
+      IF (flag) c = 0
+      ALLOCATE(sF(c,tnNo), qs(nO), ql(nO), qTH(nO), qDiv(nO))
+
+      nO = 0
+      c  = 0
       DO iEq=1, nEq
          IF (ALLOCATED(tmpV)) DEALLOCATE(tmpV)
          ALLOCATE (tmpV(maxnsd,tnNo))
@@ -95,6 +117,12 @@
 !     Don't write it when it doesn't suppose to be written
             wtn = eq(iEq)%output(iOut)%wtn(2:3)
             IF (ALL(.NOT.wtn)) CYCLE
+            nO = nO + 1
+            IF (flag) THEN
+               CALL TXTNAME(eq(iEq), iOut, fName)
+               CALL CCTXT(eq(iEq), fName, wtn)
+               CYCLE
+            END IF
             l = eq(iEq)%output(iOut)%l
             s = eq(iEq)%s + eq(iEq)%output(iOut)%o
             e = s + l - 1
@@ -133,23 +161,15 @@
             CASE DEFAULT
                err = "Undefined output"
             END SELECT
-
-            fName = eq(iEq)%sym//"_"//TRIM(eq(iEq)%output(iOut)%name)
-            IF (l .EQ. nsd) THEN
-               fName(1) = TRIM(appPath)//"B_"//TRIM(fName(1))//
-     2            "_flux.txt"
-            ELSE
-               fName(1) = TRIM(appPath)//"B_"//TRIM(fName(1))//
-     2            "_average.txt"
-            END IF
-            fName(2) = TRIM(appPath)//"V_"//TRIM(fName(2))//
-     2         "_average.txt"
-
-            IF (flag) THEN
-               CALL CCTXT(eq(iEq), fName, wtn)
-            ELSE
-               CALL WTXT(eq(iEq), l, fName, tmpV, wtn, div, pflag)
-            END IF
+            IF (wtn(1) .AND. l.NE.1 .AND. l.NE.nsd)
+     2         err = "WTXT only accepts 1 and nsd"
+
+            sF(c+1:c+l,:) = tmpV(1:l,:)
+            qs(nO)   = c + 1
+            ql(nO)   = l
+            qTH(nO)  = pflag .AND. .NOT.div
+            qDiv(nO) = div
+            c = c + l
          END DO
 
 !        IB outputs
@@ -204,9 +224,123 @@
             END IF
          END DO
       END DO
+      IF (flag .OR. nO.EQ.0) RETURN
+
+!     Boundary integrals over all the faces of the outputs that need
+!     them, and volume integrals over the domains of each equation
+      nF = 0
+      DO iM=1, nMsh
+         nF = nF + msh(iM)%nFa
+      END DO
+      ALLOCATE(fList(2,nF))
+      j = 0
+      DO iM=1, nMsh
+         DO iFa=1, msh(iM)%nFa
+            j = j + 1
+            fList(:,j) = (/iM, iFa/)
+         END DO
+      END DO
+      nB = 0
+      ALLOCATE(bO(nO))
+      bO = 0
+      i  = 0
+      DO iEq=1, nEq
+         DO iOut=1, eq(iEq)%nOutput
+            IF (ALL(.NOT.eq(iEq)%output(iOut)%wtn(2:3))) CYCLE
+            i = i + 1
+            IF (.NOT.eq(iEq)%output(iOut)%wtn(2)) CYCLE
+            nB    = nB + 1
+            bO(i) = nB
+         END DO
+      END DO
+      ALLOCATE(bV(nB,nF))
+      IF (nB .GT. 0) CALL IntegFa(nF, fList, nB, PACK(qs,bO.NE.0),
+     2   PACK(ql,bO.NE.0), PACK(qTH,bO.NE.0), sF, bV, noRed=.TRUE.)
+
+      mDmn = MAXVAL(eq%nDmn)
+      ALLOCATE(vV(mDmn,nO))
+      vV = 0._RKIND
+      i  = 0
+      DO iEq=1, nEq
+         DO iOut=1, eq(iEq)%nOutput
+            IF (ALL(.NOT.eq(iEq)%output(iOut)%wtn(2:3))) CYCLE
+            i = i + 1
+            IF (.NOT.eq(iEq)%output(iOut)%wtn(3)) CYCLE
+            l = qs(i) + ql(i) - 1
+            DO iDmn=1, eq(iEq)%nDmn
+               vV(iDmn,i) = Integ(eq(iEq)%dmn(iDmn)%Id, sF, qs(i), l,
+     2            qTH(i), noRed=.TRUE.)
+            END DO
+         END DO
+      END DO
+
+!     A single reduction for all the integrals
+      ALLOCATE(tmpR(nB*nF+mDmn*nO))
+      tmpR = (/RESHAPE(bV,(/nB*nF/)), RESHAPE(vV,(/mDmn*nO/))/)
+      tmpR = cm%reduce(tmpR)
+      bV = RESHAPE(tmpR(1:nB*nF), (/nB,nF/))
+      vV = RESHAPE(tmpR(nB*nF+1:), (/mDmn,nO/))
+
+!     Scalars are averaged over the faces/domains, unless they are
+!     the area/volume (outGrp_I); vectors are integrated as fluxes
+      ALLOCATE(tmpB(nF))
+      i = 0
+      DO iEq=1, nEq
+         DO iOut=1, eq(iEq)%nOutput
+            wtn = eq(iEq)%output(iOut)%wtn(2:3)
+            IF (ALL(.NOT.wtn)) CYCLE
+            i = i + 1
+            tmpB = 0._RKIND
+            IF (wtn(1)) tmpB = bV(bO(i),:)
+            IF (ql(i).EQ.1 .AND. qDiv(i)) THEN
+               DO j=1, nF
+                  tmpB(j) = tmpB(j)/msh(fList(1,j))%fa(fList(2,j))%area
+               END DO
+            END IF
+            IF (qDiv(i)) THEN
+               DO iDmn=1, eq(iEq)%nDmn
+                  vV(iDmn,i) = vV(iDmn,i)/eq(iEq)%dmn(iDmn)%v
+               END DO
+            END IF
+            CALL TXTNAME(eq(iEq), iOut, fName)
+            CALL WTXT(eq(iEq), fName, wtn, nF, tmpB, vV(:,i))
+         END DO
+      END DO
+
+      DEALLOCATE(fList, bO, bV, vV, tmpR, tmpB)
 
       RETURN
       END SUBROUTINE TXT
+!--------------------------------------------------------------------
+!     Names of the boundary and volume files of an output
+      SUBROUTINE TXTNAME(lEq, iOut, fName)
+      USE COMMOD
+      IMPLICIT NONE
+      TYPE(eqType), INTENT(IN) :: lEq
+      INTEGER(KIND=IKIND), INTENT(IN) :: iOut
+      CHARACTER(LEN=stdL), INTENT(OUT) :: fName(2)
+
+      INTEGER(KIND=IKIND) l
+
+      l = lEq%output(iOut)%l
+      SELECT CASE (lEq%output(iOut)%grp)
+      CASE (outGrp_WSS, outGrp_vort, outGrp_trac)
+         l = 1
+      END SELECT
+
+      fName = lEq%sym//"_"//TRIM(lEq%output(iOut)%name)
+      IF (l .EQ. nsd) THEN
+         fName(1) = TRIM(appPath)//"B_"//TRIM(fName(1))//
+     2      "_flux.txt"
+      ELSE
+         fName(1) = TRIM(appPath)//"B_"//TRIM(fName(1))//
+     2      "_average.txt"
+      END IF
+      fName(2) = TRIM(appPath)//"V_"//TRIM(fName(2))//
+     2   "_average.txt"
+
+      RETURN
+      END SUBROUTINE TXTNAME
 !####################################################################
 !     This is to check/create the txt file
       SUBROUTINE CCTXT(lEq, fName, wtn)
@@ -338,72 +472,40 @@
       RETURN
       END SUBROUTINE TRIMFILE
 !####################################################################
-!     This is to write to txt file
-      SUBROUTINE WTXT(lEq, m, fName, tmpV, wtn, div, pflag)
+!     This is to write the face (bV) and domain (vV) integrals of an
+!     output to its txt files
+      SUBROUTINE WTXT(lEq, fName, wtn, nF, bV, vV)
       USE COMMOD
       USE ALLFUN
       IMPLICIT NONE
       TYPE(eqType), INTENT(IN) :: lEq
-      LOGICAL, INTENT(IN) :: wtn(2), div, pflag
-      INTEGER(KIND=IKIND), INTENT(IN) :: m
-      REAL(KIND=RKIND), INTENT(IN) :: tmpV(maxnsd,tnNo)
+      LOGICAL, INTENT(IN) :: wtn(2)
+      INTEGER(KIND=IKIND), INTENT(IN) :: nF
+      REAL(KIND=RKIND), INTENT(IN) :: bV(nF), vV(lEq%nDmn)
       CHARACTER(LEN=stdL), INTENT(IN) :: fName(2)
 
       INTEGER(KIND=IKIND), PARAMETER :: prL = 10
 
-      LOGICAL :: lTH
-      INTEGER(KIND=IKIND) iM, iFa, fid, i, iDmn
-      REAL(KIND=RKIND) tmp
+      INTEGER(KIND=IKIND) fid, i, j
+
+      IF (cm%slv()) RETURN
 
       fid = 1
       DO i=1, 2
          IF (.NOT.wtn(i)) CYCLE
 
-         IF (cm%mas()) OPEN(fid, FILE=TRIM(fName(i)), STATUS='OLD',
-     2      POSITION='APPEND')
-
+         OPEN(fid, FILE=TRIM(fName(i)), STATUS='OLD', POSITION='APPEND')
          IF (i .EQ. 1) THEN
-            DO iM=1, nMsh
-               lTH = .FALSE.
-               IF (msh(iM)%nFs .EQ. 2) lTH = .TRUE.
-               DO iFa=1, msh(iM)%nFa
-                  IF (m .EQ. 1) THEN
-                     IF (div) THEN
-                        tmp = msh(iM)%fa(iFa)%area
-                        tmp = Integ(msh(iM)%fa(iFa),tmpV,1)/tmp
-                     ELSE
-                        IF (pFlag .AND. lTH) THEN
-                           tmp = Integ(msh(iM)%fa(iFa),tmpV,1,
-     2                        THflag=.TRUE.)
-                        ELSE
-                           tmp = Integ(msh(iM)%fa(iFa),tmpV,1)
-                        END IF
-                     END IF
-                  ELSE IF (m .EQ. nsd) THEN
-                     tmp = Integ(msh(iM)%fa(iFa),tmpV,1,m)
-                  ELSE
-                     err = "WTXT only accepts 1 and nsd"
-                  END IF
-                  IF (cm%mas())
-     2               WRITE(fid,'(A)',ADVANCE='NO') STR(tmp,prL)//" "
-               END DO
+            DO j=1, nF
+               WRITE(fid,'(A)',ADVANCE='NO') STR(bV(j),prL)//" "
             END DO
          ELSE
-            DO iDmn=1, lEq%nDmn
-               IF (div) THEN
-                  tmp = lEq%dmn(iDmn)%v
-                  tmp = Integ(lEq%dmn(iDmn)%Id, tmpV, 1, m)/tmp
-               ELSE
-                  tmp = Integ(lEq%dmn(iDmn)%Id, tmpV, 1, m, pFlag)
-               END IF
-               IF (cm%mas())
-     2            WRITE(fid,'(A)', ADVANCE='NO') STR(tmp,prL)//" "
+            DO j=1, lEq%nDmn
+               WRITE(fid,'(A)', ADVANCE='NO') STR(vV(j),prL)//" "
             END DO
          END IF
-         IF (cm%mas()) THEN
-            WRITE(fid,*)
-            CLOSE(fid)
-         END IF
+         WRITE(fid,*)
+         CLOSE(fid)
       END DO
 
       RETURN
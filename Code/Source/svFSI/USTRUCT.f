@@ -45,7 +45,7 @@
      2   Dg(tDof,tnNo)
 
       LOGICAL vmsStab
-      INTEGER(KIND=IKIND) a, e, g, Ac, eNoN, cPhys, iFn, nFn
+      INTEGER(KIND=IKIND) a, e, g, Ac, eNoN, nG, cPhys, iFn, nFn
       REAL(KIND=RKIND) w, Jac, ksix(nsd,nsd)
       TYPE(fsType) :: fs(2)
 
@@ -54,7 +54,8 @@
      2   dl(:,:), bfl(:,:), fN(:,:), ya_l(:), lR(:,:), lK(:,:,:),
      3   lKd(:,:,:)
       REAL(KIND=RKIND), ALLOCATABLE :: xwl(:,:), xql(:,:), Nwx(:,:),
-     2   Nqx(:,:)
+     2   Nqx(:,:), wg(:), Jacg(:), Nwxg(:,:,:), Fg(:,:,:), Sg(:,:,:),
+     3   Dmg(:,:,:), Jag(:)
 
       eNoN = lM%eNoN
       nFn  = lM%nFn
@@ -71,6 +72,12 @@
      2   dl(tDof,eNoN), bfl(nsd,eNoN), fN(nsd,nFn), ya_l(eNoN),
      3   lR(dof,eNoN), lK(dof*dof,eNoN,eNoN), lKd(dof*nsd,eNoN,eNoN))
 
+!     Batch arrays at the Gauss points of the velocity/displacement
+!     function space
+      nG = lM%fs(1)%nG
+      ALLOCATE(wg(nG), Jacg(nG), Nwxg(nsd,lM%fs(1)%eNoN,nG),
+     2   Fg(nsd,nsd,nG), Sg(nsd,nsd,nG), Dmg(nsymd,nsymd,nG), Jag(nG))
+
 !     Loop over all elements of mesh
       DO e=1, lM%nEl
 !        Update domain and proceed if domain phys and eqn phys match
@@ -114,23 +121,38 @@
          xwl(:,:) = xl(:,:)
          xql(:,:) = xl(:,1:fs(2)%eNoN)
 
-!        Gauss integration 1
-         DO g=1, fs(1)%nG
+!        Shape function derivatives at the Gauss points of the
+!        velocity/displacement function space
+         DO g=1, nG
             IF (g.EQ.1 .OR. .NOT.fs(1)%lShpF) THEN
                CALL GNN(fs(1)%eNoN, nsd, fs(1)%Nx(:,:,g), xwl, Nwx, Jac,
      2            ksix)
                IF (ISZERO(Jac)) err = "Jac < 0 @ element "//e
             END IF
-            w = fs(1)%w(g) * Jac
+            wg(g)   = fs(1)%w(g) * Jac
+            Jacg(g) = Jac
+            Nwxg(:,:,g) = Nwx
+         END DO
+
+!        Deformation gradient, deviatoric 2nd Piola-Kirchhoff stress and
+!        isochoric stiffness at all the Gauss points, evaluated as one
+!        batch
+         CALL GETPK2CCe(eq(cEq)%dmn(cDmn), .TRUE., fs(1)%eNoN, nG, nFn,
+     2      fs(1)%N, Nwxg, dl, fN, ya_l, Fg, Sg, Dmg, Jag)
+
+!        Gauss integration 1
+         DO g=1, nG
+            w   = wg(g)
+            Jac = Jacg(g)
 
             IF (nsd .EQ. 3) THEN
-               CALL USTRUCT3D_M(vmsStab, fs(1)%eNoN, fs(2)%eNoN, nFn, w,
-     2            Jac, fs(1)%N(:,g), fs(2)%N(:,g), Nwx, al, yl, dl, bfl,
-     3            fN, ya_l, lR, lK, lKd)
+               CALL USTRUCT3D_M(vmsStab, fs(1)%eNoN, fs(2)%eNoN, w, Jac,
+     2            fs(1)%N(:,g), fs(2)%N(:,g), Nwxg(:,:,g), al, yl, bfl,
+     3            Fg(:,:,g), Sg(:,:,g), Dmg(:,:,g), Jag(g), lR, lK, lKd)
             ELSE IF (nsd .EQ. 2) THEN
-               CALL USTRUCT2D_M(vmsStab, fs(1)%eNoN, fs(2)%eNoN, nFn, w,
-     2            Jac, fs(1)%N(:,g), fs(2)%N(:,g), Nwx, al, yl, dl, bfl,
-     3            fN, ya_l, lR, lK, lKd)
+               CALL USTRUCT2D_M(vmsStab, fs(1)%eNoN, fs(2)%eNoN, w, Jac,
+     2            fs(1)%N(:,g), fs(2)%N(:,g), Nwxg(:,:,g), al, yl, bfl,
+     3            Fg(:,:,g), Sg(:,:,g), Dmg(:,:,g), Jag(g), lR, lK, lKd)
             END IF
          END DO ! g: loop
 
@@ -173,29 +195,33 @@
       END DO ! e: loop
 
       DEALLOCATE(ptr, xl, al, yl, dl, bfl, fN, ya_l, lR, lK, lKd)
+      DEALLOCATE(wg, Jacg, Nwxg, Fg, Sg, Dmg, Jag)
 
       RETURN
       END SUBROUTINE CONSTRUCT_uSOLID
 !####################################################################
-      SUBROUTINE USTRUCT3D_M(vmsFlag, eNoNw, eNoNq, nFn, w, Je, Nw, Nq,
-     2   Nwx, al, yl, dl, bfl, fN, ya_l, lR, lK, lKd)
+!     F, Siso, Dm and Ja are the deformation gradient, deviatoric 2nd
+!     Piola-Kirchhoff stress, isochoric stiffness (Voigt notation) and
+!     active strain Jacobian at the integration point, computed in batch
+!     by GETPK2CCe
+      SUBROUTINE USTRUCT3D_M(vmsFlag, eNoNw, eNoNq, w, Je, Nw, Nq, Nwx,
+     2   al, yl, bfl, F, Siso, Dm, Ja, lR, lK, lKd)
       USE COMMOD
       USE ALLFUN
       IMPLICIT NONE
       LOGICAL, INTENT(IN) :: vmsFlag
-      INTEGER(KIND=IKIND), INTENT(IN) :: eNoNw, eNoNq, nFn
+      INTEGER(KIND=IKIND), INTENT(IN) :: eNoNw, eNoNq
       REAL(KIND=RKIND), INTENT(IN) :: w, Je, Nw(eNoNw), Nq(eNoNq),
-     2   Nwx(3,eNoNw), al(tDof,eNoNw), yl(tDof,eNoNw), dl(tDof,eNoNw),
-     3   bfl(3,eNoNw), fN(3,nFn), ya_l(eNoNw)
+     2   Nwx(3,eNoNw), al(tDof,eNoNw), yl(tDof,eNoNw), bfl(3,eNoNw),
+     3   F(3,3), Siso(3,3), Dm(6,6), Ja
       REAL(KIND=RKIND), INTENT(INOUT) :: lR(dof,eNoNw),
      2   lKd(dof*3,eNoNw,eNoNw), lK(dof*dof,eNoNw,eNoNw)
 
       INTEGER(KIND=IKIND) :: i, j, k, l, a, b
       REAL(KIND=RKIND) :: fb(3), am, af, afm, v(3), vd(3), vx(3,3), p,
-     2   pd, F(3,3), Jac, Fi(3,3), rho, beta, drho, dbeta, ya_g, Ja,
-     3   Siso(3,3), Dm(6,6), tauM, tauC, rC, rCl, Pdev(3,3), DBm(6,3),
-     4   Bm(6,3,eNoNw), NxFi(3,eNoNw), VxFi(3,3), VxNx(3,eNoNw), BtDB,
-     5   NxSNx, T1, T2, T3, Ku
+     2   pd, Jac, Fi(3,3), rho, beta, drho, dbeta, tauM, tauC, rC, rCl,
+     3   Pdev(3,3), DBm(6,3), Bm(6,3,eNoNw), NxFi(3,eNoNw), VxFi(3,3),
+     4   VxNx(3,eNoNw), BtDB, NxSNx, T1, T2, T3, Ku
 
 !     Define parameters
       fb(1)   = eq(cEq)%dmn(cDmn)%prop(f_x)
@@ -211,16 +237,11 @@
       k       = j + 1
       l       = k + 1
 
-!     Inertia (velocity and acceleration), body force, fiber directions,
-!     and deformation tensor (F) at integration point
+!     Inertia (velocity and acceleration) and body force at integration
+!     point
       v  = 0._RKIND
       vd = -fb
       vx = 0._RKIND
-      F  = 0._RKIND
-      F(1,1) = 1._RKIND
-      F(2,2) = 1._RKIND
-      F(3,3) = 1._RKIND
-      ya_g   = 0._RKIND
       DO a=1, eNoNw
          v(1)    = v(1)  + Nw(a)*yl(i,a)
          v(2)    = v(2)  + Nw(a)*yl(j,a)
@@ -239,18 +260,6 @@
          vx(3,1) = vx(3,1) + Nwx(1,a)*yl(k,a)
          vx(3,2) = vx(3,2) + Nwx(2,a)*yl(k,a)
          vx(3,3) = vx(3,3) + Nwx(3,a)*yl(k,a)
-
-         F(1,1)  = F(1,1) + Nwx(1,a)*dl(i,a)
-         F(1,2)  = F(1,2) + Nwx(2,a)*dl(i,a)
-         F(1,3)  = F(1,3) + Nwx(3,a)*dl(i,a)
-         F(2,1)  = F(2,1) + Nwx(1,a)*dl(j,a)
-         F(2,2)  = F(2,2) + Nwx(2,a)*dl(j,a)
-         F(2,3)  = F(2,3) + Nwx(3,a)*dl(j,a)
-         F(3,1)  = F(3,1) + Nwx(1,a)*dl(k,a)
-         F(3,2)  = F(3,2) + Nwx(2,a)*dl(k,a)
-         F(3,3)  = F(3,3) + Nwx(3,a)*dl(k,a)
-
-         ya_g    = ya_g + Nw(a)*ya_l(a)
       END DO
       Jac = MAT_DET(F, 3)
       Fi  = MAT_INV(F, 3)
@@ -263,10 +272,6 @@
          pd = pd + Nq(a)*al(l,a)
       END DO
 
-!     Compute deviatoric 2nd Piola-Kirchhoff stress tensor (Siso) and
-!     isochoric elasticity tensor in Voigt notation (Dm)
-      CALL GETPK2CCdev(eq(cEq)%dmn(cDmn), F, nFn, fN, ya_g, Siso, Dm,Ja)
-
 !     Compute rho and beta depending on the volumetric penalty model
       CALL GVOLPEN(eq(cEq)%dmn(cDmn), p, rho, beta, drho, dbeta, Ja)
 
@@ -510,25 +515,28 @@
       RETURN
       END SUBROUTINE USTRUCT3D_M
 !--------------------------------------------------------------------
-      SUBROUTINE USTRUCT2D_M(vmsFlag, eNoNw, eNoNq, nFn, w, Je, Nw, Nq,
-     2   Nwx, al, yl, dl, bfl, fN, ya_l, lR, lK, lKd)
+!     F, Siso, Dm and Ja are the deformation gradient, deviatoric 2nd
+!     Piola-Kirchhoff stress, isochoric stiffness (Voigt notation) and
+!     active strain Jacobian at the integration point, computed in batch
+!     by GETPK2CCe
+      SUBROUTINE USTRUCT2D_M(vmsFlag, eNoNw, eNoNq, w, Je, Nw, Nq, Nwx,
+     2   al, yl, bfl, F, Siso, Dm, Ja, lR, lK, lKd)
       USE COMMOD
       USE ALLFUN
       IMPLICIT NONE
       LOGICAL, INTENT(IN) :: vmsFlag
-      INTEGER(KIND=IKIND), INTENT(IN) :: eNoNw, eNoNq, nFn
+      INTEGER(KIND=IKIND), INTENT(IN) :: eNoNw, eNoNq
       REAL(KIND=RKIND), INTENT(IN) :: w, Je, Nw(eNoNw), Nq(eNoNq),
-     2   Nwx(2,eNoNw), al(tDof,eNoNw), yl(tDof,eNoNw), dl(tDof,eNoNw),
-     3   bfl(2,eNoNw), fN(2,nFn), ya_l(eNoNw)
+     2   Nwx(2,eNoNw), al(tDof,eNoNw), yl(tDof,eNoNw), bfl(2,eNoNw),
+     3   F(2,2), Siso(2,2), Dm(3,3), Ja
       REAL(KIND=RKIND), INTENT(INOUT) :: lR(dof,eNoNw),
      2   lKd(dof*2,eNoNw,eNoNw), lK(dof*dof,eNoNw,eNoNw)
 
       INTEGER(KIND=IKIND) :: i, j, k, a, b
       REAL(KIND=RKIND) :: fb(2), am, af, afm, v(2), vd(2), vx(2,2), p,
-     2   pd, F(2,2), Jac, Fi(2,2), rho, beta, drho, dbeta, ya_g, Ja,
-     3   Siso(2,2), Dm(3,3), tauM, tauC, rC, rCl, Pdev(2,2), DBm(3,2),
-     4   Bm(3,2,eNoNw), NxFi(2,eNoNw), VxFi(2,2), VxNx(2,eNoNw), BtDB,
-     5   NxSNx, T1, T2, T3, Ku
+     2   pd, Jac, Fi(2,2), rho, beta, drho, dbeta, tauM, tauC, rC, rCl,
+     3   Pdev(2,2), DBm(3,2), Bm(3,2,eNoNw), NxFi(2,eNoNw), VxFi(2,2),
+     4   VxNx(2,eNoNw), BtDB, NxSNx, T1, T2, T3, Ku
 
 !     Define parameters
       fb(1)   = eq(cEq)%dmn(cDmn)%prop(f_x)
@@ -542,15 +550,11 @@
       j       = i + 1
       k       = j + 1
 
-!     Inertia (velocity and acceleration), body force, fiber directions,
-!     and deformation tensor (F) at integration point
+!     Inertia (velocity and acceleration) and body force at integration
+!     point
       v  = 0._RKIND
       vd = -fb
       vx = 0._RKIND
-      F  = 0._RKIND
-      F(1,1) = 1._RKIND
-      F(2,2) = 1._RKIND
-      ya_g   = 0._RKIND
       DO a=1, eNoNw
          v(1)    = v(1)  + Nw(a)*yl(i,a)
          v(2)    = v(2)  + Nw(a)*yl(j,a)
@@ -562,13 +566,6 @@
          vx(1,2) = vx(1,2) + Nwx(2,a)*yl(i,a)
          vx(2,1) = vx(2,1) + Nwx(1,a)*yl(j,a)
          vx(2,2) = vx(2,2) + Nwx(2,a)*yl(j,a)
-
-         F(1,1)  = F(1,1) + Nwx(1,a)*dl(i,a)
-         F(1,2)  = F(1,2) + Nwx(2,a)*dl(i,a)
-         F(2,1)  = F(2,1) + Nwx(1,a)*dl(j,a)
-         F(2,2)  = F(2,2) + Nwx(2,a)*dl(j,a)
-
-         ya_g    = ya_g + Nw(a)*ya_l(a)
       END DO
       Jac = MAT_DET(F, 2)
       Fi  = MAT_INV(F, 2)
@@ -581,10 +578,6 @@
          pd = pd + Nq(a)*al(k,a)
       END DO
 
-!     Compute deviatoric 2nd Piola-Kirchhoff stress tensor (Siso) and
-!     isochoric elasticity tensor in Voigt notation (Dm)
-      CALL GETPK2CCdev(eq(cEq)%dmn(cDmn), F, nFn, fN, ya_g, Siso, Dm,Ja)
-
 !     Compute rho and beta depending on the volumetric penalty model
       CALL GVOLPEN(eq(cEq)%dmn(cDmn), p, rho, beta, drho, dbeta, Ja)
 
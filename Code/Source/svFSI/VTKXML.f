@@ -419,7 +419,7 @@
       LOGICAL :: lIbl, lD0
       INTEGER(KIND=IKIND) :: iStat, iEq, iOut, iM, a, e, Ac, Ec, nNo,
      2   nEl, s, l, ie, is, nSh, oGrp, outDof, nOut, cOut, ne, iFn, nFn,
-     3   nOute
+     3   nOute, iX
       CHARACTER(LEN=stdL) :: fName
       TYPE(dataType) :: d(nMsh)
       TYPE(vtkXMLType) :: vtu
@@ -478,6 +478,12 @@
          outDof = outDof + nsd
       END IF
 
+!     Extra fields (e.g. variance) written with the averaged results
+      IF (lAve .AND. ave%nX.GT.0) THEN
+         nOut   = nOut + ave%nX
+         outDof = outDof + ave%xS(ave%nX+1) - 1
+      END IF
+
       ALLOCATE(outNames(nOut), outS(nOut+1), outNamesE(nOute))
 
 !     Prepare all solultions in to dataType d
@@ -547,18 +553,15 @@
                      d(iM)%x(is:ie,a) = lD(s:e,Ac)/msh(iM)%scF
                   END DO
 
-               CASE (outGrp_WSS, outGrp_trac)
-                  CALL BPOST(msh(iM), tmpV, lY, lD, oGrp)
-                  DO a=1, msh(iM)%nNo
-                     d(iM)%x(is:ie,a) = tmpV(1:l,a)
-                  END DO
-
-               CASE (outGrp_vort, outGrp_eFlx, outGrp_hFlx,
-     2            outGrp_stInv, outGrp_vortex, outGrp_Visc)
-                  CALL POST(msh(iM), tmpV, lY, lD, oGrp, iEq)
+               CASE (outGrp_WSS, outGrp_trac, outGrp_vort, outGrp_eFlx,
+     2            outGrp_hFlx, outGrp_stInv, outGrp_vortex, outGrp_Visc)
+                  ALLOCATE(tmpVe(msh(iM)%nEl))
+                  CALL PSTFLD(iM, maxnsd, tmpV, tmpVe, lY, lD, oGrp,
+     2               iEq)
                   DO a=1, msh(iM)%nNo
                      d(iM)%x(is:ie,a) = tmpV(1:l,a)
                   END DO
+                  DEALLOCATE(tmpVe)
 
                CASE (outGrp_absV)
                   DO a=1, msh(iM)%nNo
@@ -606,15 +609,14 @@
                   ALLOCATE(tmpV(l,msh(iM)%nNo), tmpVe(msh(iM)%nEl))
                   tmpV  = 0._RKIND
                   tmpVe = 0._RKIND
+                  IF (.NOT.cmmInit) CALL PSTFLD(iM, l, tmpV, tmpVe,
+     2               lY, lD, oGrp, iEq)
                   IF (pstEq) THEN
                      DO a=1, msh(iM)%nNo
                         Ac = msh(iM)%gN(a)
-                        tmpV(:,a) = pS0(:,Ac)
+                        tmpV(:,a) = pS0(:,Ac) + tmpV(:,a)
                      END DO
                   END IF
-
-                  IF (.NOT.cmmInit) CALL TPOST(msh(iM), l, tmpV, tmpVe,
-     2               lD, lY, iEq, oGrp)
                   DO a=1, msh(iM)%nNo
                      d(iM)%x(is:ie,a) = tmpV(1:l,a)
                   END DO
@@ -636,7 +638,7 @@
                   tmpV  = 0._RKIND
                   tmpVe = 0._RKIND
 
-                  CALL TPOST(msh(iM), l, tmpV, tmpVe, lD, lY, iEq, oGrp)
+                  CALL PSTFLD(iM, l, tmpV, tmpVe, lY, lD, oGrp, iEq)
                   DO a=1, msh(iM)%nNo
                      d(iM)%x(is:ie,a) = tmpV(1:l,a)
                   END DO
@@ -654,13 +656,12 @@
 
                CASE (outGrp_divV)
                   IF (ALLOCATED(tmpV)) DEALLOCATE(tmpV)
-                  ALLOCATE(tmpV(1,msh(iM)%nNo))
-                  tmpV = 0._RKIND
-                  CALL DIVPOST(msh(iM), tmpV, lY, lD, iEq)
+                  ALLOCATE(tmpV(1,msh(iM)%nNo), tmpVe(msh(iM)%nEl))
+                  CALL PSTFLD(iM, 1, tmpV, tmpVe, lY, lD, oGrp, iEq)
                   DO a=1, msh(iM)%nNo
                      d(iM)%x(is,a) = tmpV(1,a)
                   END DO
-                  DEALLOCATE(tmpV)
+                  DEALLOCATE(tmpV, tmpVe)
                   ALLOCATE(tmpV(maxnsd,msh(iM)%nNo))
                CASE DEFAULT
                   err = "Undefined output"
@@ -679,6 +680,20 @@
                d(iM)%x(is:ie,a) = REAL(iblank(Ac), KIND=RKIND)
             END DO
          END IF
+
+         IF (lAve .AND. ave%nX.GT.0) THEN
+            DO iX=1, ave%nX
+               cOut = cOut + 1
+               is   = outS(cOut)
+               ie   = is + ave%xS(iX+1) - ave%xS(iX) - 1
+               outS(cOut+1)   = ie + 1
+               outNames(cOut) = ave%xName(iX)
+               DO a=1, msh(iM)%nNo
+                  Ac = msh(iM)%gN(a)
+                  d(iM)%x(is:ie,a) = ave%x(ave%xS(iX):ave%xS(iX+1)-1,Ac)
+               END DO
+            END DO
+         END IF
       END DO
 
 !     Integrate data from all processors
@@ -1252,6 +1267,12 @@
       REAL(KIND=RKIND), ALLOCATABLE :: tmpA(:,:), tmpY(:,:), tmpD(:,:),
      2   Ag(:,:), Yg(:,:), Dg(:,:)
 
+!     Statistics accumulated during the time loop need no re-reading
+      IF (ave%strm) THEN
+         CALL AVEWRITE()
+         RETURN
+      END IF
+
       fid  = 1
       fTS  = nTS
       lTS  = 0
@@ -1308,3 +1329,222 @@
       RETURN
       END SUBROUTINE CALCAVE
 !####################################################################
+!     Sets up the averages that are accumulated in memory during the
+!     time loop. When a continued simulation also averages over earlier
+!     runs, or the mesh changes with remeshing, CALCAVE falls back to
+!     reading the saved vtu files.
+      SUBROUTINE AVEINIT(lA, lY, lD)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      REAL(KIND=RKIND), INTENT(IN) :: lA(tDof,tnNo), lY(tDof,tnNo),
+     2   lD(tDof,tnNo)
+
+      INTEGER(KIND=IKIND) :: iEq, iOut
+
+      ave%strm = .NOT.rmsh%isReqd .AND. (zeroAve .OR. .NOT.stFileFlag)
+      IF (.NOT.ave%strm) THEN
+         IF (ave%nPh .GT. 0) wrn = " Phase averaging is skipped when"//
+     2      " averaging over previous runs"
+         RETURN
+      END IF
+
+      ave%n   = 0
+      ave%fTS = nTS
+      ave%lTS = 0
+      ALLOCATE(ave%A(tDof,tnNo), ave%Y(tDof,tnNo), ave%D(tDof,tnNo),
+     2   ave%Ym(tDof,tnNo), ave%Ys(tDof,tnNo))
+      ave%A  = 0._RKIND
+      ave%Y  = 0._RKIND
+      ave%D  = 0._RKIND
+      ave%Ym = 0._RKIND
+      ave%Ys = 0._RKIND
+
+!     Hemodynamic indices are computed if WSS is an output
+      ave%iEqW = 0
+      DO iEq=1, nEq
+         DO iOut=1, eq(iEq)%nOutput
+            IF (eq(iEq)%output(iOut)%grp .EQ. outGrp_WSS) THEN
+               ave%iEqW = iEq
+               EXIT
+            END IF
+         END DO
+         IF (ave%iEqW .NE. 0) EXIT
+      END DO
+      IF (ave%iEqW .NE. 0) THEN
+         ALLOCATE(ave%wV(nsd,tnNo), ave%wM(tnNo))
+         ave%wV = 0._RKIND
+         ave%wM = 0._RKIND
+      END IF
+
+      IF (ave%nPh .GT. 0) THEN
+         ALLOCATE(ave%nP(ave%nPh), ave%pA(tDof,tnNo,ave%nPh),
+     2      ave%pY(tDof,tnNo,ave%nPh), ave%pD(tDof,tnNo,ave%nPh))
+         ave%nP = 0
+         ave%pA = 0._RKIND
+         ave%pY = 0._RKIND
+         ave%pD = 0._RKIND
+      END IF
+
+!     The time step averaging starts from is included as in CALCAVE
+      IF (zeroAve .AND. rsTS.GE.saveATS) CALL AVESTEP(lA, lY, lD)
+
+      RETURN
+      END SUBROUTINE AVEINIT
+!--------------------------------------------------------------------
+!     Adds the solution of the current time step to the running time
+!     and phase averages
+      SUBROUTINE AVESTEP(lA, lY, lD)
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+      REAL(KIND=RKIND), INTENT(IN) :: lA(tDof,tnNo), lY(tDof,tnNo),
+     2   lD(tDof,tnNo)
+
+      INTEGER(KIND=IKIND) :: a, iPh
+      REAL(KIND=RKIND) :: rn, dY(tDof)
+
+      REAL(KIND=RKIND), ALLOCATABLE :: tmpV(:,:)
+
+      ave%n   = ave%n + 1
+      ave%fTS = MIN(ave%fTS, cTS)
+      ave%lTS = MAX(ave%lTS, cTS)
+      ave%A   = ave%A + lA
+      ave%Y   = ave%Y + lY
+      ave%D   = ave%D + lD
+
+!     Welford update of the mean and squared deviations of Y
+      rn = 1._RKIND/REAL(ave%n, KIND=RKIND)
+      DO a=1, tnNo
+         dY(:)        = lY(:,a) - ave%Ym(:,a)
+         ave%Ym(:,a)  = ave%Ym(:,a) + rn*dY(:)
+         ave%Ys(:,a)  = ave%Ys(:,a) + dY(:)*(lY(:,a) - ave%Ym(:,a))
+      END DO
+
+      IF (ave%iEqW .NE. 0) THEN
+         ALLOCATE(tmpV(maxnsd,tnNo))
+         CALL ALLPOST(tmpV, lY, lD, outGrp_WSS, ave%iEqW)
+         DO a=1, tnNo
+            ave%wV(:,a) = ave%wV(:,a) + tmpV(1:nsd,a)
+            ave%wM(a)   = ave%wM(a)   + SQRT(NORM(tmpV(1:nsd,a)))
+         END DO
+         DEALLOCATE(tmpV)
+      END IF
+
+      IF (ave%nPh .GT. 0) THEN
+         iPh = MOD(cTS, ave%nCyc)*ave%nPh/ave%nCyc + 1
+         ave%nP(iPh)     = ave%nP(iPh) + 1
+         ave%pA(:,:,iPh) = ave%pA(:,:,iPh) + lA
+         ave%pY(:,:,iPh) = ave%pY(:,:,iPh) + lY
+         ave%pD(:,:,iPh) = ave%pD(:,:,iPh) + lD
+      END IF
+
+      RETURN
+      END SUBROUTINE AVESTEP
+!--------------------------------------------------------------------
+!     Writes the time averaged results, along with the variance of the
+!     unknowns and TAWSS, OSI and RRT, and the phase averaged results
+      SUBROUTINE AVEWRITE()
+      USE COMMOD
+      USE ALLFUN
+      IMPLICIT NONE
+
+      INTEGER(KIND=IKIND) :: a, i, s, e, l, iEq, iOut, iPh, lTS
+      REAL(KIND=RKIND) :: cntr, wa, wm
+      CHARACTER(LEN=stdL) fName
+
+      REAL(KIND=RKIND), ALLOCATABLE :: Ag(:,:), Yg(:,:), Dg(:,:)
+
+      IF (ave%n .EQ. 0) RETURN
+      std = " Writing average quantities"
+
+      ALLOCATE(Ag(tDof,tnNo), Yg(tDof,tnNo), Dg(tDof,tnNo))
+      cntr = REAL(ave%n, KIND=RKIND)
+      Ag   = ave%A/cntr
+      Yg   = ave%Y/cntr
+      Dg   = ave%D/cntr
+
+!     Variance of every output taken directly from Y
+      ave%nX = 0
+      l      = 0
+      DO iEq=1, nEq
+         DO iOut=1, eq(iEq)%nOutput
+            IF (.NOT.eq(iEq)%output(iOut)%wtn(1)) CYCLE
+            IF (eq(iEq)%output(iOut)%grp .NE. outGrp_Y) CYCLE
+            ave%nX = ave%nX + 1
+            l      = l + eq(iEq)%output(iOut)%l
+         END DO
+      END DO
+      IF (ave%iEqW .NE. 0) THEN
+         ave%nX = ave%nX + 3
+         l      = l + 3
+      END IF
+      ALLOCATE(ave%xS(ave%nX+1), ave%xName(ave%nX), ave%x(l,tnNo))
+
+      i = 0
+      ave%xS(1) = 1
+      DO iEq=1, nEq
+         DO iOut=1, eq(iEq)%nOutput
+            IF (.NOT.eq(iEq)%output(iOut)%wtn(1)) CYCLE
+            IF (eq(iEq)%output(iOut)%grp .NE. outGrp_Y) CYCLE
+            i = i + 1
+            l = eq(iEq)%output(iOut)%l
+            s = eq(iEq)%s + eq(iEq)%output(iOut)%o
+            e = s + l - 1
+            ave%xS(i+1)   = ave%xS(i) + l
+            ave%xName(i)  = TRIM(eq(iEq)%output(iOut)%name)//"_variance"
+            ave%x(ave%xS(i):ave%xS(i+1)-1,:) = ave%Ys(s:e,:)/cntr
+         END DO
+      END DO
+
+!     Time averaged WSS magnitude, oscillatory shear index and relative
+!     residence time
+      IF (ave%iEqW .NE. 0) THEN
+         ave%xName(i+1) = "TAWSS"
+         ave%xName(i+2) = "OSI"
+         ave%xName(i+3) = "RRT"
+         s = ave%xS(i+1)
+         DO a=1, tnNo
+            wa = SQRT(NORM(ave%wV(:,a)))/cntr
+            wm = ave%wM(a)/cntr
+            ave%x(s,a)   = wm
+            ave%x(s+1,a) = 0._RKIND
+            ave%x(s+2,a) = 0._RKIND
+            IF (.NOT.ISZERO(wm)) ave%x(s+1,a) = 0.5_RKIND*(1._RKIND -
+     2         wa/wm)
+            IF (.NOT.ISZERO(wa)) ave%x(s+2,a) = 1._RKIND/wa
+         END DO
+         ave%xS(i+2) = s + 1
+         ave%xS(i+3) = s + 2
+         ave%xS(i+4) = s + 3
+      END IF
+
+      lTS   = cTS
+      fName = saveName
+      cTS   = ave%lTS
+      saveName = TRIM(saveName)//"_ave_"//STR(ave%fTS)//"_"//
+     2   STR(saveIncr)
+      CALL WRITEVTUS(Ag, Yg, Dg, .TRUE.)
+      saveName = fName
+      DEALLOCATE(ave%xS, ave%xName, ave%x)
+      ave%nX = 0
+
+!     Phase averaged results, one file per phase bin
+      DO iPh=1, ave%nPh
+         IF (ave%nP(iPh) .EQ. 0) CYCLE
+         cntr = REAL(ave%nP(iPh), KIND=RKIND)
+         Ag   = ave%pA(:,:,iPh)/cntr
+         Yg   = ave%pY(:,:,iPh)/cntr
+         Dg   = ave%pD(:,:,iPh)/cntr
+         cTS  = iPh
+         saveName = TRIM(saveName)//"_phase"
+         CALL WRITEVTUS(Ag, Yg, Dg, .TRUE.)
+         saveName = fName
+      END DO
+      cTS = lTS
+
+      DEALLOCATE(Ag, Yg, Dg)
+
+      RETURN
+      END SUBROUTINE AVEWRITE
+!####################################################################
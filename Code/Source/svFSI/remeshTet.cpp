@@ -38,6 +38,15 @@
     #include <iostream>
     #include <stdio.h>
     #include <stdlib.h>
+    #include <atomic>
+    #include <condition_variable>
+    #include <list>
+    #include <map>
+    #include <memory>
+    #include <mutex>
+    #include <string>
+    #include <thread>
+    #include <vector>
 
     class tetOptions {
       public:
@@ -58,78 +67,271 @@
       optimScheme = 7;
    }
 
-   extern"C"
+   // TetGen keeps some global state, hence only one call at a time
+   static std::mutex tetMtx;
+
+   // Meshes the closed surface (pointList, facetList) and saves the
+   // result to fname.node/fname.ele. Returns -1 on failure.
+   static int tetRemesh(int nPoints, int nFacets, const double* pointList, \
+                        const int* facetList, const double* params,         \
+                        const char* fname, bool quiet)
    {
-      void remesh3d_tetgen_(const int* nPoints, const int* nFacets, const double* pointList, \
-                       const int* facetList, const double* params, int* pOK)
-      {
-         tetgenio in, out;
-         tetgenio::facet *f;
-         tetgenio::polygon *p;
-         char fname [250];
-         char switches [250];
-         tetOptions options;
+      tetgenio in, out;
+      tetgenio::facet *f;
+      tetgenio::polygon *p;
+      char switches [250];
+      tetOptions options;
 
-         *pOK = 0;
-         in.firstnumber = 1;
-         in.numberofpoints = *nPoints;
-         in.pointlist = new REAL [in.numberofpoints * 3];
-         for (int i=0; i < in.numberofpoints; i++)
-         {
-            for (int j=0; j < 3; j++) {
-               in.pointlist[3*i+j] = *pointList;
-               ++pointList;
-            }
+      in.firstnumber = 1;
+      in.numberofpoints = nPoints;
+      in.pointlist = new REAL [in.numberofpoints * 3];
+      for (int i=0; i < in.numberofpoints; i++)
+      {
+         for (int j=0; j < 3; j++) {
+            in.pointlist[3*i+j] = *pointList;
+            ++pointList;
          }
+      }
 
-         in.numberoffacets = *nFacets;
-         in.facetlist = new tetgenio::facet[in.numberoffacets];
-         in.facetmarkerlist = new int[in.numberoffacets];
+      in.numberoffacets = nFacets;
+      in.facetlist = new tetgenio::facet[in.numberoffacets];
+      in.facetmarkerlist = new int[in.numberoffacets];
 
-         for (int i=0; i < in.numberoffacets; i++)
+      for (int i=0; i < in.numberoffacets; i++)
+      {
+         f = &in.facetlist[i];
+         f->numberofpolygons = 1;
+         f->polygonlist = new tetgenio::polygon[f->numberofpolygons];
+         f->numberofholes = 0;
+         f->holelist = NULL;
+         p = &f->polygonlist[0];
+         p->numberofvertices = 3;
+         p->vertexlist = new int [p->numberofvertices];
+         for (int j=0; j < 3; j++)
          {
-            f = &in.facetlist[i];
-            f->numberofpolygons = 1;
-            f->polygonlist = new tetgenio::polygon[f->numberofpolygons];
-            f->numberofholes = 0;
-            f->holelist = NULL;
-            p = &f->polygonlist[0];
-            p->numberofvertices = 3;
-            p->vertexlist = new int [p->numberofvertices];
-            for (int j=0; j < 3; j++)
-            {
-               p->vertexlist[j] = *facetList;
-               ++facetList;
-            }
-            in.facetmarkerlist[i] = 0;
+            p->vertexlist[j] = *facetList;
+            ++facetList;
          }
+         in.facetmarkerlist[i] = 0;
+      }
 
-         options.maxRadRatio = *params;
-         options.minDihedAng = *(++params);
-         options.maxEdgeSize = *(++params);
+      options.maxRadRatio = params[0];
+      options.minDihedAng = params[1];
+      options.maxEdgeSize = params[2];
 
+      if (!quiet) {
          std::cout << " Using parameter <maxRadRatio> " << options.maxRadRatio << "\n";
          std::cout << " Using parameter <minDihedAng> " << options.minDihedAng << "\n";
          std::cout << " Using parameter <maxEdgeSize> " << options.maxEdgeSize << "\n\n";
+      }
+
+      int len;
+      len = sprintf(switches,"pYq%.2f/%.1fa%8.3eO%d/%d%s",    \
+            options.maxRadRatio, options.minDihedAng,   \
+            options.maxTetVol(options.maxEdgeSize),      \
+            options.optimLevel,   options.optimScheme,   \
+            quiet ? "Q" : "");
+
+      if ( len > 250 )
+      {
+         std::cout << "    ERROR: Length of switch exceeded limit (250 char)\n";
+         return -1;
+      }
+      tetrahedralize(switches, &in, &out);
 
-         int len;
-         len = sprintf(switches,"pYq%.2f/%.1fa%8.3eO%d/%d",    \
-               options.maxRadRatio, options.minDihedAng,   \
-               options.maxTetVol(options.maxEdgeSize),      \
-               options.optimLevel,   options.optimScheme);
+      char name [250];
+      strcpy(name, fname);
+      out.save_nodes(name);
+      out.save_elements(name);
 
-         if ( len > 250 )
+      return 0;
+   }
+
+   // Runs tetRemesh holding tetMtx. A TetGen failure (thrown from
+   // terminatetetgen with TETLIBRARY) is returned as -1 instead of
+   // unwinding through the caller. If cancel is set once the lock is
+   // acquired, nothing is done.
+   static int tetRemeshSafe(int nPoints, int nFacets, const double* pointList, \
+                            const int* facetList, const double* params,         \
+                            const char* fname, bool quiet,                      \
+                            const std::atomic<bool>* cancel = NULL)
+   {
+      std::lock_guard<std::mutex> lock(tetMtx);
+      if (cancel != NULL && cancel->load()) return -1;
+      try {
+         return tetRemesh(nPoints, nFacets, pointList, facetList, params, \
+                          fname, quiet);
+      } catch (...) {
+         std::cout << "    ERROR: TetGen failed to remesh <" << fname << ">\n";
+         return -1;
+      }
+   }
+
+   // A remesh started ahead of time on a separate thread, so that the
+   // solver can keep marching while TetGen runs. The job is tagged
+   // with the time step of the data it was started from. A job that is
+   // no longer needed is abandoned rather than waited for: it is
+   // skipped if TetGen has not started on it yet, otherwise its thread
+   // removes the output once TetGen returns. The thread is joined later,
+   // by tetReap or by remesh3d_tetgen_drain_.
+   class tetJob {
+      public:
+         int tag;
+         int iOK;
+         bool done;
+         std::atomic<bool> abandoned;
+         std::string fname;
+         std::mutex mtx;
+         std::condition_variable cv;
+         std::thread thr;
+         tetJob() : tag(0), iOK(0), done(false), abandoned(false) {}
+         void wait() {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this]{return done;});
+         }
+         void remove() {
+            std::remove((fname+".node").c_str());
+            std::remove((fname+".ele").c_str());
+         }
+         void finish(int ok) {
+            std::lock_guard<std::mutex> lock(mtx);
+            iOK  = ok;
+            done = true;
+            if (abandoned) remove();
+            cv.notify_all();
+         }
+         void abandon() {
+            std::lock_guard<std::mutex> lock(mtx);
+            abandoned = true;
+            if (done) remove();
+         }
+   };
+
+   // At most one job per mesh
+   static std::map<int, std::shared_ptr<tetJob> > tetJobs;
+
+   // Every job whose thread has not been joined, including abandoned ones
+   static std::list<std::shared_ptr<tetJob> > tetThreads;
+
+   // Joins the threads of the jobs that are done
+   static void tetReap()
+   {
+      std::list<std::shared_ptr<tetJob> >::iterator it = tetThreads.begin();
+      while (it != tetThreads.end()) {
+         bool done;
          {
-            std::cout << "    ERROR: Length of switch exceeded limit (250 char)\n";
-            *pOK = -1;
-            return;
+            std::lock_guard<std::mutex> lock((*it)->mtx);
+            done = (*it)->done;
          }
-         tetrahedralize(switches, &in, &out);
+         if (done) {
+            (*it)->thr.join();
+            it = tetThreads.erase(it);
+         } else {
+            ++it;
+         }
+      }
+   }
+
+   // Abandons all jobs and joins their threads. Jobs TetGen has not
+   // started on are skipped; the running one is waited for. All their
+   // output is deleted.
+   static void tetDrain()
+   {
+      tetJobs.clear();
+      std::list<std::shared_ptr<tetJob> >::iterator it;
+      for (it = tetThreads.begin(); it != tetThreads.end(); ++it) {
+         (*it)->abandon();
+      }
+      for (it = tetThreads.begin(); it != tetThreads.end(); ++it) {
+         (*it)->thr.join();
+         (*it)->remove();
+      }
+      tetThreads.clear();
+   }
+
+   // Drains the jobs left at exit, e.g. after a fatal error, before the
+   // statics they use are destroyed
+   static struct tetDrainAtExit {
+      ~tetDrainAtExit() { tetDrain(); }
+   } tetAtExit;
 
-         strcpy(fname, "new-vol-mesh");
-         out.save_nodes(fname);
-         out.save_elements(fname);
+   extern"C"
+   {
+      void remesh3d_tetgen_(const int* nPoints, const int* nFacets, const double* pointList, \
+                       const int* facetList, const double* params, int* pOK)
+      {
+         *pOK = tetRemeshSafe(*nPoints, *nFacets, pointList, facetList, \
+                              params, "new-vol-mesh", false);
+         return;
+      }
 
+      // Starts remeshing mesh iM from time step tag on a separate
+      // thread. A previous job of this mesh is abandoned, even if it is
+      // still running. The inputs are copied.
+      void remesh3d_tetgen_start_(const int* iM, const int* tag, const int* nPoints, \
+                       const int* nFacets, const double* pointList,  \
+                       const int* facetList, const double* params)
+      {
+         std::map<int, std::shared_ptr<tetJob> >::iterator it = tetJobs.find(*iM);
+         if (it != tetJobs.end()) {
+            it->second->abandon();
+            tetJobs.erase(it);
+         }
+
+         std::shared_ptr<tetJob> job(new tetJob());
+         job->tag   = *tag;
+         job->fname = "new-vol-mesh-" + std::to_string(*iM) + "-" + \
+                      std::to_string(*tag);
+         tetJobs[*iM] = job;
+
+         int nP = *nPoints, nF = *nFacets;
+         std::vector<double> x(pointList, pointList + 3*nP);
+         std::vector<int> ien(facetList, facetList + 3*nF);
+         std::vector<double> prm(params, params + 3);
+
+         tetReap();
+         job->thr = std::thread([job, nP, nF, x, ien, prm]() {
+            job->finish(tetRemeshSafe(nP, nF, x.data(), ien.data(), \
+                                      prm.data(), job->fname.c_str(), true, \
+                                      &job->abandoned));
+         });
+         tetThreads.push_back(job);
+         return;
+      }
+
+      // If the job of mesh iM was started from time step tag, waits for
+      // it and, when it succeeded, moves its output to new-vol-mesh.node
+      // /ele and sets pOK to 1. Otherwise pOK is 0 and the job is
+      // dropped; a stale job is abandoned without waiting for it.
+      void remesh3d_tetgen_wait_(const int* iM, const int* tag, int* pOK)
+      {
+         *pOK = 0;
+         std::map<int, std::shared_ptr<tetJob> >::iterator it = tetJobs.find(*iM);
+         if (it == tetJobs.end()) return;
+
+         std::shared_ptr<tetJob> job = it->second;
+         tetJobs.erase(it);
+         if (job->tag != *tag) {
+            job->abandon();
+            return;
+         }
+         job->wait();
+         if (job->iOK == 0) {
+            if (std::rename((job->fname+".node").c_str(), "new-vol-mesh.node") == 0 && \
+                std::rename((job->fname+".ele").c_str(), "new-vol-mesh.ele") == 0) {
+               *pOK = 1;
+               return;
+            }
+         }
+         job->remove();
+         return;
+      }
+
+      // Abandons all jobs and joins their threads, so that none is left
+      // running at exit. See tetDrain.
+      void remesh3d_tetgen_drain_()
+      {
+         tetDrain();
          return;
       }
    }
@@ -42,6 +42,9 @@
       logical, parameter :: debug = .false.
       character(len=64), parameter :: b64List = &
       "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+      ! inverse of b64List indexed by character code, -1 if not found
+      integer(IK), parameter :: b64Inv(0:255) = &
+         (/(index(b64List,achar(i))-1, i=0,255)/)
 
       integer(IK), parameter :: nVTKElms=5
       integer(IK), parameter :: nVTKDataTyps=5
@@ -1449,11 +1452,8 @@
 
          if ( vtk%dataEncdng.eq."base64" ) then
             code = repeat(" ",np)
-            j = 0_IK
-            do i=dPtr%stPos, dPtr%endPos-1
-               j = j+1_IK
-               read(vtk%fid,pos=i,end=001) code(j:j)
-            end do
+            j = min(np, dPtr%endPos-dPtr%stPos)
+            if ( j.gt.0_IK ) read(vtk%fid,pos=dPtr%stPos,end=001) code(1:j)
 
             np = np*3_IK/4_IK
             if ( mod(np1+np2,3_IK).ne.0 ) &
@@ -1533,8 +1533,9 @@
          character(len=:), allocatable :: code
          integer(IK) :: hdr(3),nlen,ikind
          integer(IK) :: i,j,ist,iend,iBlk
-         integer(IK) :: np,np1,np2,npadd
-         integer(IK), dimension(:), allocatable :: szBlk
+         integer(IK) :: np,np1,np2,npadd,jerr
+         logical :: lerr
+         integer(IK), dimension(:), allocatable :: szBlk,offBlk
          integer(IK1), allocatable, dimension(:) :: pIK1,p1,p2
 
          ikind = dPtr%ikind
@@ -1547,11 +1548,7 @@
          if ( vtk%dataEncdng.eq."base64" ) then
             nlen = 4_IK * dPTr%hdrKind
             code = repeat(" ",nlen)
-            j = 0_IK
-            do i=iPos, iPos+nlen-1_IK
-               j = j+1_IK
-               read(vtk%fid,pos=i,end=001) code(j:j)
-            end do
+            read(vtk%fid,pos=iPos,end=001) code
             call decode_bits(code,p1)
             iPos = iPos + nlen
          else
@@ -1606,12 +1603,8 @@
             if ( mod(np1,3_IK).gt.0_IK ) &
                npadd = 3_IK-mod(np1,3_IK)
             nlen = (np1+npadd)*4_IK/3_IK
-            j = 0_IK
             code = repeat(" ",nlen)
-            do i=iPos, iPos+nlen-1_IK
-               j = j+1_IK
-               read(vtk%fid,pos=i,end=001) code(j:j)
-            end do
+            read(vtk%fid,pos=iPos,end=001) code
             call decode_bits(code,p1)
             iPos = iPos + nlen
          else
@@ -1644,47 +1637,53 @@
             allocate(dPtr%darr(dPtr%nElms))
          end if
 
+         ! read all compressed blocks at once and inflate them
+         ! independently on threads
+         np = sum(szBlk)
+         if ( allocated(pIK1) ) deallocate(pIK1)
+         allocate(pIK1(np)); pIK1 = 0_IK1
          if ( vtk%dataEncdng.eq."base64" ) then
             npadd = 0_IK
-            np = sum(szBlk)
-            if ( allocated(pIK1) ) deallocate(pIK1)
-            allocate(pIK1(np)); pIK1 = 0_IK1
             if ( mod(np,3_IK).gt.0_IK ) &
                npadd = 3_IK-mod(np,3_IK)
             nlen = (np + npadd)*4_IK/3_IK
             code = repeat(" ",nlen)
-            j = 0_IK
-            do i=iPos, iPos+nlen-1_IK
-               j = j+1_IK
-               read(vtk%fid,pos=i,end=001) code(j:j)
-            end do
+            read(vtk%fid,pos=iPos,end=001) code
             call decode_bits(code,pIK1)
             iPos = iPos + nlen
+         else
+            read(vtk%fid,pos=iPos,end=001) pIK1(1:np)
+            iPos = iPos + np
          end if
 
-         ist = 1_IK; np = 0_IK
+         allocate(offBlk(hdr(1)+1_IK))
+         offBlk(1) = 0_IK
+         do iBlk=1_IK, hdr(1)
+            offBlk(iBlk+1) = offBlk(iBlk) + szBlk(iBlk)
+         end do
+
+         ! a block that fails to inflate is skipped and flagged; the
+         ! error is returned once all threads are done
+         lerr = .false.
+!$omp parallel do private(iBlk,np1,np2,nlen,ist,iend,jerr,p2) &
+!$omp schedule(dynamic) shared(lerr)
          do iBlk=1_IK, hdr(1)
             np1 = szBlk(iBlk)
             np2 = hdr(2)
             if ( iBlk.eq.hdr(1) ) np2 = hdr(3)
 
-            if ( allocated(p1) ) deallocate(p1)
-            if ( allocated(p2) ) deallocate(p2)
-            allocate(p1(np1)); p1(:) = 0_IK1
             allocate(p2(np2)); p2(:) = 0_IK1
-
-            if ( vtk%dataEncdng.eq."base64" ) then
-               p1(1:np1) = pIK1(np+1:np+np1)
-               np = np+np1
-            else
-               read(vtk%fid,pos=ipos) p1(1:np1)
-               iPos = iPos + np1
+            call infZlibData(pIK1(offBlk(iBlk)+1:offBlk(iBlk+1)),np1, &
+               p2,np2,jerr)
+            if ( jerr.lt.0_IK ) then
+               deallocate(p2)
+!$omp atomic write
+               lerr = .true.
+               cycle
             end if
 
-            call infZlibData(p1,np1,p2,np2,istat)
-            if ( istat.lt.0 ) return
-
             nlen = np2/ikind
+            ist  = (iBlk-1_IK)*(hdr(2)/ikind) + 1_IK
             iend = ist-1 + nlen
 
             if ( dPtr%isInt ) then
@@ -1705,10 +1704,13 @@
                case (RK8)
                   call transferBits(p2,np2,int(ikind,kind=RK8),dPtr%darr(ist:iend),nlen)
                end select
-               ist = iend+1
             end if
-            ist = iend+1
+            deallocate(p2)
          end do
+!$omp end parallel do
+         if ( lerr ) then
+            istat=-1; return
+         end if
 
          return
 
@@ -1724,32 +1726,36 @@
          character(len=*), intent(in) :: code
          integer(IK1), intent(out) :: bits(:)
 
-         integer(IK1) :: sixb(1:4)
-         integer(IK) :: c,e,Nb
+         integer(IK) :: g,c,e,w,Nb
 
+         ! each group of 4 characters is decoded to 3 bytes through
+         ! the b64Inv table, independently of the other groups
          Nb = size(bits,dim=1,kind=IK)
-         e = 1_IK
-         do c=1_IK, len(code), 4_IK
-            sixb(:) = 0_IK1
-            sixb(1) = index(b64List,code(c  :c  ),kind=IK1) - 1_IK1
-            sixb(2) = index(b64List,code(c+1:c+1),kind=IK1) - 1_IK1
-            sixb(3) = index(b64List,code(c+2:c+2),kind=IK1) - 1_IK1
-            sixb(4) = index(b64List,code(c+3:c+3),kind=IK1) - 1_IK1
+!$omp parallel do private(g,c,e,w) if(len(code).gt.65536)
+         do g=0_IK, len(code)/4_IK-1_IK
+            c = 4_IK*g + 1_IK
+            e = 3_IK*g + 1_IK
+            w = ior(ior(ishft(max(b64Inv(iachar(code(c  :c  ))),0),18), &
+                        ishft(max(b64Inv(iachar(code(c+1:c+1))),0),12)),&
+                    ior(ishft(max(b64Inv(iachar(code(c+2:c+2))),0), 6), &
+                              max(b64Inv(iachar(code(c+3:c+3))),0)))
+            if ( e.le.Nb ) bits(e) = toIK1(ibits(w,16,8))
+            if ( e+1.le.Nb ) bits(e+1) = toIK1(ibits(w,8,8))
+            if ( e+2.le.Nb ) bits(e+2) = toIK1(ibits(w,0,8))
+         end do
+!$omp end parallel do
 
-            call mvbits(sixb(1),0,6,bits(e),2)
-            call mvbits(sixb(2),4,2,bits(e),0)
+         contains
 
-            if ( e+1.le.Nb ) then
-               call mvbits(sixb(2),0,4,bits(e+1),4)
-               call mvbits(sixb(3),2,4,bits(e+1),0)
-            end if
+            pure function toIK1(b) result(r)
+            implicit none
+            integer(IK), intent(in) :: b
+            integer(IK1) :: r
 
-            if ( e+2.le.Nb ) then
-               call mvbits(sixb(3),0,2,bits(e+2),6)
-               call mvbits(sixb(4),0,6,bits(e+2),0)
-            end if
-            e = e+3_IK
-         end do
+            ! unsigned byte value to a signed 8 bit integer
+            r = int(b - 256_IK*ibits(b,7,1), kind=IK1)
+
+            end function toIK1
 
          end subroutine decode_bits
 
@@ -3129,9 +3135,11 @@
          implicit none
          type(vtkXMLType), intent(inout) :: vtk
          integer(IK), intent(inout) :: istat
-         integer(IK) :: fid,i,iatt,ivar,tmpI(100)
+         integer, parameter :: BUFL=1048576
+         integer(IK) :: fid,i,iatt,ivar,tmpI(100),n
+         integer(IK8) :: nsz,iPos8
+         integer(IK1), allocatable :: buf(:)
          logical, dimension(nPieceAtts) :: dAttToW
-         character c
          logical l1
 
          if ( debug )write(stdout,ftab1) &
@@ -3276,10 +3284,16 @@
          write(fid) '    </Piece>'//newl
          write(fid) '  </'//trim(vtk%dataType%str)//'>'//newl
 
-         rewind(10)
-         do
-            read(10,end=001) c
-            write(fid) c
+         ! copy the appended data in large blocks
+         flush(10)
+         inquire(unit=10, size=nsz)
+         allocate(buf(max(min(nsz,int(BUFL,kind=IK8)),1_IK8)))
+         iPos8 = 1_IK8
+         do while (iPos8 .le. nsz)
+            n = int(min(nsz-iPos8+1_IK8, int(size(buf),kind=IK8)))
+            read(10,pos=iPos8,end=001) buf(1:n)
+            write(fid) buf(1:n)
+            iPos8 = iPos8 + int(n,kind=IK8)
          end do
 
  001     close(10)
@@ -3342,17 +3356,14 @@
          type(dataArrType), intent(inout) :: dArr
          integer, parameter :: CHUNK=32768
          integer, parameter :: COMPR=6
+         ! upper bound of the size of a compressed block
+         integer, parameter :: CHUNKZ=CHUNK+CHUNK/64+64
 
-         integer :: fid,ist,iend,iBlk
+         integer :: fid,ist,iBlk
          integer :: np,np1,np2,nlen,ikind
-         integer, dimension(:), allocatable  :: hdr
-         integer(IK1), dimension(:), allocatable :: p1,p2,pIK1
-         integer(IK1), dimension(:), allocatable :: iarrIK1
-         integer(IK2), dimension(:), allocatable :: iarrIK2
-         integer(IK4), dimension(:), allocatable :: iarrIK4
-         integer(IK8), dimension(:), allocatable :: iarrIK8
-         real(RK4), dimension(:), allocatable :: rarrRK4
-         real(RK8), dimension(:), allocatable :: rarrRK8
+         integer, dimension(:), allocatable  :: hdr,ierr
+         integer(IK1), dimension(:), allocatable :: p1,pIK1
+         integer(IK1), dimension(:,:), allocatable :: pz
 
          istat = 0
          fid = vtk%fid
@@ -3360,7 +3371,6 @@
          np = dArr%nElms * ikind
          nlen = np / CHUNK
          if (mod(np, CHUNK).ne.0) nlen = nlen+1
-         allocate(pIK1(2*np)); pIK1 = 0_IK1
 
          allocate(hdr(nlen+3))
          hdr(1) = nlen
@@ -3385,35 +3395,23 @@
                trim(STR(hdr(3)))
          end if
 
-         ist=1; np=0; np1=0
-         do iBlk=1, hdr(1)
-            np1 = hdr(2)
-            if (iBlk.eq.hdr(1) .and. hdr(3).ne.0) np1 = hdr(3)
-            allocate(p1(np1)); p1 = 0_IK1
-            nlen = np1 / ikind
-            iend = ist-1 + nlen
+         ! cast the data array to bytes
+         allocate(pIK1(np)); pIK1 = 0_IK1
+         if (np .gt. 0) then
             if (dArr%isInt) then
                select case (dArr%iKind)
                case(IK1)
-                  allocate(iarrIK1(nlen))
-                  iarrIK1 = int(dArr%iarr(ist:iend), kind=IK1)
-                  p1 = transfer(iarrIK1, p1)
-                  deallocate(iarrIK1)
+                  pIK1 = transfer(int(dArr%iarr(1:dArr%nElms), &
+                     kind=IK1), pIK1)
                case(IK2)
-                  allocate(iarrIK2(nlen))
-                  iarrIK2 = int(dArr%iarr(ist:iend), kind=IK2)
-                  p1 = transfer(iarrIK2, p1)
-                  deallocate(iarrIK2)
+                  pIK1 = transfer(int(dArr%iarr(1:dArr%nElms), &
+                     kind=IK2), pIK1)
                case(IK4)
-                  allocate(iarrIK4(nlen))
-                  iarrIK4 = int(dArr%iarr(ist:iend), kind=IK4)
-                  p1 = transfer(iarrIK4, p1)
-                  deallocate(iarrIK4)
+                  pIK1 = transfer(int(dArr%iarr(1:dArr%nElms), &
+                     kind=IK4), pIK1)
                case(IK8)
-                  allocate(iarrIK8(nlen))
-                  iarrIK8 = int(dArr%iarr(ist:iend), kind=IK8)
-                  p1 = transfer(iarrIK8, p1)
-                  deallocate(iarrIK8)
+                  pIK1 = transfer(int(dArr%iarr(1:dArr%nElms), &
+                     kind=IK8), pIK1)
                case default
                   write(stdout,ftab4) "ERROR: unknown data type. <"// &
                      trim(dArr%dType)//">"
@@ -3422,45 +3420,57 @@
             else
                select case (dArr%iKind)
                case(RK4)
-                  allocate(rarrRK4(nlen))
-                  rarrRK4 = real(dArr%darr(ist:iend), kind=RK4)
-                  p1 = transfer(rarrRK4, p1)
-                  deallocate(rarrRK4)
+                  pIK1 = transfer(real(dArr%darr(1:dArr%nElms), &
+                     kind=RK4), pIK1)
                case(RK8)
-                  allocate(rarrRK8(nlen))
-                  rarrRK8 = real(dArr%darr(ist:iend), kind=RK8)
-                  p1 = transfer(rarrRK8, p1)
-                  deallocate(rarrRK8)
+                  pIK1 = transfer(real(dArr%darr(1:dArr%nElms), &
+                     kind=RK8), pIK1)
                case default
                   write(stdout,ftab4) "ERROR: unknown data type. <"// &
                      trim(dArr%dType)//">"
                   istat=-1; return
                end select
             end if
-            np2 = CHUNK
-            allocate(p2(np2)); p2 = 0_IK1
-            call defZlibData(p1,np1,p2,np2,COMPR,istat)
-            if (istat .lt. 0) return
-            if ( debug ) then
-               write(stdout,ftab4) "size of block#"//trim(STR(iBlk))// &
-                  " (after compr.) "//trim(STR(np2))
-            end if
-            hdr(3+iBlk) = np2
-            pIK1(np+1:np+np2) = p2(1:np2)
-            np = np + np2
-            deallocate(p1,p2)
+         end if
 
-            ist = iend + 1
+         ! blocks are compressed independently on threads, as allowed
+         ! by the multi-block header, and written in order afterwards
+         allocate(pz(CHUNKZ,nlen), ierr(nlen))
+         ierr = 0
+!$omp parallel do private(iBlk,ist,np1,np2) schedule(dynamic)
+         do iBlk=1, nlen
+            ist = (iBlk-1)*CHUNK + 1
+            np1 = CHUNK
+            if (iBlk.eq.nlen .and. hdr(3).ne.0) np1 = hdr(3)
+            np2 = CHUNKZ
+            call defZlibData(pIK1(ist:ist+np1-1),np1,pz(:,iBlk),np2, &
+               COMPR,ierr(iBlk))
+            hdr(3+iBlk) = np2
          end do
+!$omp end parallel do
+         deallocate(pIK1)
+         if (any(ierr .lt. 0)) then
+            istat=-1; return
+         end if
+
+         if ( debug ) then
+            do iBlk=1, nlen
+               write(stdout,ftab4) "size of block#"//trim(STR(iBlk))// &
+                  " (after compr.) "//trim(STR(hdr(3+iBlk)))
+            end do
+         end if
 
-         nlen = hdr(1)
+         np = 0; np1 = 0
          if (nlen.gt.0) then
             np1 = nlen * dArr%hdrKind
             allocate(p1(np1)); p1 = 0_IK1
             p1 = transfer(hdr(4:nlen+3), p1)
             write(10) p1(1:np1)
-            write(10) pIK1(1:np)
-            deallocate(p1, pIK1)
+            deallocate(p1)
+            do iBlk=1, nlen
+               write(10) pz(1:hdr(3+iBlk),iBlk)
+               np = np + hdr(3+iBlk)
+            end do
          end if
 
          dArr%nBytes = np1 + np + (3*dArr%hdrKind)
@@ -55,7 +55,8 @@
       REAL(KIND=LSRP), INTENT(INOUT) :: R(lhs%nNo)
 
       INTEGER(KIND=LSIP) nNo, mynNo, i
-      REAL(KIND=LSRP) errO, err, alpha, beta, rho, rhoO, omega, eps
+      REAL(KIND=LSRP) errO, err, alpha, beta, rho, rhoO, omega, eps,    &
+     &   tmp(2)
       REAL(KIND=LSRP) FSILS_CPUT, FSILS_NORMS, FSILS_DOTS
 
       REAL(KIND=LSRP), ALLOCATABLE :: P(:), Rh(:), X(:), V(:), S(:),    &
@@ -87,14 +88,18 @@
          alpha = rho/FSILS_DOTS(mynNo, lhs%commu, Rh, V)
          S     = R - alpha*V
          CALL FSILS_SPARMULSS(lhs, lhs%rowPtr, lhs%colPtr, K, S, T)
-         omega = FSILS_NORMS(mynNo, lhs%commu, T)
-         omega = FSILS_DOTS(mynNo, lhs%commu, T, S)/(omega*omega)
-         X     = X + alpha*P + omega*S
-         R     = S - omega*T
+         CALL OMPDOT2V(1, mynNo, T, T, S, tmp)
+         CALL FSILS_BCASTV(2, tmp, lhs%commu)
+         omega = tmp(2)/tmp(1)
+         CALL OMPBICGUPDV(1, nNo, mynNo, alpha, omega, X, P, S, T, R,   &
+     &      Rh, tmp)
+         !X     = X + alpha*P + omega*S
+         !R     = S - omega*T
+         CALL FSILS_BCASTV(2, tmp, lhs%commu)
          errO  = err
-         err   = FSILS_NORMS(mynNo, lhs%commu, R)
+         err   = SQRT(tmp(1))
          rhoO  = rho
-         rho   = FSILS_DOTS(mynNo, lhs%commu, R, Rh)
+         rho   = tmp(2)
          beta  = rho*alpha/(rhoO*omega)
          P     = R + beta*(P - omega*V)
       END DO
@@ -121,7 +126,8 @@
       REAL(KIND=LSRP), INTENT(INOUT) :: R(dof,lhs%nNo)
 
       INTEGER(KIND=LSIP) nNo, mynNo, i
-      REAL(KIND=LSRP) errO, err, alpha, beta, rho, rhoO, omega, eps
+      REAL(KIND=LSRP) errO, err, alpha, beta, rho, rhoO, omega, eps,    &
+     &   tmp(2)
       REAL(KIND=LSRP) FSILS_CPUT, FSILS_NORMV, FSILS_DOTV
 
       REAL(KIND=LSRP), ALLOCATABLE :: P(:,:), Rh(:,:), X(:,:), V(:,:),  &
@@ -154,14 +160,18 @@
          alpha = rho/FSILS_DOTV(dof, mynNo, lhs%commu, Rh, V)
          S     = R - alpha*V
          CALL FSILS_SPARMULVV(lhs, lhs%rowPtr, lhs%colPtr, dof, K, S, T)
-         omega = FSILS_NORMV(dof, mynNo, lhs%commu, T)
-         omega = FSILS_DOTV(dof, mynNo, lhs%commu, T, S)/(omega*omega)
-         X     = X + alpha*P + omega*S
-         R     = S - omega*T
+         CALL OMPDOT2V(dof, mynNo, T, T, S, tmp)
+         CALL FSILS_BCASTV(2, tmp, lhs%commu)
+         omega = tmp(2)/tmp(1)
+         CALL OMPBICGUPDV(dof, nNo, mynNo, alpha, omega, X, P, S, T,    &
+     &      R, Rh, tmp)
+         !X     = X + alpha*P + omega*S
+         !R     = S - omega*T
+         CALL FSILS_BCASTV(2, tmp, lhs%commu)
          errO  = err
-         err   = FSILS_NORMV(dof, mynNo, lhs%commu, R)
+         err   = SQRT(tmp(1))
          rhoO  = rho
-         rho   = FSILS_DOTV(dof, mynNo, lhs%commu, R, Rh)
+         rho   = tmp(2)
          beta  = rho*alpha/(rhoO*omega)
          P     = R + beta*(P - omega*V)
       END DO
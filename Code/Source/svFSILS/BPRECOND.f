@@ -0,0 +1,623 @@
+!--------------------------------------------------------------------
+!     Created by Mahdi Esmaily Moghadam
+!     contact memt63@gmail.com for reporting the bugs.
+!--------------------------------------------------------------------
+!
+!     UC Copyright Notice
+!     This software is Copyright ©2012 The Regents of the University of
+!     California. All Rights Reserved.
+!
+!     Permission to copy and modify this software and its documentation
+!     for educational, research and non-profit purposes, without fee,
+!     and without a written agreement is hereby granted, provided that
+!     the above copyright notice, this paragraph and the following three
+!     paragraphs appear in all copies.
+!
+!     Permission to make commercial use of this software may be obtained
+!     by contacting:
+!     Technology Transfer Office
+!     9500 Gilman Drive, Mail Code 0910
+!     University of California
+!     La Jolla, CA 92093-0910
+!     (858) 534-5815
+!     invent@ucsd.edu
+!
+!     This software program and documentation are copyrighted by The
+!     Regents of the University of California. The software program and
+!     documentation are supplied "as is", without any accompanying
+!     services from The Regents. The Regents does not warrant that the
+!     operation of the program will be uninterrupted or error-free. The
+!     end-user understands that the program was developed for research
+!     purposes and is advised not to rely exclusively on the program for
+!     any reason.
+!
+!     IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY
+!     PARTY FOR DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL
+!     DAMAGES, INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS
+!     SOFTWARE AND ITS DOCUMENTATION, EVEN IF THE UNIVERSITY OF
+!     CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!     THE UNIVERSITY OF CALIFORNIA SPECIFICALLY DISCLAIMS ANY
+!     WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+!     OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. THE
+!     SOFTWARE PROVIDED HEREUNDER IS ON AN "AS IS" BASIS, AND THE
+!     UNIVERSITY OF CALIFORNIA HAS NO OBLIGATIONS TO PROVIDE
+!     MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+!
+!--------------------------------------------------------------------
+!--------------------------------------------------------------------
+!     Block preconditioners, applied on top of the diagonal scaling of
+!     PRECONDDIAG and working with dof*dof blocks of the LHS:
+!     - Block Jacobi, applied as a two-sided scaling K = L^-1*K*L^-T
+!       with the Cholesky factor L of each (symmetrized) diagonal
+!       block, so that it can be used with every solver.
+!     - Block ILU(0), processor-local, applied as a right
+!       preconditioner in GMRES. The factorization and the triangular
+!       solves are threaded over level sets of the sparsity pattern.
+!     Blocks are stored row-wise, i.e. entry (r,c) of a block is at
+!     (r-1)*dof+c, as in Val.
+!--------------------------------------------------------------------
+
+      SUBROUTINE PRECONDBJ(lhs, rowPtr, colPtr, diagPtr, dof, Val, R)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      INTEGER(KIND=LSIP), INTENT(IN) :: rowPtr(2,lhs%nNo),              &
+     &  colPtr(lhs%nnz), diagPtr(lhs%nNo)
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof
+      REAL(KIND=LSRP), INTENT(INOUT) :: Val(dof*dof,lhs%nnz),           &
+     &   R(dof,lhs%nNo)
+
+      INTEGER(KIND=LSIP) nNo, a, j, Ac, faIn
+      LOGICAL, ALLOCATABLE :: cFlag(:)
+
+      nNo = lhs%nNo
+      CALL PCALLOC(lhs, dof*dof, nNo)
+
+!     Assembled diagonal blocks
+      DO Ac=1, nNo
+         lhs%pcV(:,Ac) = Val(:,diagPtr(Ac))
+      END DO
+      CALL FSILS_COMMUV(lhs, dof*dof, lhs%pcV)
+
+!     Nodes of coupled Neumann faces are only diagonally scaled, so that
+!     valM set by PRECONDDIAG stays valid
+      ALLOCATE(cFlag(nNo))
+      cFlag = .FALSE.
+      DO faIn=1, lhs%nFaces
+         IF (lhs%face(faIn)%coupledFlag) THEN
+            DO a=1, lhs%face(faIn)%nNo
+               cFlag(lhs%face(faIn)%glob(a)) = .TRUE.
+            END DO
+         END IF
+      END DO
+
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(Ac) SCHEDULE(GUIDED)
+      DO Ac=1, nNo
+         IF (cFlag(Ac)) THEN
+            CALL BLKEYE(dof, lhs%pcV(:,Ac))
+         ELSE
+            CALL BLKCHOLINV(dof, lhs%pcV(:,Ac))
+         END IF
+      END DO
+!$OMP END PARALLEL DO
+
+!     K = L^-1*K*L^-T and R = L^-1*R
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(Ac, j) SCHEDULE(GUIDED)
+      DO Ac=1, nNo
+         DO j=rowPtr(1,Ac), rowPtr(2,Ac)
+            CALL BLKSCAL(dof, lhs%pcV(:,Ac), lhs%pcV(:,colPtr(j)),      &
+     &         Val(:,j))
+         END DO
+         CALL BLKLMULV(dof, lhs%pcV(:,Ac), R(:,Ac))
+      END DO
+!$OMP END PARALLEL DO
+
+      RETURN
+      END SUBROUTINE PRECONDBJ
+!--------------------------------------------------------------------
+!     Recovers the solution after a block Jacobi scaled solve, X=L^-T*X
+      SUBROUTINE PRECONDBJX(lhs, dof, X)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof
+      REAL(KIND=LSRP), INTENT(INOUT) :: X(dof,lhs%nNo)
+
+      INTEGER(KIND=LSIP) Ac
+
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(Ac) SCHEDULE(GUIDED)
+      DO Ac=1, lhs%nNo
+         CALL BLKLTMULV(dof, lhs%pcV(:,Ac), X(:,Ac))
+      END DO
+!$OMP END PARALLEL DO
+
+      RETURN
+      END SUBROUTINE PRECONDBJX
+!####################################################################
+!     Block ILU(0) factorization of Val, stored in lhs%pcV with the
+!     inverse of the pivot blocks in place of the diagonal blocks
+      SUBROUTINE PRECONDILU(lhs, rowPtr, colPtr, diagPtr, dof, Val)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      INTEGER(KIND=LSIP), INTENT(IN) :: rowPtr(2,lhs%nNo),              &
+     &  colPtr(lhs%nnz), diagPtr(lhs%nNo)
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof
+      REAL(KIND=LSRP), INTENT(IN) :: Val(dof*dof,lhs%nnz)
+
+      INTEGER(KIND=LSIP) nNo, nnz, mxR, i, j, k, l, m, n, c, jj, Ac
+      INTEGER(KIND=LSIP), ALLOCATABLE :: iw(:), lst(:)
+      REAL(KIND=LSRP), ALLOCATABLE :: D(:,:)
+
+      nNo = lhs%nNo
+      nnz = lhs%nnz
+      CALL PCALLOC(lhs, dof*dof, nnz)
+      IF (.NOT.ALLOCATED(lhs%lLv)) CALL PCLEVELS(lhs, rowPtr, colPtr)
+
+!     The diagonal blocks of shared nodes are assembled, the coupling
+!     to the other processors is otherwise neglected
+      ALLOCATE(D(dof*dof,nNo))
+      DO Ac=1, nNo
+         D(:,Ac) = Val(:,diagPtr(Ac))
+      END DO
+      CALL FSILS_COMMUV(lhs, dof*dof, D)
+
+      lhs%pcV = Val
+      DO Ac=1, nNo
+         DO i=1, dof
+            k = (i-1)*dof + i
+            IF (D(k,Ac) .EQ. 0._LSRP) D(k,Ac) = 1._LSRP
+         END DO
+         lhs%pcV(:,diagPtr(Ac)) = D(:,Ac)
+      END DO
+      DEALLOCATE(D)
+
+      mxR = MAXVAL(rowPtr(2,:) - rowPtr(1,:)) + 1
+!$OMP PARALLEL DEFAULT(SHARED) PRIVATE(iw, lst, i, j, k, l, m, n, c, jj)
+      ALLOCATE(iw(nNo), lst(mxR))
+      iw = 0
+      DO l=1, SIZE(lhs%lLv)-1
+!$OMP DO SCHEDULE(GUIDED)
+         DO k=lhs%lLv(l), lhs%lLv(l+1)-1
+            i = lhs%lNd(k)
+            n = 0
+            DO j=rowPtr(1,i), rowPtr(2,i)
+               c = colPtr(j)
+               iw(c) = j
+               IF (c .LT. i) THEN
+                  n = n + 1
+                  lst(n) = j
+               END IF
+            END DO
+!           Lower blocks are eliminated in increasing column order
+            DO m=2, n
+               j = lst(m)
+               jj = m - 1
+               DO WHILE (jj .GE. 1)
+                  IF (colPtr(lst(jj)) .LE. colPtr(j)) EXIT
+                  lst(jj+1) = lst(jj)
+                  jj = jj - 1
+               END DO
+               lst(jj+1) = j
+            END DO
+            DO m=1, n
+               j = lst(m)
+               c = colPtr(j)
+!              L_ic = A_ic*U_cc^-1
+               CALL BLKMULR(dof, lhs%pcV(:,j), lhs%pcV(:,diagPtr(c)))
+!              A_ij = A_ij - L_ic*U_cj
+               DO jj=rowPtr(1,c), rowPtr(2,c)
+                  IF (colPtr(jj) .LE. c) CYCLE
+                  IF (iw(colPtr(jj)) .EQ. 0) CYCLE
+                  CALL BLKMSUB(dof, lhs%pcV(:,j), lhs%pcV(:,jj),        &
+     &               lhs%pcV(:,iw(colPtr(jj))))
+               END DO
+            END DO
+            CALL BLKINV(dof, lhs%pcV(:,diagPtr(i)))
+            DO j=rowPtr(1,i), rowPtr(2,i)
+               iw(colPtr(j)) = 0
+            END DO
+         END DO
+!$OMP END DO
+      END DO
+      DEALLOCATE(iw, lst)
+!$OMP END PARALLEL
+
+      RETURN
+      END SUBROUTINE PRECONDILU
+!--------------------------------------------------------------------
+!     U = (LU)^-1*U with the factors from PRECONDILU. The result is
+!     taken from the owner of each shared node, so that it is the same
+!     on all processors.
+      SUBROUTINE PCILU(lhs, dof, U)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof
+      REAL(KIND=LSRP), INTENT(INOUT) :: U(dof,lhs%nNo)
+
+      INTEGER(KIND=LSIP) i, j, k, l, c
+
+!     Forward substitution with the unit lower factor
+      DO l=1, SIZE(lhs%lLv)-1
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i, j, k, c) SCHEDULE(GUIDED)
+         DO k=lhs%lLv(l), lhs%lLv(l+1)-1
+            i = lhs%lNd(k)
+            DO j=lhs%rowPtr(1,i), lhs%rowPtr(2,i)
+               c = lhs%colPtr(j)
+               IF (c .LT. i) CALL BLKMSUBV(dof, lhs%pcV(:,j), U(:,c),   &
+     &            U(:,i))
+            END DO
+         END DO
+!$OMP END PARALLEL DO
+      END DO
+
+!     Backward substitution with the upper factor
+      DO l=1, SIZE(lhs%uLv)-1
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i, j, k, c) SCHEDULE(GUIDED)
+         DO k=lhs%uLv(l), lhs%uLv(l+1)-1
+            i = lhs%uNd(k)
+            DO j=lhs%rowPtr(1,i), lhs%rowPtr(2,i)
+               c = lhs%colPtr(j)
+               IF (c .GT. i) CALL BLKMSUBV(dof, lhs%pcV(:,j), U(:,c),   &
+     &            U(:,i))
+            END DO
+            CALL BLKMULVR(dof, lhs%pcV(:,lhs%diagPtr(i)), U(:,i))
+         END DO
+!$OMP END PARALLEL DO
+      END DO
+
+      U(:,lhs%mynNo+1:lhs%nNo) = 0._LSRP
+      CALL FSILS_COMMUV(lhs, dof, U)
+
+      RETURN
+      END SUBROUTINE PCILU
+!--------------------------------------------------------------------
+!     Level sets of the lower and upper triangular parts of the pattern.
+!     Rows within one level only depend on rows of earlier levels.
+      SUBROUTINE PCLEVELS(lhs, rowPtr, colPtr)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      INTEGER(KIND=LSIP), INTENT(IN) :: rowPtr(2,lhs%nNo),              &
+     &  colPtr(lhs%nnz)
+
+      INTEGER(KIND=LSIP) nNo, i, j, m
+      INTEGER(KIND=LSIP), ALLOCATABLE :: lev(:)
+
+      nNo = lhs%nNo
+      ALLOCATE(lev(nNo))
+
+      DO i=1, nNo
+         m = 0
+         DO j=rowPtr(1,i), rowPtr(2,i)
+            IF (colPtr(j) .LT. i) m = MAX(m, lev(colPtr(j)))
+         END DO
+         lev(i) = m + 1
+      END DO
+      CALL BUCKET(lhs%lLv, lhs%lNd)
+
+      DO i=nNo, 1, -1
+         m = 0
+         DO j=rowPtr(1,i), rowPtr(2,i)
+            IF (colPtr(j) .GT. i) m = MAX(m, lev(colPtr(j)))
+         END DO
+         lev(i) = m + 1
+      END DO
+      CALL BUCKET(lhs%uLv, lhs%uNd)
+
+      RETURN
+      CONTAINS
+!--------------------------------------------------------------------
+      SUBROUTINE BUCKET(lvPtr, lvNd)
+      IMPLICIT NONE
+      INTEGER(KIND=LSIP), ALLOCATABLE, INTENT(OUT) :: lvPtr(:), lvNd(:)
+
+      INTEGER(KIND=LSIP) nLv, l
+
+      nLv = MAXVAL(lev)
+      ALLOCATE(lvPtr(nLv+1), lvNd(nNo))
+      lvPtr = 0
+      DO i=1, nNo
+         lvPtr(lev(i)+1) = lvPtr(lev(i)+1) + 1
+      END DO
+      lvPtr(1) = 1
+      DO l=1, nLv
+         lvPtr(l+1) = lvPtr(l+1) + lvPtr(l)
+      END DO
+      DO i=1, nNo
+         l = lev(i)
+         lvNd(lvPtr(l)) = i
+         lvPtr(l) = lvPtr(l) + 1
+      END DO
+      DO l=nLv, 1, -1
+         lvPtr(l+1) = lvPtr(l)
+      END DO
+      lvPtr(1) = 1
+
+      RETURN
+      END SUBROUTINE BUCKET
+!--------------------------------------------------------------------
+      END SUBROUTINE PCLEVELS
+!####################################################################
+!     Allocates lhs%pcV with the given size if needed
+      SUBROUTINE PCALLOC(lhs, m, n)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      INTEGER(KIND=LSIP), INTENT(IN) :: m, n
+
+      IF (ALLOCATED(lhs%pcV)) THEN
+         IF (SIZE(lhs%pcV,1).EQ.m .AND. SIZE(lhs%pcV,2).EQ.n) RETURN
+         DEALLOCATE(lhs%pcV)
+      END IF
+      ALLOCATE(lhs%pcV(m,n))
+
+      RETURN
+      END SUBROUTINE PCALLOC
+!####################################################################
+!     Dense block kernels
+!--------------------------------------------------------------------
+      SUBROUTINE BLKEYE(n, A)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: n
+      REAL(KIND=LSRP), INTENT(OUT) :: A(n*n)
+
+      INTEGER(KIND=LSIP) i
+
+      A = 0._LSRP
+      DO i=1, n
+         A((i-1)*n+i) = 1._LSRP
+      END DO
+
+      RETURN
+      END SUBROUTINE BLKEYE
+!--------------------------------------------------------------------
+!     A = L^-1, with L the Cholesky factor of the symmetric part of A.
+!     Zero diagonal entries (Dirichlet BC) are replaced by 1, and A is
+!     set to identity if it is not positive definite.
+      SUBROUTINE BLKCHOLINV(n, A)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: n
+      REAL(KIND=LSRP), INTENT(INOUT) :: A(n*n)
+
+      INTEGER(KIND=LSIP) r, c, k
+      REAL(KIND=LSRP) s, L(n,n), Li(n,n)
+
+      L = 0._LSRP
+      DO c=1, n
+         s = A((c-1)*n+c)
+         IF (s .EQ. 0._LSRP) s = 1._LSRP
+         DO k=1, c-1
+            s = s - L(c,k)*L(c,k)
+         END DO
+         IF (s .LE. 0._LSRP) THEN
+            CALL BLKEYE(n, A)
+            RETURN
+         END IF
+         L(c,c) = SQRT(s)
+         DO r=c+1, n
+            s = 0.5_LSRP*(A((r-1)*n+c) + A((c-1)*n+r))
+            DO k=1, c-1
+               s = s - L(r,k)*L(c,k)
+            END DO
+            L(r,c) = s/L(c,c)
+         END DO
+      END DO
+
+      Li = 0._LSRP
+      DO c=1, n
+         Li(c,c) = 1._LSRP/L(c,c)
+         DO r=c+1, n
+            s = 0._LSRP
+            DO k=c, r-1
+               s = s - L(r,k)*Li(k,c)
+            END DO
+            Li(r,c) = s/L(r,r)
+         END DO
+      END DO
+
+      DO r=1, n
+         DO c=1, n
+            A((r-1)*n+c) = Li(r,c)
+         END DO
+      END DO
+
+      RETURN
+      END SUBROUTINE BLKCHOLINV
+!--------------------------------------------------------------------
+!     B = Li*B*Lj^T, with Li and Lj lower triangular
+      SUBROUTINE BLKSCAL(n, Li, Lj, B)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: n
+      REAL(KIND=LSRP), INTENT(IN) :: Li(n*n), Lj(n*n)
+      REAL(KIND=LSRP), INTENT(INOUT) :: B(n*n)
+
+      INTEGER(KIND=LSIP) r, c, k
+      REAL(KIND=LSRP) T(n*n)
+
+      DO r=1, n
+         DO c=1, n
+            T((r-1)*n+c) = 0._LSRP
+            DO k=1, r
+               T((r-1)*n+c) = T((r-1)*n+c) + Li((r-1)*n+k)*B((k-1)*n+c)
+            END DO
+         END DO
+      END DO
+      DO r=1, n
+         DO c=1, n
+            B((r-1)*n+c) = 0._LSRP
+            DO k=1, c
+               B((r-1)*n+c) = B((r-1)*n+c) + T((r-1)*n+k)*Lj((c-1)*n+k)
+            END DO
+         END DO
+      END DO
+
+      RETURN
+      END SUBROUTINE BLKSCAL
+!--------------------------------------------------------------------
+!     v = L*v, with L lower triangular
+      SUBROUTINE BLKLMULV(n, L, v)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: n
+      REAL(KIND=LSRP), INTENT(IN) :: L(n*n)
+      REAL(KIND=LSRP), INTENT(INOUT) :: v(n)
+
+      INTEGER(KIND=LSIP) r, k
+      REAL(KIND=LSRP) s
+
+      DO r=n, 1, -1
+         s = 0._LSRP
+         DO k=1, r
+            s = s + L((r-1)*n+k)*v(k)
+         END DO
+         v(r) = s
+      END DO
+
+      RETURN
+      END SUBROUTINE BLKLMULV
+!--------------------------------------------------------------------
+!     v = L^T*v, with L lower triangular
+      SUBROUTINE BLKLTMULV(n, L, v)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: n
+      REAL(KIND=LSRP), INTENT(IN) :: L(n*n)
+      REAL(KIND=LSRP), INTENT(INOUT) :: v(n)
+
+      INTEGER(KIND=LSIP) r, k
+      REAL(KIND=LSRP) s
+
+      DO r=1, n
+         s = 0._LSRP
+         DO k=r, n
+            s = s + L((k-1)*n+r)*v(k)
+         END DO
+         v(r) = s
+      END DO
+
+      RETURN
+      END SUBROUTINE BLKLTMULV
+!--------------------------------------------------------------------
+!     A = A^-1 by Gauss-Jordan elimination with partial pivoting. A
+!     singular block is replaced by identity.
+      SUBROUTINE BLKINV(n, A)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: n
+      REAL(KIND=LSRP), INTENT(INOUT) :: A(n*n)
+
+      INTEGER(KIND=LSIP) r, c, p
+      REAL(KIND=LSRP) M(n,2*n), s, t(2*n)
+
+      M = 0._LSRP
+      DO r=1, n
+         DO c=1, n
+            M(r,c) = A((r-1)*n+c)
+         END DO
+         M(r,n+r) = 1._LSRP
+      END DO
+
+      DO c=1, n
+         p = c - 1 + MAXLOC(ABS(M(c:n,c)), 1)
+         IF (M(p,c) .EQ. 0._LSRP) THEN
+            CALL BLKEYE(n, A)
+            RETURN
+         END IF
+         IF (p .NE. c) THEN
+            t      = M(c,:)
+            M(c,:) = M(p,:)
+            M(p,:) = t
+         END IF
+         s      = 1._LSRP/M(c,c)
+         M(c,:) = M(c,:)*s
+         DO r=1, n
+            IF (r .EQ. c) CYCLE
+            s = M(r,c)
+            IF (s .NE. 0._LSRP) M(r,:) = M(r,:) - s*M(c,:)
+         END DO
+      END DO
+
+      DO r=1, n
+         DO c=1, n
+            A((r-1)*n+c) = M(r,n+c)
+         END DO
+      END DO
+
+      RETURN
+      END SUBROUTINE BLKINV
+!--------------------------------------------------------------------
+!     A = A*B
+      SUBROUTINE BLKMULR(n, A, B)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: n
+      REAL(KIND=LSRP), INTENT(INOUT) :: A(n*n)
+      REAL(KIND=LSRP), INTENT(IN) :: B(n*n)
+
+      INTEGER(KIND=LSIP) r, c, k
+      REAL(KIND=LSRP) T(n*n)
+
+      DO r=1, n
+         DO c=1, n
+            T((r-1)*n+c) = 0._LSRP
+            DO k=1, n
+               T((r-1)*n+c) = T((r-1)*n+c) + A((r-1)*n+k)*B((k-1)*n+c)
+            END DO
+         END DO
+      END DO
+      A = T
+
+      RETURN
+      END SUBROUTINE BLKMULR
+!--------------------------------------------------------------------
+!     D = D - A*B
+      SUBROUTINE BLKMSUB(n, A, B, D)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: n
+      REAL(KIND=LSRP), INTENT(IN) :: A(n*n), B(n*n)
+      REAL(KIND=LSRP), INTENT(INOUT) :: D(n*n)
+
+      INTEGER(KIND=LSIP) r, c, k
+
+      DO r=1, n
+         DO k=1, n
+            DO c=1, n
+               D((r-1)*n+c) = D((r-1)*n+c) - A((r-1)*n+k)*B((k-1)*n+c)
+            END DO
+         END DO
+      END DO
+
+      RETURN
+      END SUBROUTINE BLKMSUB
+!--------------------------------------------------------------------
+!     w = w - A*v
+      SUBROUTINE BLKMSUBV(n, A, v, w)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: n
+      REAL(KIND=LSRP), INTENT(IN) :: A(n*n), v(n)
+      REAL(KIND=LSRP), INTENT(INOUT) :: w(n)
+
+      INTEGER(KIND=LSIP) r, k
+
+      DO r=1, n
+         DO k=1, n
+            w(r) = w(r) - A((r-1)*n+k)*v(k)
+         END DO
+      END DO
+
+      RETURN
+      END SUBROUTINE BLKMSUBV
+!--------------------------------------------------------------------
+!     v = A*v
+      SUBROUTINE BLKMULVR(n, A, v)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: n
+      REAL(KIND=LSRP), INTENT(IN) :: A(n*n)
+      REAL(KIND=LSRP), INTENT(INOUT) :: v(n)
+
+      INTEGER(KIND=LSIP) r, k
+      REAL(KIND=LSRP) t(n)
+
+      DO r=1, n
+         t(r) = 0._LSRP
+         DO k=1, n
+            t(r) = t(r) + A((r-1)*n+k)*v(k)
+         END DO
+      END DO
+      v = t
+
+      RETURN
+      END SUBROUTINE BLKMULVR
+!####################################################################
@@ -97,14 +97,12 @@
          CALL OMPSUMS(nNo, -1._LSRP, SP, DGP)
          !SP    = SP - DGP
          alpha = errO/FSILS_DOTS(mynNo, lhs%commu, P, SP)
-         CALL OMPSUMS(nNo, alpha, X, P)
+         CALL OMPCGUPDV(1, nNo, mynNo, alpha, X, P, R, SP, err)
          !X     = X + alpha*P
-         CALL OMPSUMS(nNo, -alpha, R, SP)
          !R     = R - alpha*SP
-         err   = FSILS_NORMS(mynNo, lhs%commu, R)
-         err   = err*err
-         CALL OMPSUMS(nNo, errO/err, P, R)
-         CALL OMPMULS(nNo, err/errO, P)
+         !err   = |R|^2
+         CALL FSILS_BCAST(err, lhs%commu)
+         CALL OMPXPAYV(1, nNo, err/errO, P, R)
          !P     = R + err/errO*P
       END DO
       R        = X
@@ -157,14 +155,12 @@
          errO = err
          CALL FSILS_SPARMULSS(lhs, lhs%rowPtr, lhs%colPtr, K, P, KP)
          alpha = errO/FSILS_DOTS(mynNo, lhs%commu, P, KP)
-         CALL OMPSUMS(nNo, alpha, X, P)
+         CALL OMPCGUPDV(1, nNo, mynNo, alpha, X, P, R, KP, err)
          !X     = X + alpha*P
-         CALL OMPSUMS(nNo, -alpha, R, KP)
          !R     = R - alpha*KP
-         err   = FSILS_NORMS(mynNo, lhs%commu, R)
-         err   = err*err
-         CALL OMPSUMS(nNo, errO/err, P, R)
-         CALL OMPMULS(nNo, err/errO, P)
+         !err   = |R|^2
+         CALL FSILS_BCAST(err, lhs%commu)
+         CALL OMPXPAYV(1, nNo, err/errO, P, R)
          !P = R + err/errO*P
       END DO
 
@@ -181,13 +177,16 @@
       RETURN
       END SUBROUTINE CGRADS
 !--------------------------------------------------------------------
-      SUBROUTINE CGRADV(lhs, ls, dof, K, R)
+!     The LHS is either K or its single-precision copy K4; only one of
+!     these should be present.
+      SUBROUTINE CGRADV(lhs, ls, dof, R, K, K4)
       INCLUDE "FSILS_STD.h"
       TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
       TYPE(FSILS_subLsType), INTENT(INOUT) :: ls
       INTEGER(KIND=LSIP), INTENT(IN) :: dof
-      REAL(KIND=LSRP), INTENT(IN) :: K(dof*dof,lhs%nnz)
       REAL(KIND=LSRP), INTENT(INOUT) :: R(dof,lhs%nNo)
+      REAL(KIND=LSRP), INTENT(IN), OPTIONAL :: K(dof*dof,lhs%nnz)
+      REAL(KIND=LSRP4), INTENT(IN), OPTIONAL :: K4(dof*dof,lhs%nnz)
 
       INTEGER(KIND=LSIP) nNo, mynNo, i
       REAL(KIND=LSRP) errO, err, alpha, eps
@@ -215,16 +214,20 @@
             EXIT
          END IF
          errO = err
-         CALL FSILS_SPARMULVV(lhs, lhs%rowPtr, lhs%colPtr, dof, K, P,KP)
+         IF (PRESENT(K)) THEN
+            CALL FSILS_SPARMULVV(lhs, lhs%rowPtr, lhs%colPtr, dof, K,   &
+     &         P, KP)
+         ELSE
+            CALL FSILS_SPARMULVV4(lhs, lhs%rowPtr, lhs%colPtr, dof, K4, &
+     &         P, KP)
+         END IF
          alpha = errO/FSILS_DOTV(dof, mynNo, lhs%commu, P, KP)
-         CALL OMPSUMV(dof, nNo, alpha, X, P)
+         CALL OMPCGUPDV(dof, nNo, mynNo, alpha, X, P, R, KP, err)
          !X     = X + alpha*P
-         CALL OMPSUMV(dof, nNo, -alpha, R, KP)
          !R     = R - alpha*KP
-         err   = FSILS_NORMV(dof, mynNo, lhs%commu, R)
-         err   = err*err
-         CALL OMPSUMV(dof, nNo, errO/err, P, R)
-         CALL OMPMULV(dof, nNo, err/errO, P)
+         !err   = |R|^2
+         CALL FSILS_BCAST(err, lhs%commu)
+         CALL OMPXPAYV(dof, nNo, err/errO, P, R)
          !P = R + err/errO*P
       END DO
 
@@ -132,6 +132,18 @@
             INTEGER(KIND=LSIP), INTENT(IN), OPTIONAL :: incL(lhs%nFaces)
             REAL(KIND=LSRP), INTENT(IN), OPTIONAL :: res(lhs%nFaces)
          END SUBROUTINE FSILS_SOLVE
+         SUBROUTINE FSILS_MFSOLVE (lhs, ls, dof, Ri, Di, MATVEC, incL,  &
+     &      res)
+            INCLUDE "FSILS_STRUCT.h"
+            TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+            TYPE(FSILS_lsType), INTENT(INOUT) :: ls
+            INTEGER(KIND=LSIP), INTENT(IN) :: dof
+            REAL(KIND=LSRP), INTENT(INOUT) :: Ri(dof,lhs%nNo)
+            REAL(KIND=LSRP), INTENT(IN) :: Di(dof,lhs%nNo)
+            EXTERNAL MATVEC
+            INTEGER(KIND=LSIP), INTENT(IN), OPTIONAL :: incL(lhs%nFaces)
+            REAL(KIND=LSRP), INTENT(IN), OPTIONAL :: res(lhs%nFaces)
+         END SUBROUTINE FSILS_MFSOLVE
       END INTERFACE
 
       INTERFACE FSILS_INP
@@ -0,0 +1,76 @@
+!--------------------------------------------------------------------
+!     Created by Mahdi Esmaily Moghadam
+!     contact memt63@gmail.com for reporting the bugs.
+!--------------------------------------------------------------------
+!
+!     UC Copyright Notice
+!     This software is Copyright ©2012 The Regents of the University of
+!     California. All Rights Reserved.
+!
+!     Permission to copy and modify this software and its documentation
+!     for educational, research and non-profit purposes, without fee,
+!     and without a written agreement is hereby granted, provided that
+!     the above copyright notice, this paragraph and the following three
+!     paragraphs appear in all copies.
+!
+!     Permission to make commercial use of this software may be obtained
+!     by contacting:
+!     Technology Transfer Office
+!     9500 Gilman Drive, Mail Code 0910
+!     University of California
+!     La Jolla, CA 92093-0910
+!     (858) 534-5815
+!     invent@ucsd.edu
+!
+!     This software program and documentation are copyrighted by The
+!     Regents of the University of California. The software program and
+!     documentation are supplied "as is", without any accompanying
+!     services from The Regents. The Regents does not warrant that the
+!     operation of the program will be uninterrupted or error-free. The
+!     end-user understands that the program was developed for research
+!     purposes and is advised not to rely exclusively on the program for
+!     any reason.
+!
+!     IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY
+!     PARTY FOR DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL
+!     DAMAGES, INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS
+!     SOFTWARE AND ITS DOCUMENTATION, EVEN IF THE UNIVERSITY OF
+!     CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!     THE UNIVERSITY OF CALIFORNIA SPECIFICALLY DISCLAIMS ANY
+!     WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+!     OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. THE
+!     SOFTWARE PROVIDED HEREUNDER IS ON AN "AS IS" BASIS, AND THE
+!     UNIVERSITY OF CALIFORNIA HAS NO OBLIGATIONS TO PROVIDE
+!     MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+!
+!--------------------------------------------------------------------
+!     Interfaces of the Krylov solvers that have optional arguments.
+!     Included by the routines that call them.
+!--------------------------------------------------------------------
+
+      INTERFACE
+         SUBROUTINE GMRESV(lhs, ls, dof, R, Val, Val4, W, MATVEC)
+            INCLUDE "FSILS_STRUCT.h"
+            TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+            TYPE(FSILS_subLsType), INTENT(INOUT) :: ls
+            INTEGER(KIND=LSIP), INTENT(IN) :: dof
+            REAL(KIND=LSRP), INTENT(INOUT) :: R(dof,lhs%nNo)
+            REAL(KIND=LSRP), INTENT(IN), OPTIONAL ::                    &
+     &         Val(dof*dof,lhs%nnz), W(dof,lhs%nNo)
+            REAL(KIND=LSRP4), INTENT(IN), OPTIONAL ::                   &
+     &         Val4(dof*dof,lhs%nnz)
+            EXTERNAL MATVEC
+            OPTIONAL MATVEC
+         END SUBROUTINE GMRESV
+
+         SUBROUTINE CGRADV(lhs, ls, dof, R, K, K4)
+            INCLUDE "FSILS_STRUCT.h"
+            TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+            TYPE(FSILS_subLsType), INTENT(INOUT) :: ls
+            INTEGER(KIND=LSIP), INTENT(IN) :: dof
+            REAL(KIND=LSRP), INTENT(INOUT) :: R(dof,lhs%nNo)
+            REAL(KIND=LSRP), INTENT(IN), OPTIONAL :: K(dof*dof,lhs%nnz)
+            REAL(KIND=LSRP4), INTENT(IN), OPTIONAL ::                   &
+     &         K4(dof*dof,lhs%nnz)
+         END SUBROUTINE CGRADV
+      END INTERFACE
@@ -54,7 +54,7 @@
      &   LS_TYPE_GMRES = 797, LS_TYPE_NS = 796, LS_TYPE_BICGS = 795
 
       INTEGER(KIND=LSIP), PARAMETER :: PRECOND_FSILS = 701,
-     &   PRECOND_RCS = 709
+     &   PRECOND_RCS = 709, PRECOND_BJ = 710, PRECOND_BILU = 711
 
       INTEGER(KIND=LSIP), PARAMETER :: BC_TYPE_Dir = 0, BC_TYPE_Neu = 1
 
@@ -150,6 +150,22 @@
          INTEGER(KIND=LSIP), ALLOCATABLE :: diagPtr(:)
 !        Mapping of nodes                    (USE)
          INTEGER(KIND=LSIP), ALLOCATABLE :: map(:)
+!        Position of transposed entries      (USE)
+         INTEGER(KIND=LSIP), ALLOCATABLE :: tPtr(:)
+!        Calls since Schur blocks were formed(USE)
+         INTEGER(KIND=LSIP) :: sAge = 0
+!        NS solver blocks of the LHS         (USE)
+         REAL(KIND=LSRP), ALLOCATABLE :: mK(:,:), mG(:,:), mD(:,:),     &
+     &      mL(:)
+!        Schur complement blocks             (USE)
+         REAL(KIND=LSRP), ALLOCATABLE :: Gt(:,:), sG(:,:), sL(:)
+!        Active block preconditioner         (USE)
+         INTEGER(KIND=LSIP) :: bPC = 0
+!        Block preconditioner values         (USE)
+         REAL(KIND=LSRP), ALLOCATABLE :: pcV(:,:)
+!        Level sets of lower/upper factors   (USE)
+         INTEGER(KIND=LSIP), ALLOCATABLE :: lLv(:), lNd(:), uLv(:),     &
+     &      uNd(:)
          TYPE(FSILS_commuType) commu
          TYPE(FSILS_cSType), ALLOCATABLE :: cS(:)
          TYPE(FSILS_faceType), ALLOCATABLE :: face(:)
@@ -198,9 +214,31 @@
          INTEGER(KIND=LSIP) Resm
 !        Contribution of cont. res.  (OUT)
          INTEGER(KIND=LSIP) Resc
+!        Single-precision LHS        (IN)
+         LOGICAL :: mixP = .FALSE.
+!        Max. refinement steps       (IN)
+         INTEGER(KIND=LSIP) :: mRef = 10
+!        Reuse of Schur blocks       (IN)
+         INTEGER(KIND=LSIP) :: sFrz = 0
+!        Saved solutions for guess   (IN)
+         INTEGER(KIND=LSIP) :: nPrj = 0
          TYPE(FSILS_subLsType) GM
          TYPE(FSILS_subLsType) CG
          TYPE(FSILS_subLsType) RI
+!        Inexact Newton tolerances   (IN)
+         LOGICAL :: ewFlag = .FALSE.
+!        Number of saved solutions   (USE)
+         INTEGER(KIND=LSIP) :: nX = 0
+!        Last saved solution         (USE)
+         INTEGER(KIND=LSIP) :: iX = 0
+!        Max. inexact Newton tol.    (IN)
+         REAL(KIND=LSRP) :: ewMax = 0.5_LSRP
+!        RHS norm of last call       (USE)
+         REAL(KIND=LSRP) :: ewN = 0._LSRP
+!        Tolerance of last call      (USE)
+         REAL(KIND=LSRP) :: ewE = 0._LSRP
+!        Saved solutions             (USE)
+         REAL(KIND=LSRP), ALLOCATABLE :: Xp(:,:,:)
       END TYPE FSILS_lsType
 
 !####################################################################
@@ -134,7 +134,18 @@ typedef struct {
    int LS_type;            // Which one of LS             (IN)
    int Resm;               // Contribution of mom. res.   (OUT)
    int Resc;               // Contribution of cont. res.  (OUT)
+   int mixP;// = false;  // Single-precision LHS        (IN)
+   int mRef;// = 10;     // Max. refinement steps       (IN)
+   int sFrz;// = 0;      // Reuse of Schur blocks       (IN)
+   int nPrj;// = 0;      // Saved solutions for guess   (IN)
    FSILS_subLsType GM;
    FSILS_subLsType CG;
    FSILS_subLsType RI;
+   int ewFlag;// = false;// Inexact Newton tolerances   (IN)
+   int nX;// = 0;        // Number of saved solutions   (USE)
+   int iX;// = 0;        // Last saved solution         (USE)
+   double ewMax;// = 0.5;// Max. inexact Newton tol.    (IN)
+   double ewN;// = 0;    // RHS norm of last call       (USE)
+   double ewE;// = 0;    // Tolerance of last call      (USE)
+// double *Xp;           // Saved solutions             (USE)
 } FSILS_lsType;
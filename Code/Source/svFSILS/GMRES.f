@@ -113,14 +113,12 @@
                unCondU = u(:,:,i+1)
                CALL ADDBCMUL(lhs,BCOP_TYPE_PRE,dof, unCondU, u(:,:,i+1))
             END IF
-            DO j=1, i+1
-               h(j,i) = FSILS_NCDOTV(dof, mynno, u(:,:,j), u(:,:,i+1))
-            END DO
+            CALL OMPMDOTV(dof, mynNo, nNo, i+1, u, u(:,:,i+1), h(:,i))
             CALL FSILS_BCASTV(i+1, h(:,i), lhs%commu)
 
+            CALL OMPMSUMV(dof, nNo, nNo, i, -h(1:i,i), u, u(:,:,i+1))
+            !u(:,:,i+1) = u(:,:,i+1) - SUM(h(j,i)*u(:,:,j))
             DO j=1, i
-               CALL OMPSUMV(dof, nNo, -h(j,i), u(:,:,i+1), u(:,:,j))
-               !u(:,:,i+1) = u(:,:,i+1) - h(j,i)*u(:,:,j)
                h(i+1,i) = h(i+1,i) - h(j,i)*h(j,i)
             END DO
             h(i+1,i) = SQRT(ABS(h(i+1,i)))
@@ -154,10 +152,8 @@
             y(j) = y(j)/h(j,j)
          END DO
 
-         DO j=1, i
-            CALL OMPSUMV(dof, nNo, y(j), X, u(:,:,j))
-            !X = X + u(:,:,j)*y(j)
-         END DO
+         CALL OMPMSUMV(dof, nNo, nNo, i, y, u, X)
+         !X = X + SUM(u(:,:,j)*y(j))
          ls%fNorm = ABS(err(i+1))
          IF (ls%suc) EXIT
       END DO
@@ -180,13 +176,13 @@
       REAL(KIND=LSRP) eps, tmp
 
       REAL(KIND=LSRP), ALLOCATABLE :: u(:,:), h(:,:), X(:), y(:), c(:), &
-     &   s(:), err(:)
+     &   s(:), err(:), pU(:)
 
       nNo = lhs%nNo
       mynNo = lhs%mynNo
 
       ALLOCATE(h(ls%sD+1,ls%sD), u(nNo,ls%sD+1), X(nNo), y(ls%sD),      &
-     &   c(ls%sD), s(ls%sD), err(ls%sD+1))
+     &   c(ls%sD), s(ls%sD), err(ls%sD+1), pU(nNo))
 
       ls%callD  = FSILS_CPUT()
       ls%suc    = .FALSE.
@@ -212,17 +208,23 @@
          u(:,1) = u(:,1)/err(1)
          DO i=1, ls%sD
             ls%itr = ls%itr + 1
-            CALL FSILS_SPARMULSS(lhs, lhs%rowPtr, lhs%colPtr, Val,      &
-     &         u(:,i), u(:,i+1))
+!           Right preconditioning with block ILU, u = K*M^-1*u
+            IF (lhs%bPC .EQ. PRECOND_BILU) THEN
+               pU = u(:,i)
+               CALL PCILU(lhs, 1, pU)
+               CALL FSILS_SPARMULSS(lhs, lhs%rowPtr, lhs%colPtr, Val,   &
+     &            pU, u(:,i+1))
+            ELSE
+               CALL FSILS_SPARMULSS(lhs, lhs%rowPtr, lhs%colPtr, Val,   &
+     &            u(:,i), u(:,i+1))
+            END IF
 
-            DO j=1, i+1
-               h(j,i) = FSILS_NCDOTS(mynno, u(:,j), u(:,i+1))
-            END DO
+            CALL OMPMDOTV(1, mynNo, nNo, i+1, u, u(:,i+1), h(:,i))
             CALL FSILS_BCASTV(i+1, h(:,i), lhs%commu)
 
+            CALL OMPMSUMV(1, nNo, nNo, i, -h(1:i,i), u, u(:,i+1))
+            !u(:,i+1) = u(:,i+1) - SUM(h(j,i)*u(:,j))
             DO j=1, i
-               CALL OMPSUMS(nNo, -h(j,i), u(:,i+1), u(:,j))
-               !u(:,:,i+1) = u(:,:,i+1) - h(j,i)*u(:,:,j)
                h(i+1,i) = h(i+1,i) - h(j,i)*h(j,i)
             END DO
             h(i+1,i) = SQRT(ABS(h(i+1,i)))
@@ -256,10 +258,15 @@
             y(j) = y(j)/h(j,j)
          END DO
 
-         DO j=1, i
-            CALL OMPSUMS(nNo, y(j), X, u(:,j))
-            !X = X + u(:,j)*y(j)
-         END DO
+         IF (lhs%bPC .EQ. PRECOND_BILU) THEN
+            pU = 0._LSRP
+            CALL OMPMSUMV(1, nNo, nNo, i, y, u, pU)
+            CALL PCILU(lhs, 1, pU)
+            X = X + pU
+         ELSE
+            CALL OMPMSUMV(1, nNo, nNo, i, y, u, X)
+            !X = X + SUM(u(:,j)*y(j))
+         END IF
          ls%fNorm = ABS(err(i+1))
          IF (ls%suc) EXIT
       END DO
@@ -270,13 +277,21 @@
       RETURN
       END SUBROUTINE GMRESS
 !--------------------------------------------------------------------
-      SUBROUTINE GMRESV(lhs, ls, dof, Val, R)
+!     GMRES for vector problems. The LHS is applied from the assembled
+!     Val, from its single-precision copy Val4, or through MATVEC and
+!     scaled by W for the matrix-free operator; only one of these
+!     should be present.
+      SUBROUTINE GMRESV(lhs, ls, dof, R, Val, Val4, W, MATVEC)
       INCLUDE "FSILS_STD.h"
       TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
       TYPE(FSILS_subLsType), INTENT(INOUT) :: ls
       INTEGER(KIND=LSIP), INTENT(IN) :: dof
-      REAL(KIND=LSRP), INTENT(IN) :: Val(dof*dof,lhs%nnz)
       REAL(KIND=LSRP), INTENT(INOUT) :: R(dof,lhs%nNo)
+      REAL(KIND=LSRP), INTENT(IN), OPTIONAL :: Val(dof*dof,lhs%nnz),    &
+     &   W(dof,lhs%nNo)
+      REAL(KIND=LSRP4), INTENT(IN), OPTIONAL :: Val4(dof*dof,lhs%nnz)
+      EXTERNAL MATVEC
+      OPTIONAL MATVEC
 
       LOGICAL flag
       INTEGER(KIND=LSIP) nNo, mynNo, i, j, k, l
@@ -284,14 +299,16 @@
       REAL(KIND=LSRP) eps, tmp
 
       REAL(KIND=LSRP), ALLOCATABLE :: u(:,:,:), h(:,:), X(:,:), y(:),   &
-     &   c(:), s(:), err(:), unCondU(:,:)
+     &   c(:), s(:), err(:), unCondU(:,:), pU(:,:), Us(:,:), KUs(:,:)
 
       flag = .FALSE.
       nNo = lhs%nNo
       mynNo = lhs%mynNo
 
       ALLOCATE(h(ls%sD+1,ls%sD), u(dof,nNo,ls%sD+1), X(dof,nNo),        &
-     &   y(ls%sD), c(ls%sD), s(ls%sD), err(ls%sD+1), unCondU(dof,nNo))
+     &   y(ls%sD), c(ls%sD), s(ls%sD), err(ls%sD+1), unCondU(dof,nNo),  &
+     &   pU(dof,nNo))
+      IF (PRESENT(MATVEC)) ALLOCATE(Us(dof,nNo), KUs(dof,nNo))
 
       ls%callD  = FSILS_CPUT()
       ls%suc    = .FALSE.
@@ -313,8 +330,7 @@
       DO l=1, ls%mItr
          ls%dB = ls%fNorm
          ls%itr = ls%itr + 1
-         CALL FSILS_SPARMULVV(lhs, lhs%rowPtr, lhs%colPtr, dof, Val, X, &
-     &      u(:,:,1))
+         CALL KMUL(X, u(:,:,1))
          CALL ADDBCMUL(lhs, BCOP_TYPE_ADD, dof, X, u(:,:,1))
 
          u(:,:,1) = R - u(:,:,1)
@@ -326,22 +342,28 @@
          u(:,:,1) = u(:,:,1)/err(1)
          DO i=1, ls%sD
             ls%itr = ls%itr + 1
-            CALL FSILS_SPARMULVV(lhs, lhs%rowPtr, lhs%colPtr, dof, Val, &
-     &         u(:,:,i), u(:,:,i+1))
-            CALL ADDBCMUL(lhs, BCOP_TYPE_ADD, dof, u(:,:,i), u(:,:,i+1))
+!           Right preconditioning with block ILU, u = K*M^-1*u
+            IF (lhs%bPC .EQ. PRECOND_BILU) THEN
+               pU = u(:,:,i)
+               CALL PCILU(lhs, dof, pU)
+               CALL KMUL(pU, u(:,:,i+1))
+               CALL ADDBCMUL(lhs, BCOP_TYPE_ADD, dof, pU, u(:,:,i+1))
+            ELSE
+               CALL KMUL(u(:,:,i), u(:,:,i+1))
+               CALL ADDBCMUL(lhs, BCOP_TYPE_ADD, dof, u(:,:,i),         &
+     &            u(:,:,i+1))
+            END IF
 
             IF (ANY(lhs%face%coupledFlag).AND.flag) THEN
                unCondU = u(:,:,i+1)
                CALL ADDBCMUL(lhs,BCOP_TYPE_PRE,dof, unCondU, u(:,:,i+1))
             END IF
-            DO j=1, i+1
-               h(j,i) = FSILS_NCDOTV(dof, mynno, u(:,:,j), u(:,:,i+1))
-            END DO
+            CALL OMPMDOTV(dof, mynNo, nNo, i+1, u, u(:,:,i+1), h(:,i))
             CALL FSILS_BCASTV(i+1, h(:,i), lhs%commu)
 
+            CALL OMPMSUMV(dof, nNo, nNo, i, -h(1:i,i), u, u(:,:,i+1))
+!           u(:,:,i+1) = u(:,:,i+1) - SUM(h(j,i)*u(:,:,j))
             DO j=1, i
-               CALL OMPSUMV(dof, nNo, -h(j,i), u(:,:,i+1), u(:,:,j))
-!              u(:,:,i+1) = u(:,:,i+1) - h(j,i)*u(:,:,j)
                h(i+1,i) = h(i+1,i) - h(j,i)*h(j,i)
             END DO
             h(i+1,i) = SQRT(ABS(h(i+1,i)))
@@ -375,10 +397,15 @@
             y(j) = y(j)/h(j,j)
          END DO
 
-         DO j=1, i
-            CALL OMPSUMV(dof, nNo, y(j), X, u(:,:,j))
-            !X = X + u(:,:,j)*y(j)
-         END DO
+         IF (lhs%bPC .EQ. PRECOND_BILU) THEN
+            pU = 0._LSRP
+            CALL OMPMSUMV(dof, nNo, nNo, i, y, u, pU)
+            CALL PCILU(lhs, dof, pU)
+            X = X + pU
+         ELSE
+            CALL OMPMSUMV(dof, nNo, nNo, i, y, u, X)
+            !X = X + SUM(u(:,:,j)*y(j))
+         END IF
          ls%fNorm = ABS(err(i+1))
          IF (ls%suc) EXIT
       END DO
@@ -389,6 +416,42 @@
       RETURN
 
       CONTAINS
+!--------------------------------------------------------------------
+!     KU = K*U, either from Val, from Val4 or from the scaled
+!     matrix-free operator, W*K*W*U, where K*U is evaluated by MATVEC
+!     in the caller's ordering
+      SUBROUTINE KMUL(U, KU)
+      IMPLICIT NONE
+      REAL(KIND=LSRP), INTENT(IN) :: U(dof,nNo)
+      REAL(KIND=LSRP), INTENT(OUT) :: KU(dof,nNo)
+
+      INTEGER(KIND=LSIP) a, Ac
+
+      IF (PRESENT(Val)) THEN
+         CALL FSILS_SPARMULVV(lhs, lhs%rowPtr, lhs%colPtr, dof, Val, U, &
+     &      KU)
+         RETURN
+      ELSE IF (PRESENT(Val4)) THEN
+         CALL FSILS_SPARMULVV4(lhs, lhs%rowPtr, lhs%colPtr, dof, Val4,  &
+     &      U, KU)
+         RETURN
+      END IF
+
+      DO a=1, nNo
+         Ac = lhs%map(a)
+         Us(:,a) = W(:,Ac)*U(:,Ac)
+      END DO
+
+      CALL MATVEC(dof, nNo, Us, KUs)
+
+      DO a=1, nNo
+         KU(:,lhs%map(a)) = KUs(:,a)
+      END DO
+      CALL FSILS_COMMUV(lhs, dof, KU)
+      KU = W*KU
+
+      RETURN
+      END SUBROUTINE KMUL
 !--------------------------------------------------------------------
       SUBROUTINE BCPRE
       IMPLICIT NONE
@@ -511,6 +511,8 @@
       lhs%nNo    = 0
       lhs%nnz    = 0
       lhs%nFaces = 0
+      lhs%sAge   = 0
+      lhs%bPC    = 0
 
       IF (ALLOCATED(lhs%colPtr)) DEALLOCATE(lhs%colPtr)
       IF (ALLOCATED(lhs%rowPtr)) DEALLOCATE(lhs%rowPtr)
@@ -518,6 +520,19 @@
       IF (ALLOCATED(lhs%cS)) DEALLOCATE(lhs%cS)
       IF (ALLOCATED(lhs%map)) DEALLOCATE(lhs%map)
       IF (ALLOCATED(lhs%face)) DEALLOCATE(lhs%face)
+      IF (ALLOCATED(lhs%tPtr)) DEALLOCATE(lhs%tPtr)
+      IF (ALLOCATED(lhs%mK)) DEALLOCATE(lhs%mK)
+      IF (ALLOCATED(lhs%mG)) DEALLOCATE(lhs%mG)
+      IF (ALLOCATED(lhs%mD)) DEALLOCATE(lhs%mD)
+      IF (ALLOCATED(lhs%mL)) DEALLOCATE(lhs%mL)
+      IF (ALLOCATED(lhs%Gt)) DEALLOCATE(lhs%Gt)
+      IF (ALLOCATED(lhs%sG)) DEALLOCATE(lhs%sG)
+      IF (ALLOCATED(lhs%sL)) DEALLOCATE(lhs%sL)
+      IF (ALLOCATED(lhs%pcV)) DEALLOCATE(lhs%pcV)
+      IF (ALLOCATED(lhs%lLv)) DEALLOCATE(lhs%lLv)
+      IF (ALLOCATED(lhs%lNd)) DEALLOCATE(lhs%lNd)
+      IF (ALLOCATED(lhs%uLv)) DEALLOCATE(lhs%uLv)
+      IF (ALLOCATED(lhs%uNd)) DEALLOCATE(lhs%uNd)
 
       RETURN
       END SUBROUTINE FSILS_LHS_FREE
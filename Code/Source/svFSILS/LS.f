@@ -128,6 +128,9 @@
       END IF
 
       ls%foC  = .FALSE.
+      ls%nX   = 0
+      ls%iX   = 0
+      IF (ALLOCATED(ls%Xp)) DEALLOCATE(ls%Xp)
 
       RETURN
       END SUBROUTINE FSILS_LS_FREE
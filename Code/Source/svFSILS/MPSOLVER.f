@@ -0,0 +1,118 @@
+!--------------------------------------------------------------------
+!     Created by Mahdi Esmaily Moghadam
+!     contact memt63@gmail.com for reporting the bugs.
+!--------------------------------------------------------------------
+!
+!     UC Copyright Notice
+!     This software is Copyright ©2012 The Regents of the University of
+!     California. All Rights Reserved.
+!
+!     Permission to copy and modify this software and its documentation
+!     for educational, research and non-profit purposes, without fee,
+!     and without a written agreement is hereby granted, provided that
+!     the above copyright notice, this paragraph and the following three
+!     paragraphs appear in all copies.
+!
+!     Permission to make commercial use of this software may be obtained
+!     by contacting:
+!     Technology Transfer Office
+!     9500 Gilman Drive, Mail Code 0910
+!     University of California
+!     La Jolla, CA 92093-0910
+!     (858) 534-5815
+!     invent@ucsd.edu
+!
+!     This software program and documentation are copyrighted by The
+!     Regents of the University of California. The software program and
+!     documentation are supplied "as is", without any accompanying
+!     services from The Regents. The Regents does not warrant that the
+!     operation of the program will be uninterrupted or error-free. The
+!     end-user understands that the program was developed for research
+!     purposes and is advised not to rely exclusively on the program for
+!     any reason.
+!
+!     IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY
+!     PARTY FOR DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL
+!     DAMAGES, INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS
+!     SOFTWARE AND ITS DOCUMENTATION, EVEN IF THE UNIVERSITY OF
+!     CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!     THE UNIVERSITY OF CALIFORNIA SPECIFICALLY DISCLAIMS ANY
+!     WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+!     OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. THE
+!     SOFTWARE PROVIDED HEREUNDER IS ON AN "AS IS" BASIS, AND THE
+!     UNIVERSITY OF CALIFORNIA HAS NO OBLIGATIONS TO PROVIDE
+!     MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+!
+!--------------------------------------------------------------------
+!     Mixed-precision solver: the Krylov iterations (GMRES or CG) use a
+!     single-precision copy of the preconditioned LHS, and the solution
+!     is corrected by iterative refinement, with the residual computed
+!     from the double-precision LHS.
+!--------------------------------------------------------------------
+
+      SUBROUTINE MPSOLVER(lhs, ls, dof, Val, R)
+      INCLUDE "FSILS_STD.h"
+      INCLUDE "FSILS_KRYLOV.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      TYPE(FSILS_lsType), INTENT(INOUT) :: ls
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof
+      REAL(KIND=LSRP), INTENT(IN) :: Val(dof*dof,lhs%nnz)
+      REAL(KIND=LSRP), INTENT(INOUT) :: R(dof,lhs%nNo)
+
+      INTEGER(KIND=LSIP) nNo, mynNo, iRef, itr
+      REAL(KIND=LSRP) FSILS_CPUT, FSILS_NORMV
+      REAL(KIND=LSRP) eps, iNorm, callD
+
+      REAL(KIND=LSRP4), ALLOCATABLE :: Val4(:,:)
+      REAL(KIND=LSRP), ALLOCATABLE :: X(:,:), Rr(:,:), KX(:,:)
+
+      nNo   = lhs%nNo
+      mynNo = lhs%mynNo
+
+      ALLOCATE(Val4(dof*dof,lhs%nnz), X(dof,nNo), Rr(dof,nNo),          &
+     &   KX(dof,nNo))
+
+      callD = FSILS_CPUT()
+      Val4  = REAL(Val, KIND=LSRP4)
+      iNorm = FSILS_NORMV(dof, mynNo, lhs%commu, R)
+      eps   = MAX(ls%RI%absTol,ls%RI%relTol*iNorm)
+      itr   = 0
+      X     = 0._LSRP
+      Rr    = R
+
+      DO iRef=1, ls%mRef
+!     Correction from the single-precision LHS
+         IF (ls%LS_type .EQ. LS_TYPE_GMRES) THEN
+            CALL GMRESV(lhs, ls%RI, dof, Rr, Val4=Val4)
+         ELSE
+            CALL CGRADV(lhs, ls%RI, dof, Rr, K4=Val4)
+         END IF
+         itr = itr + ls%RI%itr
+         CALL OMPSUMV(dof, nNo, 1._LSRP, X, Rr)
+
+!     Residual of the corrected solution from the double-precision LHS
+         CALL FSILS_SPARMULVV(lhs, lhs%rowPtr, lhs%colPtr, dof, Val, X, &
+     &      KX)
+         IF (ls%LS_type .EQ. LS_TYPE_GMRES)                             &
+     &      CALL ADDBCMUL(lhs, BCOP_TYPE_ADD, dof, X, KX)
+         Rr = R - KX
+         ls%RI%fNorm = FSILS_NORMV(dof, mynNo, lhs%commu, Rr)
+         IF (ls%RI%fNorm .LE. eps) EXIT
+      END DO
+
+      R           = X
+      ls%RI%suc   = ls%RI%fNorm .LE. eps
+      ls%RI%itr   = itr
+      ls%RI%iNorm = iNorm
+      ls%RI%callD = FSILS_CPUT() - callD
+      IF (ls%RI%fNorm .GT. 0._LSRP) THEN
+         ls%RI%dB = 10._LSRP*LOG(ls%RI%fNorm/iNorm)
+      ELSE
+         ls%RI%dB = 0._LSRP
+      END IF
+
+      DEALLOCATE(Val4, X, Rr, KX)
+
+      RETURN
+      END SUBROUTINE MPSOLVER
+!####################################################################
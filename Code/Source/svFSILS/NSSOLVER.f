@@ -64,8 +64,7 @@
 
       REAL(KIND=LSRP), ALLOCATABLE :: U(:,:,:), P(:,:), MU(:,:,:),      &
      &   MP(:,:), A(:,:), tmp(:), tmpG(:), B(:), xB(:), oldxB(:),       &
-     &   mK(:,:), mG(:,:), mD(:,:), mL(:), Gt(:,:), Rm(:,:), Rc(:),     &
-     &   Rmi(:,:), Rci(:)
+     &   Rm(:,:), Rc(:), Rmi(:,:), Rci(:), Gm(:,:), Gc(:,:)
 
       nNo = lhs%nNo
       nnz = lhs%nnz
@@ -76,7 +75,7 @@
       ALLOCATE(Rm(nsd,nNo), Rc(nNo), Rmi(nsd,nNo), Rci(nNo),            &
      &   U(nsd,nNo,iB), P(nNo,iB), MU(nsd,nNo,nB), MP(nNo,nB),          &
      &   tmp(nB*nB+nB), tmpG(nB*nB+nB), A(nB,nB), B(nB), xB(nB),        &
-     &   oldxB(nB))
+     &   oldxB(nB), Gm(3,nB), Gc(3,nB))
 
       Rmi = Ri(1:nsd,:)
       Rci = Ri(dof,:)
@@ -99,6 +98,7 @@
       eps         = MAX(ls%RI%absTol,ls%RI%relTol*eps)
 
       CALL DEPART
+      CALL SCHURPRE
       CALL BCPRE
 
       DO i=1, ls%RI%mItr
@@ -107,42 +107,51 @@
          ls%RI%dB = ls%RI%fNorm
 
 !        U  = K^-1*Rm
-         CALL GMRES(lhs, ls%GM, nsd, mK, Rm, U(:,:,i))
+         CALL GMRES(lhs, ls%GM, nsd, lhs%mK, Rm, U(:,:,i))
 !        P  = D*U
-         CALL FSILS_SPARMULVS(lhs, lhs%rowPtr, lhs%colPtr, nsd, mD,     &
+         CALL FSILS_SPARMULVS(lhs, lhs%rowPtr, lhs%colPtr, nsd, lhs%mD, &
      &      U(:,:,i), P(:,i))
 !        P  = Rc - P
          P(:,i) = Rc - P(:,i)
 !        P  = [L + G^t*G]^-1*P
-         CALL CGRAD_SCHUR(lhs, ls%CG, nsd, Gt, mG, mL, P(:,i))
+         IF (ls%sFrz .GT. 0) THEN
+            CALL CGRAD_SCHUR(lhs, ls%CG, nsd, lhs%Gt, lhs%sG, lhs%sL,   &
+     &         P(:,i))
+         ELSE
+            CALL CGRAD_SCHUR(lhs, ls%CG, nsd, lhs%Gt, lhs%mG, lhs%mL,   &
+     &         P(:,i))
+         END IF
 !        MU1 = G*P
-         CALL FSILS_SPARMULSV(lhs, lhs%rowPtr, lhs%colPtr, nsd, mG,     &
+         CALL FSILS_SPARMULSV(lhs, lhs%rowPtr, lhs%colPtr, nsd, lhs%mG, &
      &      P(:,i), MU(:,:,iB))
 !        MU2 = Rm - G*P
          MU(:,:,iBB) = Rm - MU(:,:,iB)
 !        U  = K^-1*[Rm - G*P]
-         CALL GMRES(lhs, ls%GM, nsd, mK, MU(:,:,iBB), U(:,:,i))
+         CALL GMRES(lhs, ls%GM, nsd, lhs%mK, MU(:,:,iBB), U(:,:,i))
 !        MU2 = K*U
-         CALL FSILS_SPARMULVV(lhs, lhs%rowPtr, lhs%colPtr, nsd, mK,     &
+         CALL FSILS_SPARMULVV(lhs, lhs%rowPtr, lhs%colPtr, nsd, lhs%mK, &
      &      U(:,:,i), MU(:,:,iBB))
          CALL ADDBCMUL(lhs, BCOP_TYPE_ADD, nsd, U(:,:,i), MU(:,:,iBB))
 !        MP1 = L*P
-         CALL FSILS_SPARMULSS(lhs, lhs%rowPtr, lhs%colPtr, mL, P(:,i),  &
-     &      MP(:,iB))
+         CALL FSILS_SPARMULSS(lhs, lhs%rowPtr, lhs%colPtr, lhs%mL,      &
+     &      P(:,i), MP(:,iB))
 !        MP2 = D*U
-         CALL FSILS_SPARMULVS(lhs, lhs%rowPtr, lhs%colPtr, nsd, mD,     &
+         CALL FSILS_SPARMULVS(lhs, lhs%rowPtr, lhs%colPtr, nsd, lhs%mD, &
      &      U(:,:,i), MP(:,iBB))
 
+!        Inner products of the two new columns with all previous ones
+!        and with the RHS, one pass over MU and one over MP
+         CALL OMPGRAMV(nsd, mynNo, nNo, iBB, 2, MU, MU(:,:,iB:iBB),     &
+     &      Rmi, Gm)
+         CALL OMPGRAMV(1, mynNo, nNo, iBB, 2, MP, MP(:,iB:iBB), Rci, Gc)
          c = 0
          DO k=iB, iBB
             DO j=1, k
                c = c + 1
-               tmp(c) = FSILS_NCDOTV(nsd, mynNo, MU(:,:,j), MU(:,:,k))  &
-     &                + FSILS_NCDOTS(     mynNo, MP(:,j),   MP(:,k))
+               tmp(c) = Gm(k-iB+1,j) + Gc(k-iB+1,j)
             END DO
             c = c + 1
-            tmp(c) = FSILS_NCDOTV(nsd, mynNo, MU(:,:,k), Rmi)           &
-     &             + FSILS_NCDOTS(     mynNo,  MP(:,k),  Rci)
+            tmp(c) = Gm(3,k) + Gc(3,k)
          END DO
          IF (lhs%commu%nTasks .GT. 1) THEN
             CALL MPI_ALLREDUCE(tmp, tmpG, c, mpreal, MPI_SUM,           &
@@ -180,22 +189,20 @@
             EXIT
          END IF
 
-         Rm = Rmi - xB(1)*MU(:,:,1)
-         Rc = Rci - xB(1)*MP(:,1)
-         DO j=2, iBB
-            Rm = Rm - xB(j)*MU(:,:,j)
-            Rc = Rc - xB(j)*MP(:,j)
-         END DO
+         Rm = Rmi
+         Rc = Rci
+         CALL OMPMSUMV(nsd, nNo, nNo, iBB, -xB, MU, Rm)
+         CALL OMPMSUMV(1, nNo, nNo, iBB, -xB, MP, Rc)
+         !Rm = Rmi - SUM(xB(j)*MU(:,:,j))
+         !Rc = Rci - SUM(xB(j)*MP(:,j))
       END DO
       IF (i .GT. ls%RI%mItr) THEN
          ls%RI%itr = ls%RI%mItr
       ELSE
          ls%RI%itr = i
 
-         Rc = Rci - xB(1)*MP(:,1)
-         DO j=2, iBB
-            Rc = Rc - xB(j)*MP(:,j)
-         END DO
+         Rc = Rci
+         CALL OMPMSUMV(1, nNo, nNo, iBB, -xB, MP, Rc)
       END IF
       ls%Resc = NINT(100._LSRP*FSILS_NORMS(mynNo, lhs%commu,            &
      &   Rc)**2._LSRP / ls%RI%fNorm, KIND=LSIP)
@@ -224,7 +231,7 @@
      &        " (likely due to the ill-conditioned LHS matrix)"
          END IF
       END IF
-      ls%RI%fNorm = SQRT(ls%RI%fNorm)
+      ls%RI%fNorm = SQRT(MAX(ls%RI%fNorm, 0._LSRP))
 
       Ri(1:nsd,:) = Rmi
       Ri(dof,:) = Rci
@@ -234,75 +241,112 @@
       RETURN
       CONTAINS
 !--------------------------------------------------------------------
+!     Splits Val into the K, G, D and L blocks, kept in lhs so that they
+!     are only allocated once
       SUBROUTINE DEPART
       IMPLICIT NONE
 
-      INTEGER(KIND=LSIP) i, j, k, l
-      REAL(KIND=LSRP), ALLOCATABLE :: tmp(:)
+      INTEGER(KIND=LSIP) i
 
-      ALLOCATE(mK(nsd*nsd,nnz), mG(nsd,nnz), mD(nsd,nnz), mL(nnz),      &
-     &   Gt(nsd,nnz), tmp((nsd+1)*(nsd+1)))
+      IF (.NOT.ALLOCATED(lhs%mK)) ALLOCATE(lhs%mK(nsd*nsd,nnz),         &
+     &   lhs%mG(nsd,nnz), lhs%mD(nsd,nnz), lhs%mL(nnz))
 
       IF (nsd .EQ. 2) THEN
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i) SCHEDULE(STATIC)
          DO i=1, nnz
-            tmp = Val(:,i)
+            lhs%mK(1,i) = Val(1,i)
+            lhs%mK(2,i) = Val(2,i)
+            lhs%mK(3,i) = Val(4,i)
+            lhs%mK(4,i) = Val(5,i)
 
-            mK(1,i) = tmp(1)
-            mK(2,i) = tmp(2)
-            mK(3,i) = tmp(4)
-            mK(4,i) = tmp(5)
+            lhs%mG(1,i) = Val(3,i)
+            lhs%mG(2,i) = Val(6,i)
 
-            mG(1,i) = tmp(3)
-            mG(2,i) = tmp(6)
+            lhs%mD(1,i) = Val(7,i)
+            lhs%mD(2,i) = Val(8,i)
 
-            mD(1,i) = tmp(7)
-            mD(2,i) = tmp(8)
-
-            mL(i)   = tmp(9)
+            lhs%mL(i)   = Val(9,i)
          END DO
+!$OMP END PARALLEL DO
       ELSE IF(nsd .EQ. 3) THEN
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i) SCHEDULE(STATIC)
          DO i=1, nnz
-            tmp = Val(:,i)
-
-            mK(1,i) = tmp(1)
-            mK(2,i) = tmp(2)
-            mK(3,i) = tmp(3)
-            mK(4,i) = tmp(5)
-            mK(5,i) = tmp(6)
-            mK(6,i) = tmp(7)
-            mK(7,i) = tmp(9)
-            mK(8,i) = tmp(10)
-            mK(9,i) = tmp(11)
-
-            mG(1,i) = tmp(4)
-            mG(2,i) = tmp(8)
-            mG(3,i) = tmp(12)
-
-            mD(1,i) = tmp(13)
-            mD(2,i) = tmp(14)
-            mD(3,i) = tmp(15)
-
-            mL(i)   = tmp(16)
+            lhs%mK(1,i) = Val(1,i)
+            lhs%mK(2,i) = Val(2,i)
+            lhs%mK(3,i) = Val(3,i)
+            lhs%mK(4,i) = Val(5,i)
+            lhs%mK(5,i) = Val(6,i)
+            lhs%mK(6,i) = Val(7,i)
+            lhs%mK(7,i) = Val(9,i)
+            lhs%mK(8,i) = Val(10,i)
+            lhs%mK(9,i) = Val(11,i)
+
+            lhs%mG(1,i) = Val(4,i)
+            lhs%mG(2,i) = Val(8,i)
+            lhs%mG(3,i) = Val(12,i)
+
+            lhs%mD(1,i) = Val(13,i)
+            lhs%mD(2,i) = Val(14,i)
+            lhs%mD(3,i) = Val(15,i)
+
+            lhs%mL(i)   = Val(16,i)
          END DO
+!$OMP END PARALLEL DO
       ELSE
          PRINT *, "FSILS: Not defined nsd for DEPART", nsd
          STOP "FSILS: FATAL ERROR"
       END IF
 
-      DO i=1, nNo
-         Do j=lhs%rowPtr(1,i), lhs%rowPtr(2,i)
-            k = lhs%colPtr(j)
-            DO l=lhs%rowPtr(1,k), lhs%rowPtr(2,k)
-               IF (lhs%colPtr(l) .EQ. i) THEN
-                  Gt(:,l) = -mG(:,j)
-                  EXIT
-               END IF
+      RETURN
+      END SUBROUTINE DEPART
+!--------------------------------------------------------------------
+!     Forms Gt = -G^t for the Schur complement. With ls%sFrz > 0, Gt and
+!     copies of G and L are kept and reused for ls%sFrz more calls.
+      SUBROUTINE SCHURPRE
+      IMPLICIT NONE
+
+      INTEGER(KIND=LSIP) i, j, k, l
+
+      IF (ALLOCATED(lhs%Gt) .AND. lhs%sAge.LT.ls%sFrz) THEN
+         lhs%sAge = lhs%sAge + 1
+         RETURN
+      END IF
+      lhs%sAge = 0
+
+!     Position of the transposed entries, which only depends on the
+!     sparsity pattern
+      IF (.NOT.ALLOCATED(lhs%tPtr)) THEN
+         ALLOCATE(lhs%tPtr(nnz))
+         lhs%tPtr = 0
+         DO i=1, nNo
+            DO j=lhs%rowPtr(1,i), lhs%rowPtr(2,i)
+               k = lhs%colPtr(j)
+               DO l=lhs%rowPtr(1,k), lhs%rowPtr(2,k)
+                  IF (lhs%colPtr(l) .EQ. i) THEN
+                     lhs%tPtr(j) = l
+                     EXIT
+                  END IF
+               END DO
             END DO
          END DO
+      END IF
+
+      IF (.NOT.ALLOCATED(lhs%Gt)) ALLOCATE(lhs%Gt(nsd,nnz))
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(j) SCHEDULE(STATIC)
+      DO j=1, nnz
+         IF (lhs%tPtr(j) .NE. 0) lhs%Gt(:,lhs%tPtr(j)) = -lhs%mG(:,j)
       END DO
+!$OMP END PARALLEL DO
+
+      IF (ls%sFrz .GT. 0) THEN
+         IF (.NOT.ALLOCATED(lhs%sG)) ALLOCATE(lhs%sG(nsd,nnz),          &
+     &      lhs%sL(nnz))
+         lhs%sG = lhs%mG
+         lhs%sL = lhs%mL
+      END IF
 
       RETURN
-      END SUBROUTINE DEPART
+      END SUBROUTINE SCHURPRE
 !--------------------------------------------------------------------
       SUBROUTINE BCPRE
       IMPLICIT NONE
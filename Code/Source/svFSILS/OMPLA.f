@@ -181,3 +181,228 @@
       RETURN
       END SUBROUTINE OMPMULV
 !####################################################################
+!     Fused kernels. Each one replaces several of the passes above by a
+!     single pass over the vectors. Sums are local to this process and
+!     over the first mynNo (owned) nodes only; they are to be added up
+!     across processes by the caller with FSILS_BCASTV.
+!--------------------------------------------------------------------
+!     U = V + r*U
+      SUBROUTINE OMPXPAYV (dof, nNo, r, U, V)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof, nNo
+      REAL(KIND=LSRP), INTENT(IN) :: r, V(dof,nNo)
+      REAL(KIND=LSRP), INTENT(INOUT) :: U(dof,nNo)
+
+      INTEGER(KIND=LSIP) i, j
+
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i, j) SCHEDULE(GUIDED)
+      DO i=1, nNo
+         DO j=1, dof
+            U(j,i) = V(j,i) + r*U(j,i)
+         END DO
+      END DO
+!$OMP END PARALLEL DO
+
+      RETURN
+      END SUBROUTINE OMPXPAYV
+!--------------------------------------------------------------------
+!     CG update: X = X + a*P, R = R - a*KP and s = |R|^2
+      SUBROUTINE OMPCGUPDV (dof, nNo, mynNo, a, X, P, R, KP, s)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof, nNo, mynNo
+      REAL(KIND=LSRP), INTENT(IN) :: a, P(dof,nNo), KP(dof,nNo)
+      REAL(KIND=LSRP), INTENT(INOUT) :: X(dof,nNo), R(dof,nNo)
+      REAL(KIND=LSRP), INTENT(OUT) :: s
+
+      INTEGER(KIND=LSIP) i, j
+
+      s = 0._LSRP
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i, j) SCHEDULE(STATIC)
+!$OMP&   REDUCTION(+:s)
+      DO i=1, nNo
+         DO j=1, dof
+            X(j,i) = X(j,i) + a*P(j,i)
+            R(j,i) = R(j,i) - a*KP(j,i)
+         END DO
+         IF (i .LE. mynNo) THEN
+            DO j=1, dof
+               s = s + R(j,i)*R(j,i)
+            END DO
+         END IF
+      END DO
+!$OMP END PARALLEL DO
+
+      RETURN
+      END SUBROUTINE OMPCGUPDV
+!--------------------------------------------------------------------
+!     BiCGStab update: X = X + a*P + w*S, R = S - w*T, s(1) = |R|^2 and
+!     s(2) = <R,Rh>
+      SUBROUTINE OMPBICGUPDV (dof, nNo, mynNo, a, w, X, P, S, T, R, Rh, &
+     &   res)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof, nNo, mynNo
+      REAL(KIND=LSRP), INTENT(IN) :: a, w, P(dof,nNo), S(dof,nNo),      &
+     &   T(dof,nNo), Rh(dof,nNo)
+      REAL(KIND=LSRP), INTENT(INOUT) :: X(dof,nNo), R(dof,nNo)
+      REAL(KIND=LSRP), INTENT(OUT) :: res(2)
+
+      INTEGER(KIND=LSIP) i, j
+      REAL(KIND=LSRP) s1, s2
+
+      s1 = 0._LSRP
+      s2 = 0._LSRP
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i, j) SCHEDULE(STATIC)
+!$OMP&   REDUCTION(+:s1, s2)
+      DO i=1, nNo
+         DO j=1, dof
+            X(j,i) = X(j,i) + a*P(j,i) + w*S(j,i)
+            R(j,i) = S(j,i) - w*T(j,i)
+         END DO
+         IF (i .LE. mynNo) THEN
+            DO j=1, dof
+               s1 = s1 + R(j,i)*R(j,i)
+               s2 = s2 + R(j,i)*Rh(j,i)
+            END DO
+         END IF
+      END DO
+!$OMP END PARALLEL DO
+      res(1) = s1
+      res(2) = s2
+
+      RETURN
+      END SUBROUTINE OMPBICGUPDV
+!--------------------------------------------------------------------
+!     Two dot products sharing a vector: res(1) = <U,V>, res(2) = <U,W>
+      SUBROUTINE OMPDOT2V (dof, nNo, U, V, W, res)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof, nNo
+      REAL(KIND=LSRP), INTENT(IN) :: U(dof,nNo), V(dof,nNo), W(dof,nNo)
+      REAL(KIND=LSRP), INTENT(OUT) :: res(2)
+
+      INTEGER(KIND=LSIP) i, j
+      REAL(KIND=LSRP) s1, s2
+
+      s1 = 0._LSRP
+      s2 = 0._LSRP
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i, j) SCHEDULE(STATIC)
+!$OMP&   REDUCTION(+:s1, s2)
+      DO i=1, nNo
+         DO j=1, dof
+            s1 = s1 + U(j,i)*V(j,i)
+            s2 = s2 + U(j,i)*W(j,i)
+         END DO
+      END DO
+!$OMP END PARALLEL DO
+      res(1) = s1
+      res(2) = s2
+
+      RETURN
+      END SUBROUTINE OMPDOT2V
+!--------------------------------------------------------------------
+!     Multi-vector dot product, res(k) = <U(:,:,k),V> for k=1,nV, as
+!     needed by classical Gram-Schmidt. Nodes are processed in blocks
+!     so that the block of V stays in cache while the nV vectors are
+!     streamed through, and every vector is read once. tnNo is the
+!     leading dimension of U and V.
+      SUBROUTINE OMPMDOTV (dof, nNo, tnNo, nV, U, V, res)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof, nNo, tnNo, nV
+      REAL(KIND=LSRP), INTENT(IN) :: U(dof,tnNo,nV), V(dof,tnNo)
+      REAL(KIND=LSRP), INTENT(OUT) :: res(nV)
+
+      INTEGER(KIND=LSIP), PARAMETER :: nBlk = 512
+      INTEGER(KIND=LSIP) i, j, k, s, e
+      REAL(KIND=LSRP) tmp
+
+      res = 0._LSRP
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i, j, k, s, e, tmp)
+!$OMP&   SCHEDULE(STATIC) REDUCTION(+:res)
+      DO s=1, nNo, nBlk
+         e = MIN(s+nBlk-1, nNo)
+         DO k=1, nV
+            tmp = 0._LSRP
+            DO i=s, e
+               DO j=1, dof
+                  tmp = tmp + U(j,i,k)*V(j,i)
+               END DO
+            END DO
+            res(k) = res(k) + tmp
+         END DO
+      END DO
+!$OMP END PARALLEL DO
+
+      RETURN
+      END SUBROUTINE OMPMDOTV
+!--------------------------------------------------------------------
+!     Blocked Gram kernel, G(k,l) = <W(:,:,k),U(:,:,l)> for k=1,nW and
+!     G(nW+1,l) = <V,U(:,:,l)>, l=1,nV. Within a block of nodes the nW+1
+!     right-hand vectors stay in cache while U is streamed through once,
+!     so the full set of inner products costs a single pass.
+      SUBROUTINE OMPGRAMV (dof, nNo, tnNo, nV, nW, U, W, V, G)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof, nNo, tnNo, nV, nW
+      REAL(KIND=LSRP), INTENT(IN) :: U(dof,tnNo,nV), W(dof,tnNo,nW),    &
+     &   V(dof,tnNo)
+      REAL(KIND=LSRP), INTENT(OUT) :: G(nW+1,nV)
+
+      INTEGER(KIND=LSIP), PARAMETER :: nBlk = 512
+      INTEGER(KIND=LSIP) i, j, k, l, s, e
+      REAL(KIND=LSRP) tmp
+
+      G = 0._LSRP
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i, j, k, l, s, e, tmp)
+!$OMP&   SCHEDULE(STATIC) REDUCTION(+:G)
+      DO s=1, nNo, nBlk
+         e = MIN(s+nBlk-1, nNo)
+         DO l=1, nV
+            DO k=1, nW
+               tmp = 0._LSRP
+               DO i=s, e
+                  DO j=1, dof
+                     tmp = tmp + U(j,i,l)*W(j,i,k)
+                  END DO
+               END DO
+               G(k,l) = G(k,l) + tmp
+            END DO
+            tmp = 0._LSRP
+            DO i=s, e
+               DO j=1, dof
+                  tmp = tmp + U(j,i,l)*V(j,i)
+               END DO
+            END DO
+            G(nW+1,l) = G(nW+1,l) + tmp
+         END DO
+      END DO
+!$OMP END PARALLEL DO
+
+      RETURN
+      END SUBROUTINE OMPGRAMV
+!--------------------------------------------------------------------
+!     Multi-vector update, V = V + sum_k r(k)*U(:,:,k), blocked in the
+!     same way as OMPMDOTV
+      SUBROUTINE OMPMSUMV (dof, nNo, tnNo, nV, r, U, V)
+      INCLUDE "FSILS_STD.h"
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof, nNo, tnNo, nV
+      REAL(KIND=LSRP), INTENT(IN) :: r(nV), U(dof,tnNo,nV)
+      REAL(KIND=LSRP), INTENT(INOUT) :: V(dof,tnNo)
+
+      INTEGER(KIND=LSIP), PARAMETER :: nBlk = 512
+      INTEGER(KIND=LSIP) i, j, k, s, e
+
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i, j, k, s, e)
+!$OMP&   SCHEDULE(STATIC)
+      DO s=1, nNo, nBlk
+         e = MIN(s+nBlk-1, nNo)
+         DO k=1, nV
+            DO i=s, e
+               DO j=1, dof
+                  V(j,i) = V(j,i) + r(k)*U(j,i,k)
+               END DO
+            END DO
+         END DO
+      END DO
+!$OMP END PARALLEL DO
+
+      RETURN
+      END SUBROUTINE OMPMSUMV
+!####################################################################
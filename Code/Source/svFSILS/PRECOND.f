@@ -144,6 +144,58 @@
       RETURN
       END SUBROUTINE PRECONDDIAG
 
+!--------------------------------------------------------------------
+!     Diagonal preconditioner when the LHS is not assembled. On input
+!     W holds the diagonal of the LHS, on output it is the scaling that
+!     PRECONDDIAG would have applied to Val. R is scaled the same way.
+!--------------------------------------------------------------------
+      SUBROUTINE PRECONDMF(lhs, dof, R, W)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof
+      REAL(KIND=LSRP), INTENT(INOUT) :: R(dof,lhs%nNo), W(dof,lhs%nNo)
+
+      INTEGER(KIND=LSIP) nNo, i, a, Ac, faIn
+
+      nNo = lhs%nNo
+
+      CALL FSILS_COMMUV(lhs, dof, W)
+
+      DO Ac=1, nNo
+         DO i=1, dof
+            IF (W(i,Ac) .EQ. 0._LSRP) W(i,Ac) = 1._LSRP
+         END DO
+      END DO
+
+      W = 1._LSRP/SQRT(ABS(W))
+      DO faIn=1, lhs%nFaces
+         IF (.NOT.lhs%face(faIn)%incFlag) CYCLE
+         i = MIN(lhs%face(faIn)%dof,dof)
+         IF (lhs%face(faIn)%bGrp .EQ. BC_TYPE_Dir) THEN
+            DO a=1, lhs%face(faIn)%nNo
+               Ac = lhs%face(faIn)%glob(a)
+               W(1:i,Ac) = W(1:i,Ac)*lhs%face(faIn)%val(1:i,a)
+            END DO
+         END IF
+      END DO
+
+      R = W*R
+
+      DO faIn=1, lhs%nFaces
+         IF (lhs%face(faIn)%coupledFlag) THEN
+            DO a=1, lhs%face(faIn)%nNo
+               Ac = lhs%face(faIn)%glob(a)
+               DO i=1, MIN(lhs%face(faIn)%dof,dof)
+                  lhs%face(faIn)%valM(i,a) =                            &
+     &               lhs%face(faIn)%val(i,a)*W(i,Ac)
+               END DO
+            END DO
+         END IF
+      END DO
+
+      RETURN
+      END SUBROUTINE PRECONDMF
+
 !--------------------------------------------------------------------
 !     Row and column preconditioner, to precondition both LHS and RHS.
 !--------------------------------------------------------------------
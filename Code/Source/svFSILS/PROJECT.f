@@ -0,0 +1,142 @@
+!--------------------------------------------------------------------
+!     Created by Mahdi Esmaily Moghadam
+!     contact memt63@gmail.com for reporting the bugs.
+!--------------------------------------------------------------------
+!
+!     UC Copyright Notice
+!     This software is Copyright ©2012 The Regents of the University of
+!     California. All Rights Reserved.
+!
+!     Permission to copy and modify this software and its documentation
+!     for educational, research and non-profit purposes, without fee,
+!     and without a written agreement is hereby granted, provided that
+!     the above copyright notice, this paragraph and the following three
+!     paragraphs appear in all copies.
+!
+!     Permission to make commercial use of this software may be obtained
+!     by contacting:
+!     Technology Transfer Office
+!     9500 Gilman Drive, Mail Code 0910
+!     University of California
+!     La Jolla, CA 92093-0910
+!     (858) 534-5815
+!     invent@ucsd.edu
+!
+!     This software program and documentation are copyrighted by The
+!     Regents of the University of California. The software program and
+!     documentation are supplied "as is", without any accompanying
+!     services from The Regents. The Regents does not warrant that the
+!     operation of the program will be uninterrupted or error-free. The
+!     end-user understands that the program was developed for research
+!     purposes and is advised not to rely exclusively on the program for
+!     any reason.
+!
+!     IN NO EVENT SHALL THE UNIVERSITY OF CALIFORNIA BE LIABLE TO ANY
+!     PARTY FOR DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL
+!     DAMAGES, INCLUDING LOST PROFITS, ARISING OUT OF THE USE OF THIS
+!     SOFTWARE AND ITS DOCUMENTATION, EVEN IF THE UNIVERSITY OF
+!     CALIFORNIA HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!     THE UNIVERSITY OF CALIFORNIA SPECIFICALLY DISCLAIMS ANY
+!     WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+!     OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. THE
+!     SOFTWARE PROVIDED HEREUNDER IS ON AN "AS IS" BASIS, AND THE
+!     UNIVERSITY OF CALIFORNIA HAS NO OBLIGATIONS TO PROVIDE
+!     MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+!
+!--------------------------------------------------------------------
+!--------------------------------------------------------------------
+!     Initial guess from the solutions of previous calls. The last
+!     ls%nPrj solutions are kept in ls%Xp, in the (scaled) ordering
+!     seen by the Krylov solvers. For a new system, their images under
+!     the current LHS are orthonormalized and the guess minimizing the
+!     residual over that subspace is used as the starting point.
+!--------------------------------------------------------------------
+
+!     Returns the projected initial guess X0 and replaces R with the
+!     corresponding residual R - K*X0
+      SUBROUTINE PROJGUESS(lhs, ls, dof, Val, R, X0)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      TYPE(FSILS_lsType), INTENT(IN) :: ls
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof
+      REAL(KIND=LSRP), INTENT(IN) :: Val(dof*dof,lhs%nnz)
+      REAL(KIND=LSRP), INTENT(INOUT) :: R(dof,lhs%nNo)
+      REAL(KIND=LSRP), INTENT(OUT) :: X0(dof,lhs%nNo)
+
+      INTEGER(KIND=LSIP) nNo, mynNo, nV, i, k, l, m
+      REAL(KIND=LSRP) nrm0, nrm, FSILS_NORMV
+      REAL(KIND=LSRP), ALLOCATABLE :: P(:,:,:), Q(:,:,:), h(:)
+
+      nNo   = lhs%nNo
+      mynNo = lhs%mynNo
+      nV    = ls%nX
+      X0    = 0._LSRP
+      IF (nV .EQ. 0) RETURN
+!     Saved set from a different LHS, e.g. before remeshing
+      IF (SIZE(ls%Xp,1).NE.dof .OR. SIZE(ls%Xp,2).NE.nNo) RETURN
+
+      ALLOCATE(P(dof,nNo,nV), Q(dof,nNo,nV), h(nV))
+
+!     Newest solution first, so that older ones are the ones dropped
+!     when the set is close to linearly dependent
+      m = 0
+      DO k=0, nV-1
+         i = MOD(ls%iX-1-k+ls%nPrj, ls%nPrj) + 1
+         P(:,:,m+1) = ls%Xp(:,:,i)
+         CALL FSILS_SPARMULVV(lhs, lhs%rowPtr, lhs%colPtr, dof, Val,    &
+     &      P(:,:,m+1), Q(:,:,m+1))
+         CALL ADDBCMUL(lhs, BCOP_TYPE_ADD, dof, P(:,:,m+1), Q(:,:,m+1))
+         nrm0 = FSILS_NORMV(dof, mynNo, lhs%commu, Q(:,:,m+1))
+         IF (nrm0 .EQ. 0._LSRP) CYCLE
+
+!     Classical Gram-Schmidt, applied twice, keeping K*P = Q
+         DO l=1, MIN(m,1)*2
+            CALL OMPMDOTV(dof, mynNo, nNo, m, Q, Q(:,:,m+1), h)
+            CALL FSILS_BCASTV(m, h, lhs%commu)
+            CALL OMPMSUMV(dof, nNo, nNo, m, -h(1:m), Q, Q(:,:,m+1))
+            CALL OMPMSUMV(dof, nNo, nNo, m, -h(1:m), P, P(:,:,m+1))
+         END DO
+         nrm = FSILS_NORMV(dof, mynNo, lhs%commu, Q(:,:,m+1))
+         IF (nrm .LE. SQRT(EPSILON(nrm))*nrm0) CYCLE
+
+         m = m + 1
+         Q(:,:,m) = Q(:,:,m)/nrm
+         P(:,:,m) = P(:,:,m)/nrm
+      END DO
+      IF (m .EQ. 0) RETURN
+
+      CALL OMPMDOTV(dof, mynNo, nNo, m, Q, R, h)
+      CALL FSILS_BCASTV(m, h, lhs%commu)
+      CALL OMPMSUMV(dof, nNo, nNo, m, h(1:m), P, X0)
+      CALL OMPMSUMV(dof, nNo, nNo, m, -h(1:m), Q, R)
+
+      RETURN
+      END SUBROUTINE PROJGUESS
+!--------------------------------------------------------------------
+!     Adds the solution X to the saved set, replacing the oldest one
+      SUBROUTINE PROJSAVE(lhs, ls, dof, X)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lhsType), INTENT(IN) :: lhs
+      TYPE(FSILS_lsType), INTENT(INOUT) :: ls
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof
+      REAL(KIND=LSRP), INTENT(IN) :: X(dof,lhs%nNo)
+
+      LOGICAL flag
+
+      flag = ALLOCATED(ls%Xp)
+      IF (flag) flag = SIZE(ls%Xp,1).EQ.dof .AND.                       &
+     &   SIZE(ls%Xp,2).EQ.lhs%nNo .AND. SIZE(ls%Xp,3).EQ.ls%nPrj
+      IF (.NOT.flag) THEN
+         IF (ALLOCATED(ls%Xp)) DEALLOCATE(ls%Xp)
+         ALLOCATE(ls%Xp(dof,lhs%nNo,ls%nPrj))
+         ls%nX = 0
+         ls%iX = 0
+      END IF
+
+      ls%iX = MOD(ls%iX, ls%nPrj) + 1
+      ls%Xp(:,:,ls%iX) = X
+      ls%nX = MIN(ls%nX+1, ls%nPrj)
+
+      RETURN
+      END SUBROUTINE PROJSAVE
+!####################################################################
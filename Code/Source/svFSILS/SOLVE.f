@@ -50,6 +50,7 @@
 
       SUBROUTINE FSILS_SOLVE (lhs, ls, dof, Ri, Val, prec, incL, res)
       INCLUDE "FSILS_STD.h"
+      INCLUDE "FSILS_KRYLOV.h"
       TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
       TYPE(FSILS_lsType), INTENT(INOUT) :: ls
       INTEGER(KIND=LSIP), INTENT(IN) :: dof, prec
@@ -58,9 +59,10 @@
       INTEGER(KIND=LSIP), INTENT(IN), OPTIONAL :: incL(lhs%nFaces)
       REAL(KIND=LSRP), INTENT(IN), OPTIONAL :: res(lhs%nFaces)
 
-      LOGICAL flag
+      LOGICAL flag, prj
       INTEGER(KIND=LSIP) faIn, a, nNo, nnz, nFaces
-      REAL(KIND=LSRP), ALLOCATABLE :: R(:,:), Wr(:,:), Wc(:,:)
+      REAL(KIND=LSRP) bNorm, pNorm, relTol, rTol, tmp, FSILS_NORMV
+      REAL(KIND=LSRP), ALLOCATABLE :: R(:,:), Wr(:,:), Wc(:,:), X0(:,:)
 
       nNo    = lhs%nNo
       nnz    = lhs%nnz
@@ -95,31 +97,71 @@
          R(:,lhs%map(a)) = Ri(:,a)
       END DO
 
+      lhs%bPC = 0
       IF (prec .EQ. PRECOND_FSILS) THEN
          CALL PRECONDDIAG(lhs, lhs%rowPtr, lhs%colPtr, lhs%diagPtr, dof,
      &      Val, R, Wc)
       ELSE IF (prec .EQ. PRECOND_RCS) THEN
          CALL PRECONDRNC(lhs, lhs%rowPtr, lhs%colPtr, lhs%diagPtr, dof,
      &      Val, R, Wr, Wc)
+      ELSE IF (prec .EQ. PRECOND_BJ) THEN
+         CALL PRECONDDIAG(lhs, lhs%rowPtr, lhs%colPtr, lhs%diagPtr, dof,
+     &      Val, R, Wc)
+         bNorm = FSILS_NORMV(dof, lhs%mynNo, lhs%commu, R)
+         CALL PRECONDBJ(lhs, lhs%rowPtr, lhs%colPtr, lhs%diagPtr, dof,
+     &      Val, R)
+      ELSE IF (prec .EQ. PRECOND_BILU) THEN
+         IF (ls%LS_type .NE. LS_TYPE_GMRES) THEN
+            PRINT *, "FSILS: block ILU requires GMRES"
+            STOP "FSILS: FATAL ERROR"
+         END IF
+         CALL PRECONDDIAG(lhs, lhs%rowPtr, lhs%colPtr, lhs%diagPtr, dof,
+     &      Val, R, Wc)
+         CALL PRECONDILU(lhs, lhs%rowPtr, lhs%colPtr, lhs%diagPtr, dof,
+     &      Val)
+         lhs%bPC = PRECOND_BILU
       ELSE
          PRINT *, "This linear solver and preconditioner combination"//
      &      "is not supported."
       END IF
 
+      rTol = ls%RI%relTol
+      IF (ls%ewFlag) THEN
+         IF (prec .NE. PRECOND_BJ)                                      &
+     &      bNorm = FSILS_NORMV(dof, lhs%mynNo, lhs%commu, R)
+         CALL EWTOL(ls, bNorm)
+      END IF
+
+!     Starting from the projection onto previous solutions. Tolerance
+!     stays relative to the full RHS
+      prj = ls%nPrj.GT.0 .AND. ls%LS_type.NE.LS_TYPE_NS
+      IF (prj) THEN
+         ALLOCATE(X0(dof,nNo))
+         relTol = ls%RI%relTol
+         pNorm  = FSILS_NORMV(dof, lhs%mynNo, lhs%commu, R)
+         CALL PROJGUESS(lhs, ls, dof, Val, R, X0)
+         tmp = FSILS_NORMV(dof, lhs%mynNo, lhs%commu, R)
+         IF (tmp .GT. 0._LSRP) ls%RI%relTol = relTol*pNorm/tmp
+      END IF
+
       SELECT CASE (ls%LS_type)
          CASE (LS_TYPE_NS)
             CALL NSSOLVER(lhs, ls, dof, Val, R)
          CASE (LS_TYPE_GMRES)
-            IF (dof .EQ. 1) THEN
+            IF (ls%mixP) THEN
+               CALL MPSOLVER(lhs, ls, dof, Val, R)
+            ELSE IF (dof .EQ. 1) THEN
                CALL GMRESS(lhs, ls%RI, Val, R)
             ELSE
-               CALL GMRESV(lhs, ls%RI, dof, Val, R)
+               CALL GMRESV(lhs, ls%RI, dof, R, Val=Val)
             END IF
          CASE (LS_TYPE_CG)
-            IF (dof .EQ. 1) THEN
+            IF (ls%mixP) THEN
+               CALL MPSOLVER(lhs, ls, dof, Val, R)
+            ELSE IF (dof .EQ. 1) THEN
                CALL CGRADS(lhs, ls%RI, Val, R)
             ELSE
-               CALL CGRADV(lhs, ls%RI, dof, Val, R)
+               CALL CGRADV(lhs, ls%RI, dof, R, K=Val)
             END IF
          CASE (LS_TYPE_BICGS)
             IF (dof .EQ. 1) THEN
@@ -131,7 +173,26 @@
             PRINT *, 'FSILS: LS_type not defined'
             STOP "FSILS: FATAL ERROR"
       END SELECT
+
+      IF (prj) THEN
+         R = R + X0
+         CALL PROJSAVE(lhs, ls, dof, R)
+         ls%RI%relTol = relTol
+         ls%RI%iNorm  = pNorm
+         DEALLOCATE(X0)
+      END IF
+
+!     Residual norms are reported relative to the diagonally scaled
+!     RHS, so that the nonlinear convergence checks do not depend on the
+!     block scaling
+      IF (prec .EQ. PRECOND_BJ) THEN
+         CALL PRECONDBJX(lhs, dof, R)
+         IF (ls%RI%iNorm .GT. 0._LSRP) ls%RI%fNorm = ls%RI%fNorm*bNorm/ &
+     &      ls%RI%iNorm
+         ls%RI%iNorm = bNorm
+      END IF
       R = R*Wc
+      ls%RI%relTol = rTol
 
       DO a=1, nNo
          Ri(:,a) = R(:,lhs%map(a))
@@ -142,3 +203,110 @@
       RETURN
       END SUBROUTINE FSILS_SOLVE
 !####################################################################
+!     Same as FSILS_SOLVE, but the LHS is never assembled. MATVEC is
+!     called with a vector in the caller's ordering and returns the
+!     product of the local (not communicated) LHS with it; Di is the
+!     diagonal of the LHS that is used to build the preconditioner.
+!     Only GMRES with the diagonal preconditioner is supported.
+      SUBROUTINE FSILS_MFSOLVE (lhs, ls, dof, Ri, Di, MATVEC, incL, res)
+      INCLUDE "FSILS_STD.h"
+      INCLUDE "FSILS_KRYLOV.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      TYPE(FSILS_lsType), INTENT(INOUT) :: ls
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof
+      REAL(KIND=LSRP), INTENT(INOUT) :: Ri(dof,lhs%nNo)
+      REAL(KIND=LSRP), INTENT(IN) :: Di(dof,lhs%nNo)
+      EXTERNAL MATVEC
+      INTEGER(KIND=LSIP), INTENT(IN), OPTIONAL :: incL(lhs%nFaces)
+      REAL(KIND=LSRP), INTENT(IN), OPTIONAL :: res(lhs%nFaces)
+
+      LOGICAL flag
+      INTEGER(KIND=LSIP) faIn, a, nNo
+      REAL(KIND=LSRP) rTol, FSILS_NORMV
+      REAL(KIND=LSRP), ALLOCATABLE :: R(:,:), W(:,:)
+
+      nNo = lhs%nNo
+
+      IF (lhs%nFaces .NE. 0) THEN
+         lhs%face%incFlag = .TRUE.
+         IF (PRESENT(incL)) THEN
+            DO faIn=1, lhs%nFaces
+               IF (incL(faIn) .EQ. 0 ) lhs%face(faIn)%incFlag = .FALSE.
+            END DO
+         END IF
+
+         flag = ANY(lhs%face%bGrp.EQ.BC_TYPE_Neu)
+         IF (.NOT.PRESENT(res) .AND. flag) THEN
+            PRINT *, "FSILS: res is required for Neu surfaces"
+            STOP "FSILS: FATAL ERROR"
+         END IF
+         DO faIn=1, lhs%nFaces
+            lhs%face(faIn)%coupledFlag = .FALSE.
+            IF (.NOT.lhs%face(faIn)%incFlag) CYCLE
+            flag = lhs%face(faIn)%bGrp .EQ. BC_TYPE_Neu
+            IF (flag .AND. res(faIn).NE.0._LSRP) THEN
+               lhs%face(faIn)%res = res(faIn)
+               lhs%face(faIn)%coupledFlag = .TRUE.
+            END IF
+         END DO
+      END IF
+
+      IF (ls%LS_type .NE. LS_TYPE_GMRES) THEN
+         PRINT *, "FSILS: matrix-free operator requires GMRES"
+         STOP "FSILS: FATAL ERROR"
+      END IF
+
+      ALLOCATE(R(dof,nNo), W(dof,nNo))
+      DO a=1, nNo
+         R(:,lhs%map(a)) = Ri(:,a)
+         W(:,lhs%map(a)) = Di(:,a)
+      END DO
+
+      lhs%bPC = 0
+      CALL PRECONDMF(lhs, dof, R, W)
+
+      rTol = ls%RI%relTol
+      IF (ls%ewFlag) CALL EWTOL(ls,                                     &
+     &   FSILS_NORMV(dof, lhs%mynNo, lhs%commu, R))
+
+      CALL GMRESV(lhs, ls%RI, dof, R, W=W, MATVEC=MATVEC)
+      R = R*W
+      ls%RI%relTol = rTol
+
+      DO a=1, nNo
+         Ri(:,a) = R(:,lhs%map(a))
+      END DO
+
+      DEALLOCATE(R, W)
+
+      RETURN
+      END SUBROUTINE FSILS_MFSOLVE
+!####################################################################
+!     Inexact Newton tolerance (Eisenstat-Walker, choice 2) from the
+!     reduction of the RHS norm since the last call. The caller resets
+!     ls%ewN at the first nonlinear iteration, where ls%ewMax is used.
+!     ls%RI%relTol is the lower bound and is replaced by the result.
+      SUBROUTINE EWTOL(ls, nrm)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lsType), INTENT(INOUT) :: ls
+      REAL(KIND=LSRP), INTENT(IN) :: nrm
+
+      REAL(KIND=LSRP), PARAMETER :: gam = 0.9_LSRP, alp = 2._LSRP
+      REAL(KIND=LSRP) eta, tmp
+
+      eta = ls%ewMax
+      IF (ls%ewN .GT. 0._LSRP) THEN
+         eta = gam*(nrm/ls%ewN)**alp
+!     Safeguard against a tolerance that drops too fast
+         tmp = gam*ls%ewE**alp
+         IF (tmp .GT. 0.1_LSRP) eta = MAX(eta, tmp)
+      END IF
+      eta = MAX(MIN(eta, ls%ewMax), ls%RI%relTol)
+
+      ls%ewN = nrm
+      ls%ewE = eta
+      ls%RI%relTol = eta
+
+      RETURN
+      END SUBROUTINE EWTOL
+!####################################################################
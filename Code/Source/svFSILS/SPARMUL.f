@@ -131,6 +131,43 @@
 
       RETURN
       END SUBROUTINE FSILS_SPARMULVV
+!--------------------------------------------------------------------
+!     Same as FSILS_SPARMULVV, with K stored in single precision
+      SUBROUTINE FSILS_SPARMULVV4(lhs, rowPtr, colPtr, dof, K, U, KU)
+      INCLUDE "FSILS_STD.h"
+      TYPE(FSILS_lhsType), INTENT(INOUT) :: lhs
+      INTEGER(KIND=LSIP), INTENT(IN) :: rowPtr(2,lhs%nNo),              &
+     &   colPtr(lhs%nnz)
+      INTEGER(KIND=LSIP), INTENT(IN) :: dof
+      REAL(KIND=LSRP4), INTENT(IN) :: K(dof*dof,lhs%nnz)
+      REAL(KIND=LSRP), INTENT(IN) :: U(dof,lhs%nNo)
+      REAL(KIND=LSRP), INTENT(OUT) :: KU(dof,lhs%nNo)
+
+      INTEGER(KIND=LSIP) nNo, i, j, l, m, s, col
+
+      nNo = lhs%nNo
+
+      KU = 0._LSRP
+!$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(i, j, l, m, s, col)
+!$OMP&   SCHEDULE(GUIDED)
+      DO i=1, nNo
+         DO j=rowPtr(1,i), rowPtr(2,i)
+            col = colPtr(j)
+            s   = 0
+            DO l=1, dof
+               DO m=1, dof
+                  s = s + 1
+                  KU(l,i) = KU(l,i) + REAL(K(s,j),LSRP)*U(m,col)
+               END DO
+            END DO
+         END DO
+      END DO
+!$OMP END PARALLEL DO
+
+      CALL FSILS_COMMUV(lhs, dof, KU)
+
+      RETURN
+      END SUBROUTINE FSILS_SPARMULVV4
 !--------------------------------------------------------------------
       SUBROUTINE FSILS_SPARMULVS(lhs, rowPtr, colPtr, dof, K, U, KU)
       INCLUDE "FSILS_STD.h"